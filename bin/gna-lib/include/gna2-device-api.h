@@ -0,0 +1,279 @@
+/**
+ @copyright Copyright (C) 2019-2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+/**************************************************************************//**
+ @file gna2-device-api.h
+ @brief Gaussian and Neural Accelerator (GNA) 3.0 API Definition.
+ @nosubgrouping
+
+ ******************************************************************************
+
+ @addtogroup GNA2_API
+ @{
+ ******************************************************************************
+
+ @addtogroup GNA2_DEVICE_API Device API
+
+ API for accessing and managing GNA hardware and software devices.
+
+ @{
+ *****************************************************************************/
+
+#ifndef __GNA2_DEVICE_API_H
+#define __GNA2_DEVICE_API_H
+
+#include "gna2-common-api.h"
+
+#include <cstdint>
+
+/**
+ Gets number of available GNA devices on this computer.
+
+ Number of opened devices is not relevant.
+ If hardware device is present on a platform but is not available via GNA API,
+ please verify if driver is properly installed and hardware is supported
+ by your GNA software version.
+ If no hardware device is available device number is set to 1,
+ as software device still can be used.
+ @see Gna2DeviceGetVersion() to determine version of available device.
+
+ @param [out] deviceCount Number of available devices.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceGetCount(
+    uint32_t * deviceCount);
+
+/**
+ Retrieves hardware device version.
+
+ Devices are zero-based indexed.
+ Select desired device providing deviceIndex from 0 to Gna2DeviceGetCount() - 1.
+ Corresponding device does not have to be opened.
+ @see Gna2DeviceGetCount().
+
+ @param deviceIndex Index of queried device.
+ @param [out] deviceVersion Gna2DeviceVersion identifier.
+    Set to Gna2DeviceVersionSoftwareEmulation when no hardware GNA device is available.
+ @return Status of the operation.
+ @retval Gna2StatusIdentifierInvalid The device with such index does not exits.
+ */
+GNA2_API enum Gna2Status Gna2DeviceGetVersion(
+    uint32_t deviceIndex,
+    enum Gna2DeviceVersion * deviceVersion);
+
+/**
+ Opens and initializes GNA device for processing.
+
+ Device indexes are zero-based.
+ Select desired device providing deviceIndex from 0 to Gna2DeviceGetCount - 1.
+ If no hardware devices are available, software device can be still opened
+ with deviceIndex = 0.
+
+ @note
+ - The device with same index can be opened multiple times (up to 1024) e.g. by different threads.
+ - The device has to be closed the same number of times it has been opened to prevent resource leakage.
+
+ @param deviceIndex Index of the device to be opened.
+ @return Status of the operation.
+ @retval Gna2StatusIdentifierInvalid The device with such index does not exits.
+ @retval Gna2StatusDeviceNotAvailable The device has been opened maximum number of times.
+ */
+GNA2_API enum Gna2Status Gna2DeviceOpen(
+    uint32_t deviceIndex);
+
+/**
+ Creates and initializes GNA software device for model export and enabling.
+
+ @note
+  - No Hardware inference is available on this device.
+  - deviceIndex is assigned by GNA library and is unique number from range <Gna2DeviceGetCount(); uint32_t max>.
+  - The device has to be closed to prevent resource leakage.
+
+ @param targetDeviceVersion Desired version of the device to be opened.
+        Gna2DeviceVersionSoftwareEmulation is not supported.
+ @param [out] deviceIndex Index of the opened device.
+ @return Status of the operation.
+ @retval Gna2StatusDeviceVersionInvalid The provided target version is invalid.
+ @retval Gna2StatusNullArgumentNotAllowed deviceIndex is null.
+ */
+GNA2_API enum Gna2Status Gna2DeviceCreateForExport(
+    Gna2DeviceVersion targetDeviceVersion,
+    uint32_t * deviceIndex);
+
+/**
+ Closes GNA device.
+
+ The device has to be closed the same number of times it has been opened to prevent resource leakage.
+ When last handle to the device is closed releases the corresponding device resources.
+
+ @param deviceIndex The device to be closed.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceClose(
+    uint32_t deviceIndex);
+
+/**
+ Sets number of software worker threads for given device.
+
+ @note
+    Must be called synchronously.
+
+ Device indexes are zero-based.
+ Select desired device providing deviceIndex from 0 to Gna2DeviceGetCount() - 1.
+
+ @param deviceIndex Index of the affected device.
+ @param numberOfThreads Number of software worker threads [1,127]. Default is 1.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetNumberOfThreads(
+    uint32_t deviceIndex,
+    uint32_t numberOfThreads);
+
+/**
+ Sets coalescing of pending software requests for given device.
+
+ Up to batchSizeMax enqueued requests for the same model are scored
+ in single grouped execution, so model parameters are read once per batch.
+ Only requests of models consisting of fully connected affine operations
+ with single input vector, scored in software mode without profiling
+ of operations are coalesced.
+ Outputs and statuses of coalesced requests are the same as when scored one by one.
+
+ @note
+    Must be called synchronously.
+
+ @param deviceIndex Index of the affected device.
+ @param batchSizeMax Maximum number of requests in batch [1,64]. Default is 1, i.e. coalescing disabled.
+ @param waitTimeMax Maximum time in microseconds to wait for further requests
+    before scoring batch. Default is 0, i.e. only already enqueued requests are coalesced.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetRequestBatching(
+    uint32_t deviceIndex,
+    uint32_t batchSizeMax,
+    uint32_t waitTimeMax);
+
+/**
+ Sets software budget of adaptive dispatching of requests for given device.
+
+ Requests processed in ::Gna2AccelerationModeHardwareWithSoftwareFallback mode
+ are routed to the device or to software, whichever is expected to complete the request first.
+ Expected completion time on the device is based on the number of requests
+ being processed by the device and on recent device processing time of the model.
+ Expected completion time in software is based on recent software processing time of the model.
+ Results are the same as of the device, as in case of software fallback.
+
+ @note
+    Must be called synchronously.
+    While dispatching is enabled, further requests are started while the device processes a request,
+    so at least two software worker threads are required, see Gna2DeviceSetNumberOfThreads().
+    Requests processed by the device and software concurrently must not share memory written by the model,
+    e.g., outputs should be set per request configuration with Gna2RequestConfigSetOperandBuffer().
+    Requests are scored in software one at a time, so budget greater than 1 has no effect.
+
+ @param deviceIndex Index of the affected device.
+ @param budget Maximum number of requests processed in software concurrently.
+    Default is 0, i.e. dispatching disabled and software is used only when device queue is full.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetSoftwareFallbackBudget(
+    uint32_t deviceIndex,
+    uint32_t budget);
+
+/**
+ Enables tuning of software kernels of models loaded to given device.
+
+ On first software processing of each operation, the operation is processed
+ with each acceleration mode supported by the CPU, and with each piecewise-linear activation algorithm
+ applicable, and the fastest kernels are used since.
+ Tuning results are kept per operation type, parameters and operand shapes and shared by models,
+ and if tuningCacheFile is given, also stored in the file and reused by subsequent processes on the same CPU.
+ Only requests with ::Gna2AccelerationModeAuto or ::Gna2AccelerationModeSoftware
+ and hardware consistency enabled are affected, explicitly requested acceleration mode is always respected,
+ thus results are the same as without tuning.
+ Operations reading memory they write, e.g. with output overlapping input, are not tuned.
+
+ @note
+    Must be called synchronously, before loading models to be tuned.
+    Tuning is disabled while profiling of operations is enabled.
+
+ @param deviceIndex Index of the affected device.
+ @param tuningCacheFile Path of file with tuning results, created if not exists.
+    NULL disables storing results, i.e. each process tunes models again.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceEnableKernelTuning(
+    uint32_t deviceIndex,
+    char const * tuningCacheFile);
+
+/**
+ Estimated costs used to partition models between the device and software.
+
+ Processing time of operation is bound by either multiply-accumulates or operand memory traffic.
+ Default values are coarse estimates, that should be adjusted to measurements of the target platform:
+ device throughput assumes 400 MHz device clock with half of 64 multiply-accumulates per cycle
+ of 8 GNA 3.0 compute engines utilized and 8 GB/s of memory bandwidth,
+ software throughput assumes single worker thread with AVX2 kernels.
+
+ @see Gna2ModelGetPartition()
+ */
+struct Gna2PartitionCosts
+{
+    /**
+     Time in nanoseconds of driver submission and completion of single device partition.
+     Default is 50000.
+     */
+    uint32_t SubmissionTime;
+
+    /**
+     Software throughput in multiply-accumulates per microsecond. Default is 4000.
+     */
+    uint32_t SoftwareMacsPerMicrosecond;
+
+    /**
+     Software throughput in bytes of operands per microsecond. Default is 16000.
+     */
+    uint32_t SoftwareBytesPerMicrosecond;
+
+    /**
+     Device throughput in multiply-accumulates per microsecond. Default is 12800.
+     */
+    uint32_t HardwareMacsPerMicrosecond;
+
+    /**
+     Device throughput in bytes of operands per microsecond. Default is 8000.
+     */
+    uint32_t HardwareBytesPerMicrosecond;
+
+    /**
+     Throughput in bytes per microsecond of data passed between software and device partitions.
+     Default is 4000.
+     */
+    uint32_t TransferBytesPerMicrosecond;
+};
+
+/**
+ Sets estimated costs used to partition models loaded to given device.
+
+ @note
+    Must be called synchronously, before loading models to be partitioned.
+    Partitions of already loaded models are not changed.
+
+ @param deviceIndex Index of the affected device.
+ @param costs Estimated costs, all throughputs have to be greater than 0.
+ @return Status of the operation.
+    @retval Gna2StatusNullArgumentNotAllowed in case of costs == NULL.
+    @retval Gna2StatusDeviceParameterOutOfRange in case of zero throughput.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetPartitionCosts(
+    uint32_t deviceIndex,
+    struct Gna2PartitionCosts const * costs);
+
+#endif // __GNA2_DEVICE_API_H
+
+/**
+ @}
+ @}
+ */
@@ -0,0 +1,471 @@
+/**
+ @copyright Copyright (C) 2019-2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+/**************************************************************************//**
+ @file gna2-inference-api.h
+ @brief Gaussian and Neural Accelerator (GNA) 3.0 API Definition.
+ @nosubgrouping
+
+ ******************************************************************************
+
+ @addtogroup GNA2_API
+ @{
+ ******************************************************************************
+
+ @addtogroup GNA2_API_INFERENCE Inference API
+
+ API for configuring and running inference requests.
+
+ @{
+ *****************************************************************************/
+
+#ifndef __GNA2_INFERENCE_API_H
+#define __GNA2_INFERENCE_API_H
+
+#include "gna2-common-api.h"
+
+#include <cstdint>
+
+/**
+ Adds single request configuration for use with the model.
+
+ Request configurations have to be declared a priori to minimize the
+ request preparation time and reduce processing latency.
+ This configuration holds buffers that can be used with consecutive requests
+ to handle asynchronous processing.
+ When requests are processed asynchronously each one needs to have individual
+ Input and output buffers set by this configuration.
+ Configurations can be reused with another request when the request
+ with the current configuration has been completed and retrieved by Gna2RequestWait().
+ Eg. The user can create 8 unique configurations and reuse them
+ with consecutive batches of 8 requests, when batches are enqueued sequentially.
+
+ @note
+ - Unreleased configurations are released by GNA during corresponding model release.
+
+ @param modelId The model that utilizes the request configuration.
+                Request configuration cannot be shared with other models.
+ @param [out] requestConfigId Request configuration created by GNA.
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusNullArgumentNotAllowed On requestConfigId == nullptr.
+    @retval Gna2StatusIdentifierInvalid On invalid modelId.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigCreate(
+    uint32_t modelId,
+    uint32_t * requestConfigId);
+
+/**
+ Sets a buffer of the operation operand for the request configuration.
+
+ @note
+ - Buffer addresses need to be within the memory allocated previously by Gna2MemoryAlloc.
+ - Buffers are deleted by GNA during corresponding request configuration release.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param operationIndex Index of the affected operation.
+ @param operandIndex Index of the affected operand.
+ @param address Address of the buffer.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigSetOperandBuffer(
+    uint32_t requestConfigId,
+    uint32_t operationIndex,
+    uint32_t operandIndex,
+    void * address);
+
+/**
+ Adds active outputs list to the request configuration.
+
+ Active output list can be specified only for the output (usually last) operation(s).
+ Only one active list can be added to each output operation.
+ To modify indices for consecutive requests during sequential processing
+ user can modify the content of the indices buffer.
+ To modify indices for consecutive requests during parallel processing
+ user can create additional configurations with appropriate parameters.
+
+ @note
+ - Active lists are deleted by GNA during corresponding request configuration release.
+ - Buffer addresses need to be within the memory allocated previously by GNAAlloc.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param operationIndex Index of the affected operation.
+                       The operation must have an output buffer already assigned.
+ @param numberOfIndices The number of indices in the active list.
+ @param indices The address of the array with active output indices.
+ @return Status of the operation.
+ @see Gna2RequestConfigCreate and Gna2RequestConfigSetOperandBuffer for details.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigEnableActiveList(
+    uint32_t requestConfigId,
+    uint32_t operationIndex,
+    uint32_t numberOfIndices,
+    uint32_t const * indices);
+
+/**
+ @deprecated Hardware Consistency is enabled by default. This function only restores consistency
+ disabled with Gna2RequestConfigDisableHardwareConsistency().
+ For backward compatibility it will return success when present configuration is compatible
+ with selected deviceVersion, Gna2StatusDeviceVersionInvalid otherwise.
+ Enables software result consistency with selected device version.
+
+ Assures that for given request config software mode inference results
+ (scores) are bit-exact with that produced by the hardware device .
+ Useful e.g. for verification of results from model created and exported
+ for GNA embedded devices.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param deviceVersion Device version to be consistent with.
+ @return Status of the operation.
+ @retval Gna2StatusDeviceVersionInvalid when deviceVersion is not compatible with present configuration
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigEnableHardwareConsistency(
+    uint32_t requestConfigId,
+    enum Gna2DeviceVersion deviceVersion);
+
+/**
+ Disables software result consistency with the hardware device.
+
+ For given request config software modes skip emulation of device internal
+ buffers and use simpler and faster kernels for affine (fully connected,
+ active list, multi bias, large batch) and recurrent operations.
+ Other operations are processed as in hardware consistent mode.
+
+ Numeric differences comparing to hardware consistent mode:
+ - Device splits the input vector into chunks of buffer size
+   and saturates the partial sum after each chunk.
+   In relaxed mode sums are accumulated with 64-bit precision
+   and saturated to 32 bits only once, when stored to output.
+ - Results are bit-exact with consistent mode as long as no partial sum
+   exceeds 32-bit range, otherwise relaxed results are closer to
+   mathematically exact values and may differ from device.
+ - Number of reported saturations may differ for the same reasons.
+
+ @note
+ - Has no effect for requests processed in hardware mode.
+ - Reverted with Gna2RequestConfigEnableHardwareConsistency() called with present device version.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigDisableHardwareConsistency(
+    uint32_t requestConfigId);
+
+/**
+ The list of processing acceleration modes.
+
+ Current acceleration modes availability depends on the CPU type.
+ Available modes are detected by GNA.
+
+  Inference results (scores) in software modes are bit-exact with that produced
+  by the present or selected target hardware device,
+  unless disabled with Gna2RequestConfigDisableHardwareConsistency().
+ */
+enum Gna2AccelerationMode
+{
+    /**
+     Fully automated acceleration selection.
+
+     GNA library, based on availability, selects hardware mode or the best
+     (highest performance) applicable software acceleration.
+
+     The order of preference is as follows:
+         1. ::Gna2AccelerationModeHardware,
+         2. ::Gna2AccelerationModeAvx2,
+         3. ::Gna2AccelerationModeAvx1,
+         4. ::Gna2AccelerationModeSse4x2
+         5. ::Gna2AccelerationModeGeneric.
+     */
+    Gna2AccelerationModeAuto = GNA2_DEFAULT,
+
+    /**
+     Automated software acceleration selection.
+
+     Automatic software emulation selection similar as in ::Gna2AccelerationModeAuto.
+     Only software optimizations are selected, even if GNA hardware device is available.
+     */
+    Gna2AccelerationModeSoftware = 1,
+
+    /**
+     GNA Hardware device acceleration.
+
+     Enforces the usage of GNA Hardware acceleration.
+     Hardware acceleration has saturation detection always enabled.
+     */
+    Gna2AccelerationModeHardware = 2,
+
+    /**
+     AVX2 Software acceleration.
+
+     Enforce the usage of optimized software implementation,
+     using AVX2 CPU instruction set.
+     */
+    Gna2AccelerationModeAvx2 = 3,
+
+    /**
+     AVX1 Software acceleration.
+
+     Enforce the usage of optimized software implementation,
+     using AVX1 CPU instruction set.
+     */
+    Gna2AccelerationModeAvx1 = 4,
+
+    /**
+     SSE4.2 Software acceleration.
+
+     Enforce the usage of optimized software implementation,
+     using SSE4.2 CPU instruction set.
+     */
+    Gna2AccelerationModeSse4x2 = 5,
+
+    /**
+     Generic software implementation.
+
+     Enforce the usage of generic software implementation,
+     using basic x86 CPU instruction set.
+     */
+    Gna2AccelerationModeGeneric = 6,
+
+    /**
+     Hardware mode with automatic fallback to software acceleration mode.
+
+     To reduce the probability of audio glitches when running "RT" workload user can use immediate
+     auto software fallback mechanism.
+     When enabled GNA uses software acceleration fallback whenever the GNA driver request
+     queue is not empty, regardless of any other circumstances. Software processing is executed
+     automatically and immediately after driver returns queue not empty status.
+     This minimizes latency and maximize probability to process given request on time  when
+     hardware is busy.
+     */
+    Gna2AccelerationModeHardwareWithSoftwareFallback = 7,
+};
+
+/**
+ Enforces processing request with selected acceleration mode.
+
+ When not set ::Gna2AccelerationModeAuto is used.
+ @see Gna2AccelerationMode.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param accelerationMode Acceleration mode used for processing.
+ @return Status of the operation.
+    @retval Gna2StatusAccelerationModeNotSupported when mode is not available or invalid.
+    @retval Gna2StatusIdentifierInvalid in case of invalid requestConfigId.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigSetAccelerationMode(
+    uint32_t requestConfigId,
+    enum Gna2AccelerationMode accelerationMode);
+
+/**
+ Releases request config and its resources.
+
+ @note
+ - Not thread-safe.
+ - Please make sure all requests using this config are completed.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigRelease(
+    uint32_t requestConfigId);
+
+/**
+ Sets deadline of requests created with request config.
+
+ Pending requests are processed in earliest-deadline-first order,
+ requests without deadline are processed after all requests with deadline,
+ requests with equal deadline and requests of the same session
+ are processed in order of enqueueing.
+ Request not started before its deadline expires is dropped
+ and Gna2RequestWait returns Gna2StatusRequestDeadlineExceeded.
+
+ @note
+ - Deadline applies to requests enqueued after it is set.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param deadlineMicroseconds Time in microseconds from enqueueing the request
+    within which its processing has to start, 0 disables deadline (default).
+ @return Status of the operation.
+    @retval Gna2StatusIdentifierInvalid in case of invalid requestConfigId.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigSetDeadline(
+    uint32_t requestConfigId,
+    uint32_t deadlineMicroseconds);
+
+/**
+ Creates and enqueues a request for asynchronous processing.
+
+ @note
+ - Request's life cycle and memory is managed by GNA.
+ - The model, that the request will be calculated against is provided by configuration.
+ - Maximum number of requests that can wait in the queue at once is 64.
+
+ @param requestConfigId The request configuration.
+ @param [out] requestId Identifier of the enqueued request.
+ @return Status of request preparation and queuing only.
+    To retrieve the results and processing status call Gna2RequestWait.
+    @retval Gna2StatusIdentifierInvalid in case of invalid requestConfigId.
+    @retval Gna2StatusNullArgumentNotAllowed in case of requestId == nullptr.
+ */
+GNA2_API enum Gna2Status Gna2RequestEnqueue(
+    uint32_t requestConfigId,
+    uint32_t * requestId);
+
+/**
+ Waits for the request processing to be completed.
+
+ @note
+ - If processing is completed before the timeout expires, the request object is released.
+   Otherwise processing status is returned.
+ - Not retrieved requests are released by GNA during corresponding device release.
+ - User is responsible for retrieving all enqueued requests
+   by calling Gna2RequestWait for each request.
+
+ @param requestId The request to wait for.
+ @param timeoutMilliseconds Timeout duration in milliseconds.
+ @return Status of request processing.
+ */
+GNA2_API enum Gna2Status Gna2RequestWait(
+    uint32_t requestId,
+    uint32_t timeoutMilliseconds);
+
+/**
+ Cancels the request enqueued and not processed yet.
+
+ Request waiting in the queue is dropped immediately.
+ Request already being processed stops before its next operation
+ or before its next submission to the device.
+ Operations already submitted to the device are completed.
+
+ @note
+ - Canceled request still has to be retrieved with Gna2RequestWait,
+   that returns Gna2StatusRequestCanceled, unless processing was already completed.
+
+ @param requestId The request to cancel.
+ @return Status of the operation.
+    @retval Gna2StatusIdentifierInvalid in case request is not pending,
+        e.g. its processing is already completed.
+ */
+GNA2_API enum Gna2Status Gna2RequestCancel(
+    uint32_t requestId);
+
+/**
+ Creates streaming session for the request configuration.
+
+ Session holds state of single stream processed by consecutive requests,
+ i.e. last outputs of each recurrent operation, that are fed back
+ to the first output vectors of the next request.
+ State is kept in library memory and copied to the delay line preceding
+ the recurrent operation output buffer before each request of the session is processed,
+ then advanced to the last outputs of the request when processing succeeds.
+ Thus the caller does not need to rebind or shift output buffers between consecutive frames.
+ Multiple sessions, e.g. one per stream, can share the same request configuration.
+ Initially the state is zero.
+
+ @note
+ - Sessions are released by GNA during corresponding request configuration release.
+
+ @param requestConfigId The request configuration used by requests of the session.
+ @param [out] sessionId Session created by GNA.
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusNullArgumentNotAllowed On sessionId == nullptr.
+    @retval Gna2StatusIdentifierInvalid On invalid requestConfigId.
+ */
+GNA2_API enum Gna2Status Gna2SessionCreate(
+    uint32_t requestConfigId,
+    uint32_t * sessionId);
+
+/**
+ Creates and enqueues a request of the session for asynchronous processing.
+
+ Requests of the session advance its state in the order of enqueuing.
+ @see Gna2RequestEnqueue for details.
+
+ @param sessionId The session.
+ @param [out] requestId Identifier of the enqueued request.
+ @return Status of request preparation and queuing only.
+    To retrieve the results and processing status call Gna2RequestWait.
+ */
+GNA2_API enum Gna2Status Gna2SessionEnqueue(
+    uint32_t sessionId,
+    uint32_t * requestId);
+
+/**
+ Resets state of the session to zero, e.g. at the beginning of the new stream.
+
+ @note
+ - All requests of the session have to be retrieved by Gna2RequestWait.
+
+ @param sessionId The session.
+ @return Status of the operation.
+    @retval Gna2StatusWarningDeviceBusy When requests of the session are not retrieved.
+ */
+GNA2_API enum Gna2Status Gna2SessionReset(
+    uint32_t sessionId);
+
+/**
+ Gets size of the session state, in bytes.
+
+ @param sessionId The session.
+ @param [out] stateSize Size of the state of all recurrent operations.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2SessionGetStateSize(
+    uint32_t sessionId,
+    uint32_t * stateSize);
+
+/**
+ Saves checkpoint of the session state to the user buffer.
+
+ @note
+ - All requests of the session have to be retrieved by Gna2RequestWait.
+
+ @param sessionId The session.
+ @param [out] state Buffer for the state.
+ @param stateSize Size of the state buffer, as returned by Gna2SessionGetStateSize.
+ @return Status of the operation.
+    @retval Gna2StatusWarningDeviceBusy When requests of the session are not retrieved.
+    @retval Gna2StatusMemorySizeInvalid On invalid stateSize.
+ */
+GNA2_API enum Gna2Status Gna2SessionSaveState(
+    uint32_t sessionId,
+    void * state,
+    uint32_t stateSize);
+
+/**
+ Restores the session state from checkpoint saved by Gna2SessionSaveState.
+
+ @note
+ - All requests of the session have to be retrieved by Gna2RequestWait.
+
+ @param sessionId The session.
+ @param state Buffer with the state.
+ @param stateSize Size of the state buffer, as returned by Gna2SessionGetStateSize.
+ @return Status of the operation.
+    @retval Gna2StatusWarningDeviceBusy When requests of the session are not retrieved.
+    @retval Gna2StatusMemorySizeInvalid On invalid stateSize.
+ */
+GNA2_API enum Gna2Status Gna2SessionRestoreState(
+    uint32_t sessionId,
+    void const * state,
+    uint32_t stateSize);
+
+/**
+ Releases the session and its state.
+
+ @param sessionId The session.
+ @return Status of the operation.
+    @retval Gna2StatusWarningDeviceBusy When requests of the session are not retrieved.
+ */
+GNA2_API enum Gna2Status Gna2SessionRelease(
+    uint32_t sessionId);
+
+#endif // __GNA2_INFERENCE_API_H
+
+/**
+ @}
+ @}
+ */
@@ -0,0 +1,195 @@
+/**
+ @copyright Copyright (C) 2019-2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+/**************************************************************************//**
+ @file gna2-memory-api.h
+ @brief Gaussian and Neural Accelerator (GNA) 3.0 API Definition.
+ @nosubgrouping
+
+ ******************************************************************************
+ @addtogroup GNA2_API
+ @{
+
+ ******************************************************************************
+
+ @addtogroup GNA2_API_MEMORY Memory API
+
+ API for managing memory used by GNA Tensors.
+
+ @{
+ *****************************************************************************/
+
+#ifndef __GNA2_MEMORY_API_H
+#define __GNA2_MEMORY_API_H
+
+#include "gna2-common-api.h"
+
+#include <cstdint>
+
+/**
+ For Linux OS, following is in place:
+ 1. when score request is enqueued to given GNA HW, it's memory buffers must be bound to that GNA HW.
+ 2. buffer to GNA HW binding can be done in two ways:
+    1. (Implicitly) through Gna2MemoryAlloc(...) - first already opened GNA HW will be chosen (if any). For most cases GNA HW is opened prior any subsequent operation.
+    2. (Explicitly) through Gna2MemoryAllocForDevice(deviceIndex, ...) with deviceIndex pointing to that device - useful when more than one GNA HW is present in system.
+ 3. memory rebinding is impossible.
+ 4. when GNA HW is closed, all memory buffers bound to it are also implicitly closed.
+ */
+
+
+/**
+ Allocates memory buffer, that can be used with GNA device.
+
+ see comment above
+
+ @param sizeRequested Buffer size desired by the caller. Must be within range <1, 2^28>.
+ @param [out] sizeGranted Buffer size granted by GNA,
+                      can be more then requested due to HW constraints.
+ @param [out] memoryAddress Address of memory buffer
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusMemorySizeInvalid If sizeRequested is invalid.
+ */
+GNA2_API enum Gna2Status Gna2MemoryAlloc(
+    uint32_t sizeRequested,
+    uint32_t * sizeGranted,
+    void ** memoryAddress);
+
+/**
+ Allocates memory buffer, that can be used with GNA device - device aware
+
+ see comment above
+
+ @param deviceIndex assures device is open prior allocation.
+ @param sizeRequested Buffer size desired by the caller. Must be within range <1, 2^28>.
+ @param [out] sizeGranted Buffer size granted by GNA,
+                          can be more then requested due to HW constraints.
+ @param [out] memoryAddress Address of memory buffer
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusMemorySizeInvalid If sizeRequested is invalid.
+
+ */
+GNA2_API enum Gna2Status Gna2MemoryAllocForDevice(
+    uint32_t deviceIndex,
+    uint32_t sizeRequested,
+    uint32_t * sizeGranted,
+    void ** memoryAddress);
+
+/**
+ Memory allocation flags.
+
+ @see Gna2MemoryAllocWithFlags()
+ */
+enum Gna2MemoryAllocFlag
+{
+    /**
+     Default allocation, memory buffer is zero-filled.
+     */
+    Gna2MemoryAllocFlagNone = 0,
+
+    /**
+     Memory buffer is not zero-filled, its contents are undefined until written.
+
+     Use for buffers that will be fully overwritten by the caller,
+     e.g., weights loaded from file or output buffers.
+     @note Memory allocated by GNA driver is always zeroed by the operating system.
+     */
+    Gna2MemoryAllocFlagNoZeroFill = 0x1,
+};
+
+/**
+ Allocates memory buffer, that can be used with GNA device - device aware, with allocation flags.
+
+ see comment above
+
+ @param deviceIndex assures device is open prior allocation.
+ @param sizeRequested Buffer size desired by the caller. Must be within range <1, 2^28>.
+ @param flags Bitwise combination of ::Gna2MemoryAllocFlag values.
+ @param [out] sizeGranted Buffer size granted by GNA,
+                          can be more then requested due to HW constraints.
+ @param [out] memoryAddress Address of memory buffer
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusMemorySizeInvalid If sizeRequested is invalid.
+    @retval Gna2StatusNotImplemented If flags are not supported.
+ */
+GNA2_API enum Gna2Status Gna2MemoryAllocWithFlags(
+    uint32_t deviceIndex,
+    uint32_t sizeRequested,
+    uint32_t flags,
+    uint32_t * sizeGranted,
+    void ** memoryAddress);
+
+/**
+ Releases memory buffer.
+
+ For regions registered with Gna2MemoryRegisterReadOnly() only unregisters the region.
+
+ @param memory Memory buffer to be freed.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2MemoryFree(
+    void * memory);
+
+/**
+ Registers read-only memory region provided by the caller, that can be used for model operands.
+
+ Intended for memory-mapped (e.g., mmap() with PROT_READ and MAP_SHARED) model files,
+ so weights, biases and activation segments can be paged in on demand
+ and shared among processes via page cache without copying them into memory
+ obtained with Gna2MemoryAlloc().
+ Registered region is tagged with ::Gna2MemoryTagReadOnlyMapped.
+ @note
+ - Region is not copied and is not released by GNA library.
+   Caller is responsible for keeping it valid until it is unregistered with Gna2MemoryFree()
+   and for unmapping it afterwards.
+ - Region is not mapped to GNA HW, thus operations using it are scored in software,
+   also in ::Gna2AccelerationModeAuto and ::Gna2AccelerationModeHardwareWithSoftwareFallback,
+   while ::Gna2AccelerationModeHardware is not supported for such models.
+ - Region must not be used for operands written by GNA (e.g., outputs, scratch or state),
+   such outputs are rejected by Gna2ModelCreate() and Gna2RequestConfigSetOperandBuffer()
+   with Gna2StatusMemoryBufferInvalid, and region cannot be tagged with Gna2MemorySetTag().
+
+ @param memory Starting address of the region. Must be aligned to 64 bytes.
+ @param size Size of the region in bytes. Must be within range <1, 2^28>.
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusNullArgumentNotAllowed If memory is NULL.
+    @retval Gna2StatusMemoryAlignmentInvalid If memory is not aligned.
+    @retval Gna2StatusMemorySizeInvalid If size is invalid.
+    @retval Gna2StatusMemoryBufferInvalid If region overlaps already allocated or registered memory.
+ */
+GNA2_API enum Gna2Status Gna2MemoryRegisterReadOnly(
+    void * memory,
+    uint32_t size);
+
+/**
+ Adds special designation for the memory buffer.
+ The buffer can be one of the previously obtained with Gna2MemoryAlloc.
+ @note
+ - This is for embedded model export only.
+ - In case of some doubts, probably should not use this function.
+ - Software modes may leave outputs of copy and transposition operations unwritten,
+   when they are in memory tagged with ::Gna2MemoryTagScratch and are read only by subsequent operations.
+
+ @param memory Starting address of the memory buffer to tag.
+ @param tag Special purpose tag. Use zero to reset to default. @see ::Gna2MemoryTag
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusMemoryBufferInvalid If memory address is invalid
+        or memory was registered with Gna2MemoryRegisterReadOnly().
+ */
+GNA2_API enum Gna2Status Gna2MemorySetTag(
+    void * memory,
+    uint32_t tag);
+
+
+#endif // __GNA2_MEMORY_API_H
+
+/**
+ @}
+ @}
+ */
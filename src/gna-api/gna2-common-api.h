@@ -367,6 +367,16 @@ enum Gna2Status
     */
     Gna2StatusHardwareModuleSymbolNotFound = -91,
 
+    /**
+     Error: Request was canceled by Gna2RequestCancel() before its processing completed.
+    */
+    Gna2StatusRequestCanceled = -92,
+
+    /**
+     Error: Request was dropped, as its deadline expired before its processing started.
+    */
+    Gna2StatusRequestDeadlineExceeded = -93,
+
     /**
      Error: Unsuccessful mapping of the memory.
      */
@@ -131,6 +131,146 @@ GNA2_API enum Gna2Status Gna2DeviceSetNumberOfThreads(
     uint32_t deviceIndex,
     uint32_t numberOfThreads);
 
+/**
+ Sets coalescing of pending software requests for given device.
+
+ Up to batchSizeMax enqueued requests for the same model are scored
+ in single grouped execution, so model parameters are read once per batch.
+ Only requests of models consisting of fully connected affine operations
+ with single input vector, scored in software mode without profiling
+ of operations are coalesced.
+ Outputs and statuses of coalesced requests are the same as when scored one by one.
+
+ @note
+    Must be called synchronously.
+
+ @param deviceIndex Index of the affected device.
+ @param batchSizeMax Maximum number of requests in batch [1,64]. Default is 1, i.e. coalescing disabled.
+ @param waitTimeMax Maximum time in microseconds to wait for further requests
+    before scoring batch. Default is 0, i.e. only already enqueued requests are coalesced.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetRequestBatching(
+    uint32_t deviceIndex,
+    uint32_t batchSizeMax,
+    uint32_t waitTimeMax);
+
+/**
+ Sets software budget of adaptive dispatching of requests for given device.
+
+ Requests processed in ::Gna2AccelerationModeHardwareWithSoftwareFallback mode
+ are routed to the device or to software, whichever is expected to complete the request first.
+ Expected completion time on the device is based on the number of requests
+ being processed by the device and on recent device processing time of the model.
+ Expected completion time in software is based on recent software processing time of the model.
+ Results are the same as of the device, as in case of software fallback.
+
+ @note
+    Must be called synchronously.
+    While dispatching is enabled, further requests are started while the device processes a request,
+    so at least two software worker threads are required, see Gna2DeviceSetNumberOfThreads().
+    Requests processed by the device and software concurrently must not share memory written by the model,
+    e.g., outputs should be set per request configuration with Gna2RequestConfigSetOperandBuffer().
+    Requests are scored in software one at a time, so budget greater than 1 has no effect.
+
+ @param deviceIndex Index of the affected device.
+ @param budget Maximum number of requests processed in software concurrently.
+    Default is 0, i.e. dispatching disabled and software is used only when device queue is full.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetSoftwareFallbackBudget(
+    uint32_t deviceIndex,
+    uint32_t budget);
+
+/**
+ Enables tuning of software kernels of models loaded to given device.
+
+ On first software processing of each operation, the operation is processed
+ with each acceleration mode supported by the CPU, and with each piecewise-linear activation algorithm
+ applicable, and the fastest kernels are used since.
+ Tuning results are kept per operation type, parameters and operand shapes and shared by models,
+ and if tuningCacheFile is given, also stored in the file and reused by subsequent processes on the same CPU.
+ Only requests with ::Gna2AccelerationModeAuto or ::Gna2AccelerationModeSoftware
+ and hardware consistency enabled are affected, explicitly requested acceleration mode is always respected,
+ thus results are the same as without tuning.
+ Operations reading memory they write, e.g. with output overlapping input, are not tuned.
+
+ @note
+    Must be called synchronously, before loading models to be tuned.
+    Tuning is disabled while profiling of operations is enabled.
+
+ @param deviceIndex Index of the affected device.
+ @param tuningCacheFile Path of file with tuning results, created if not exists.
+    NULL disables storing results, i.e. each process tunes models again.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceEnableKernelTuning(
+    uint32_t deviceIndex,
+    char const * tuningCacheFile);
+
+/**
+ Estimated costs used to partition models between the device and software.
+
+ Processing time of operation is bound by either multiply-accumulates or operand memory traffic.
+ Default values are coarse estimates, that should be adjusted to measurements of the target platform:
+ device throughput assumes 400 MHz device clock with half of 64 multiply-accumulates per cycle
+ of 8 GNA 3.0 compute engines utilized and 8 GB/s of memory bandwidth,
+ software throughput assumes single worker thread with AVX2 kernels.
+
+ @see Gna2ModelGetPartition()
+ */
+struct Gna2PartitionCosts
+{
+    /**
+     Time in nanoseconds of driver submission and completion of single device partition.
+     Default is 50000.
+     */
+    uint32_t SubmissionTime;
+
+    /**
+     Software throughput in multiply-accumulates per microsecond. Default is 4000.
+     */
+    uint32_t SoftwareMacsPerMicrosecond;
+
+    /**
+     Software throughput in bytes of operands per microsecond. Default is 16000.
+     */
+    uint32_t SoftwareBytesPerMicrosecond;
+
+    /**
+     Device throughput in multiply-accumulates per microsecond. Default is 12800.
+     */
+    uint32_t HardwareMacsPerMicrosecond;
+
+    /**
+     Device throughput in bytes of operands per microsecond. Default is 8000.
+     */
+    uint32_t HardwareBytesPerMicrosecond;
+
+    /**
+     Throughput in bytes per microsecond of data passed between software and device partitions.
+     Default is 4000.
+     */
+    uint32_t TransferBytesPerMicrosecond;
+};
+
+/**
+ Sets estimated costs used to partition models loaded to given device.
+
+ @note
+    Must be called synchronously, before loading models to be partitioned.
+    Partitions of already loaded models are not changed.
+
+ @param deviceIndex Index of the affected device.
+ @param costs Estimated costs, all throughputs have to be greater than 0.
+ @return Status of the operation.
+    @retval Gna2StatusNullArgumentNotAllowed in case of costs == NULL.
+    @retval Gna2StatusDeviceParameterOutOfRange in case of zero throughput.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetPartitionCosts(
+    uint32_t deviceIndex,
+    struct Gna2PartitionCosts const * costs);
+
 #endif // __GNA2_DEVICE_API_H
 
 /**
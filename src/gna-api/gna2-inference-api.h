@@ -105,7 +105,8 @@ GNA2_API enum Gna2Status Gna2RequestConfigEnableActiveList(
     uint32_t const * indices);
 
 /**
- @deprecated Hardware Consistency is now always enabled. This function will have no effect.
+ @deprecated Hardware Consistency is enabled by default. This function only restores consistency
+ disabled with Gna2RequestConfigDisableHardwareConsistency().
  For backward compatibility it will return success when present configuration is compatible
  with selected deviceVersion, Gna2StatusDeviceVersionInvalid otherwise.
  Enables software result consistency with selected device version.
@@ -124,6 +125,34 @@ GNA2_API enum Gna2Status Gna2RequestConfigEnableHardwareConsistency(
     uint32_t requestConfigId,
     enum Gna2DeviceVersion deviceVersion);
 
+/**
+ Disables software result consistency with the hardware device.
+
+ For given request config software modes skip emulation of device internal
+ buffers and use simpler and faster kernels for affine (fully connected,
+ active list, multi bias, large batch) and recurrent operations.
+ Other operations are processed as in hardware consistent mode.
+
+ Numeric differences comparing to hardware consistent mode:
+ - Device splits the input vector into chunks of buffer size
+   and saturates the partial sum after each chunk.
+   In relaxed mode sums are accumulated with 64-bit precision
+   and saturated to 32 bits only once, when stored to output.
+ - Results are bit-exact with consistent mode as long as no partial sum
+   exceeds 32-bit range, otherwise relaxed results are closer to
+   mathematically exact values and may differ from device.
+ - Number of reported saturations may differ for the same reasons.
+
+ @note
+ - Has no effect for requests processed in hardware mode.
+ - Reverted with Gna2RequestConfigEnableHardwareConsistency() called with present device version.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigDisableHardwareConsistency(
+    uint32_t requestConfigId);
+
 /**
  The list of processing acceleration modes.
 
@@ -131,7 +160,8 @@ GNA2_API enum Gna2Status Gna2RequestConfigEnableHardwareConsistency(
  Available modes are detected by GNA.
 
   Inference results (scores) in software modes are bit-exact with that produced
-  by the present or selected target hardware device.
+  by the present or selected target hardware device,
+  unless disabled with Gna2RequestConfigDisableHardwareConsistency().
  */
 enum Gna2AccelerationMode
 {
@@ -241,6 +271,29 @@ GNA2_API enum Gna2Status Gna2RequestConfigSetAccelerationMode(
 GNA2_API enum Gna2Status Gna2RequestConfigRelease(
     uint32_t requestConfigId);
 
+/**
+ Sets deadline of requests created with request config.
+
+ Pending requests are processed in earliest-deadline-first order,
+ requests without deadline are processed after all requests with deadline,
+ requests with equal deadline and requests of the same session
+ are processed in order of enqueueing.
+ Request not started before its deadline expires is dropped
+ and Gna2RequestWait returns Gna2StatusRequestDeadlineExceeded.
+
+ @note
+ - Deadline applies to requests enqueued after it is set.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param deadlineMicroseconds Time in microseconds from enqueueing the request
+    within which its processing has to start, 0 disables deadline (default).
+ @return Status of the operation.
+    @retval Gna2StatusIdentifierInvalid in case of invalid requestConfigId.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigSetDeadline(
+    uint32_t requestConfigId,
+    uint32_t deadlineMicroseconds);
+
 /**
  Creates and enqueues a request for asynchronous processing.
 
@@ -278,6 +331,138 @@ GNA2_API enum Gna2Status Gna2RequestWait(
     uint32_t requestId,
     uint32_t timeoutMilliseconds);
 
+/**
+ Cancels the request enqueued and not processed yet.
+
+ Request waiting in the queue is dropped immediately.
+ Request already being processed stops before its next operation
+ or before its next submission to the device.
+ Operations already submitted to the device are completed.
+
+ @note
+ - Canceled request still has to be retrieved with Gna2RequestWait,
+   that returns Gna2StatusRequestCanceled, unless processing was already completed.
+
+ @param requestId The request to cancel.
+ @return Status of the operation.
+    @retval Gna2StatusIdentifierInvalid in case request is not pending,
+        e.g. its processing is already completed.
+ */
+GNA2_API enum Gna2Status Gna2RequestCancel(
+    uint32_t requestId);
+
+/**
+ Creates streaming session for the request configuration.
+
+ Session holds state of single stream processed by consecutive requests,
+ i.e. last outputs of each recurrent operation, that are fed back
+ to the first output vectors of the next request.
+ State is kept in library memory and copied to the delay line preceding
+ the recurrent operation output buffer before each request of the session is processed,
+ then advanced to the last outputs of the request when processing succeeds.
+ Thus the caller does not need to rebind or shift output buffers between consecutive frames.
+ Multiple sessions, e.g. one per stream, can share the same request configuration.
+ Initially the state is zero.
+
+ @note
+ - Sessions are released by GNA during corresponding request configuration release.
+
+ @param requestConfigId The request configuration used by requests of the session.
+ @param [out] sessionId Session created by GNA.
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusNullArgumentNotAllowed On sessionId == nullptr.
+    @retval Gna2StatusIdentifierInvalid On invalid requestConfigId.
+ */
+GNA2_API enum Gna2Status Gna2SessionCreate(
+    uint32_t requestConfigId,
+    uint32_t * sessionId);
+
+/**
+ Creates and enqueues a request of the session for asynchronous processing.
+
+ Requests of the session advance its state in the order of enqueuing.
+ @see Gna2RequestEnqueue for details.
+
+ @param sessionId The session.
+ @param [out] requestId Identifier of the enqueued request.
+ @return Status of request preparation and queuing only.
+    To retrieve the results and processing status call Gna2RequestWait.
+ */
+GNA2_API enum Gna2Status Gna2SessionEnqueue(
+    uint32_t sessionId,
+    uint32_t * requestId);
+
+/**
+ Resets state of the session to zero, e.g. at the beginning of the new stream.
+
+ @note
+ - All requests of the session have to be retrieved by Gna2RequestWait.
+
+ @param sessionId The session.
+ @return Status of the operation.
+    @retval Gna2StatusWarningDeviceBusy When requests of the session are not retrieved.
+ */
+GNA2_API enum Gna2Status Gna2SessionReset(
+    uint32_t sessionId);
+
+/**
+ Gets size of the session state, in bytes.
+
+ @param sessionId The session.
+ @param [out] stateSize Size of the state of all recurrent operations.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2SessionGetStateSize(
+    uint32_t sessionId,
+    uint32_t * stateSize);
+
+/**
+ Saves checkpoint of the session state to the user buffer.
+
+ @note
+ - All requests of the session have to be retrieved by Gna2RequestWait.
+
+ @param sessionId The session.
+ @param [out] state Buffer for the state.
+ @param stateSize Size of the state buffer, as returned by Gna2SessionGetStateSize.
+ @return Status of the operation.
+    @retval Gna2StatusWarningDeviceBusy When requests of the session are not retrieved.
+    @retval Gna2StatusMemorySizeInvalid On invalid stateSize.
+ */
+GNA2_API enum Gna2Status Gna2SessionSaveState(
+    uint32_t sessionId,
+    void * state,
+    uint32_t stateSize);
+
+/**
+ Restores the session state from checkpoint saved by Gna2SessionSaveState.
+
+ @note
+ - All requests of the session have to be retrieved by Gna2RequestWait.
+
+ @param sessionId The session.
+ @param state Buffer with the state.
+ @param stateSize Size of the state buffer, as returned by Gna2SessionGetStateSize.
+ @return Status of the operation.
+    @retval Gna2StatusWarningDeviceBusy When requests of the session are not retrieved.
+    @retval Gna2StatusMemorySizeInvalid On invalid stateSize.
+ */
+GNA2_API enum Gna2Status Gna2SessionRestoreState(
+    uint32_t sessionId,
+    void const * state,
+    uint32_t stateSize);
+
+/**
+ Releases the session and its state.
+
+ @param sessionId The session.
+ @return Status of the operation.
+    @retval Gna2StatusWarningDeviceBusy When requests of the session are not retrieved.
+ */
+GNA2_API enum Gna2Status Gna2SessionRelease(
+    uint32_t sessionId);
+
 #endif // __GNA2_INFERENCE_API_H
 
 /**
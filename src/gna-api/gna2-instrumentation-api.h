@@ -25,6 +25,7 @@
 #define __GNA2_INSTRUMENTATION_API_H
 
 #include "gna2-common-api.h"
+#include "gna2-inference-api.h"
 
 #include <cstdint>
 
@@ -268,6 +269,146 @@ GNA2_API enum Gna2Status Gna2InstrumentationConfigSetMode(
     uint32_t instrumentationConfigId,
     enum Gna2InstrumentationMode instrumentationMode);
 
+/**
+ Processing stage of single operation reported by software operation instrumentation.
+ */
+enum Gna2InstrumentationStage
+{
+    /**
+     Whole operation, including all of its stages.
+     */
+    Gna2InstrumentationStageOperation = 0,
+
+    /**
+     Fully connected affine, also with bias grouping.
+     */
+    Gna2InstrumentationStageAffine = 1,
+
+    /**
+     Element wise affine.
+     */
+    Gna2InstrumentationStageElementWiseAffine = 2,
+
+    /**
+     Recurrent affine with feedback.
+     */
+    Gna2InstrumentationStageRecurrent = 3,
+
+    /**
+     1D or 2D convolution.
+     */
+    Gna2InstrumentationStageConvolution = 4,
+
+    /**
+     1D or 2D pooling.
+     */
+    Gna2InstrumentationStagePooling = 5,
+
+    /**
+     Piecewise-linear activation.
+     */
+    Gna2InstrumentationStageActivation = 6,
+
+    /**
+     Copy.
+     */
+    Gna2InstrumentationStageCopy = 7,
+
+    /**
+     Transposition (interleave or deinterleave).
+     */
+    Gna2InstrumentationStageTransposition = 8,
+
+    /**
+     Gaussian mixture scoring.
+     */
+    Gna2InstrumentationStageGmm = 9,
+};
+
+/**
+ Software processing statistics of single operation or its stage.
+
+ Number of multiply-accumulates and bytes are estimated from operand shapes,
+ i.e., do not reflect actual memory traffic, active lists or kernel specific padding.
+ */
+struct Gna2InstrumentationOperationResult
+{
+    /**
+     Index of model operation.
+     */
+    uint32_t OperationIndex;
+
+    /**
+     Processing stage, ::Gna2InstrumentationStageOperation for whole operation.
+     */
+    enum Gna2InstrumentationStage Stage;
+
+    /**
+     Software acceleration mode of kernel used.
+     */
+    enum Gna2AccelerationMode AccelerationMode;
+
+    /**
+     Number of saturations that occurred.
+     */
+    uint32_t NumberOfSaturations;
+
+    /**
+     Processing time in units of instrumentation configuration.
+     */
+    uint64_t Time;
+
+    /**
+     Number of multiply-accumulate operations.
+     */
+    uint64_t NumberOfMultiplyAccumulates;
+
+    /**
+     Number of input, output and parameter bytes touched.
+     */
+    uint64_t NumberOfBytes;
+};
+
+/**
+ Enables software operation instrumentation for given configuration.
+
+ For each operation processed in software, one result per each of its stages is reported
+ when the operation is processed stage by stage, followed by
+ one ::Gna2InstrumentationStageOperation result of the whole operation.
+ Results are collected to buffer preallocated when the request is enqueued
+ and saved to operationResults when the request is retrieved by Gna2RequestWait().
+ Results that do not fit operationResults are dropped.
+ Operations processed by hardware are not reported.
+
+ @note
+    Stage timing adds a small overhead, thus should not be used for production inference.
+
+ @see Gna2InstrumentationConfigGetNumberOfOperationResults()
+
+ @param instrumentationConfigId Instrumentation configuration to modify.
+ @param numberOfOperationResults Number of results operationResults can hold.
+ @param operationResults Buffer to save operation results to.
+    Disables software operation instrumentation when NULL.
+ @return Status of the operation.
+ @retval Gna2StatusDeviceParameterOutOfRange When numberOfOperationResults is 0 and operationResults is not NULL.
+ */
+GNA2_API enum Gna2Status Gna2InstrumentationConfigSetOperationResults(
+    uint32_t instrumentationConfigId,
+    uint32_t numberOfOperationResults,
+    struct Gna2InstrumentationOperationResult * operationResults);
+
+/**
+ Gets number of software operation results of last retrieved request.
+
+ @param instrumentationConfigId Identifier of instrumentation configuration.
+ @param [out] numberOfOperationResults Number of operation results collected,
+    including ones that did not fit buffer set with Gna2InstrumentationConfigSetOperationResults().
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2InstrumentationConfigGetNumberOfOperationResults(
+    uint32_t instrumentationConfigId,
+    uint32_t * numberOfOperationResults);
+
 /**
  Releases instrumentation config and its resources.
 
@@ -279,6 +420,200 @@ GNA2_API enum Gna2Status Gna2InstrumentationConfigSetMode(
 GNA2_API enum Gna2Status Gna2InstrumentationConfigRelease(
     uint32_t instrumentationConfigId);
 
+/**
+ Latency statistics of requests in microseconds.
+
+ Percentiles are estimated from histogram of latencies, with relative error below 6.25%.
+ Latencies are limited to UINT32_MAX microseconds.
+ All values are 0 when no latency was recorded.
+ */
+struct Gna2LatencyStatistics
+{
+    /**
+     Number of latencies recorded.
+     */
+    uint64_t NumberOfSamples;
+
+    /**
+     Sum of latencies recorded.
+     */
+    uint64_t Total;
+
+    /**
+     Minimum latency recorded.
+     */
+    uint64_t Minimum;
+
+    /**
+     Maximum latency recorded.
+     */
+    uint64_t Maximum;
+
+    /**
+     Median latency.
+     */
+    uint64_t Percentile50;
+
+    /**
+     Latency not exceeded by 90% of requests.
+     */
+    uint64_t Percentile90;
+
+    /**
+     Latency not exceeded by 99% of requests.
+     */
+    uint64_t Percentile99;
+
+    /**
+     Latency not exceeded by 99.9% of requests.
+     */
+    uint64_t Percentile999;
+};
+
+/**
+ Statistics of requests aggregated by the library.
+
+ Statistics are collected for each model and for each request configuration,
+ regardless of instrumentation configuration, and are kept until reset or release of model or configuration.
+ */
+struct Gna2RequestStatistics
+{
+    /**
+     Number of requests completed, including failed ones.
+     */
+    uint64_t NumberOfRequests;
+
+    /**
+     Number of requests completed with ::Gna2StatusWarningArithmeticSaturation.
+     */
+    uint64_t NumberOfSaturatedRequests;
+
+    /**
+     Number of requests of ::Gna2AccelerationModeHardwareWithSoftwareFallback mode processed in software.
+     */
+    uint64_t NumberOfFallbacks;
+
+    /**
+     Number of requests completed with error status, including canceled requests
+     and requests which deadline expired.
+     */
+    uint64_t NumberOfFailedRequests;
+
+    /**
+     Time from enqueuing request until its processing starts.
+     */
+    struct Gna2LatencyStatistics QueueWait;
+
+    /**
+     Time of request processing, for requests processed in batch time of the whole batch.
+     */
+    struct Gna2LatencyStatistics Execution;
+
+    /**
+     Time from submission of request to device driver until its completion,
+     summed for requests submitted in multiple parts. Requests not processed by device are not recorded.
+     */
+    struct Gna2LatencyStatistics Driver;
+};
+
+/**
+ Gets statistics of requests of all request configurations of given model.
+
+ Statistics are updated without locking, thus snapshot taken while requests are processed
+ may not include some values of requests being completed.
+
+ @param modelId Identifier of model.
+ @param [out] statistics Snapshot of statistics.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2ModelGetStatistics(
+    uint32_t modelId,
+    struct Gna2RequestStatistics * statistics);
+
+/**
+ Gets statistics of requests of given model and resets them.
+
+ Values recorded while statistics are reset are kept for next snapshot,
+ thus consecutive snapshots cover consecutive periods.
+
+ @param modelId Identifier of model.
+ @param [out] statistics Snapshot of statistics before reset, may be NULL.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2ModelResetStatistics(
+    uint32_t modelId,
+    struct Gna2RequestStatistics * statistics);
+
+/**
+ Gets statistics of requests of given request configuration.
+
+ @see Gna2ModelGetStatistics()
+
+ @param requestConfigId Identifier of request configuration.
+ @param [out] statistics Snapshot of statistics.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigGetStatistics(
+    uint32_t requestConfigId,
+    struct Gna2RequestStatistics * statistics);
+
+/**
+ Gets statistics of requests of given request configuration and resets them.
+
+ @see Gna2ModelResetStatistics()
+
+ @param requestConfigId Identifier of request configuration.
+ @param [out] statistics Snapshot of statistics before reset, may be NULL.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigResetStatistics(
+    uint32_t requestConfigId,
+    struct Gna2RequestStatistics * statistics);
+
+/**
+ Starts recording of request processing trace.
+
+ Each library thread records events to its own buffer: request enqueuing and dequeuing,
+ beginning and end of each operation processed in software with acceleration mode of kernel used,
+ submission to device and its completion, and routing of request to software
+ by ::Gna2AccelerationModeHardwareWithSoftwareFallback mode.
+ Events recorded before are dropped.
+ When a thread records more than 16384 events, its oldest events are overwritten.
+
+ @note
+    Recording is disabled by default. While disabled, tracing adds no measurable overhead.
+    When the library is built without tracing support, ::Gna2StatusNotImplemented is returned.
+
+ @see Gna2InstrumentationTraceExport()
+
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2InstrumentationTraceStart();
+
+/**
+ Stops recording of request processing trace.
+
+ Recorded events are kept until next Gna2InstrumentationTraceStart().
+
+ @note
+    When the library is built without tracing support, ::Gna2StatusNotImplemented is returned.
+
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2InstrumentationTraceStop();
+
+/**
+ Saves events recorded since Gna2InstrumentationTraceStart() to file.
+
+ File is written in Chrome trace event JSON format, that can be viewed with Perfetto UI or chrome://tracing.
+ May be called while recording is in progress.
+
+ @param traceFile Path of file to write.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2InstrumentationTraceExport(
+    char const * traceFile);
+
 #endif // __GNA2_INSTRUMENTATION_API_H
 
 /**
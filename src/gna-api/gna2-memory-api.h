@@ -78,27 +78,109 @@ GNA2_API enum Gna2Status Gna2MemoryAllocForDevice(
     uint32_t * sizeGranted,
     void ** memoryAddress);
 
+/**
+ Memory allocation flags.
+
+ @see Gna2MemoryAllocWithFlags()
+ */
+enum Gna2MemoryAllocFlag
+{
+    /**
+     Default allocation, memory buffer is zero-filled.
+     */
+    Gna2MemoryAllocFlagNone = 0,
+
+    /**
+     Memory buffer is not zero-filled, its contents are undefined until written.
+
+     Use for buffers that will be fully overwritten by the caller,
+     e.g., weights loaded from file or output buffers.
+     @note Memory allocated by GNA driver is always zeroed by the operating system.
+     */
+    Gna2MemoryAllocFlagNoZeroFill = 0x1,
+};
+
+/**
+ Allocates memory buffer, that can be used with GNA device - device aware, with allocation flags.
+
+ see comment above
+
+ @param deviceIndex assures device is open prior allocation.
+ @param sizeRequested Buffer size desired by the caller. Must be within range <1, 2^28>.
+ @param flags Bitwise combination of ::Gna2MemoryAllocFlag values.
+ @param [out] sizeGranted Buffer size granted by GNA,
+                          can be more then requested due to HW constraints.
+ @param [out] memoryAddress Address of memory buffer
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusMemorySizeInvalid If sizeRequested is invalid.
+    @retval Gna2StatusNotImplemented If flags are not supported.
+ */
+GNA2_API enum Gna2Status Gna2MemoryAllocWithFlags(
+    uint32_t deviceIndex,
+    uint32_t sizeRequested,
+    uint32_t flags,
+    uint32_t * sizeGranted,
+    void ** memoryAddress);
+
 /**
  Releases memory buffer.
 
+ For regions registered with Gna2MemoryRegisterReadOnly() only unregisters the region.
+
  @param memory Memory buffer to be freed.
  @return Status of the operation.
  */
 GNA2_API enum Gna2Status Gna2MemoryFree(
     void * memory);
 
+/**
+ Registers read-only memory region provided by the caller, that can be used for model operands.
+
+ Intended for memory-mapped (e.g., mmap() with PROT_READ and MAP_SHARED) model files,
+ so weights, biases and activation segments can be paged in on demand
+ and shared among processes via page cache without copying them into memory
+ obtained with Gna2MemoryAlloc().
+ Registered region is tagged with ::Gna2MemoryTagReadOnlyMapped.
+ @note
+ - Region is not copied and is not released by GNA library.
+   Caller is responsible for keeping it valid until it is unregistered with Gna2MemoryFree()
+   and for unmapping it afterwards.
+ - Region is not mapped to GNA HW, thus operations using it are scored in software,
+   also in ::Gna2AccelerationModeAuto and ::Gna2AccelerationModeHardwareWithSoftwareFallback,
+   while ::Gna2AccelerationModeHardware is not supported for such models.
+ - Region must not be used for operands written by GNA (e.g., outputs, scratch or state),
+   such outputs are rejected by Gna2ModelCreate() and Gna2RequestConfigSetOperandBuffer()
+   with Gna2StatusMemoryBufferInvalid, and region cannot be tagged with Gna2MemorySetTag().
+
+ @param memory Starting address of the region. Must be aligned to 64 bytes.
+ @param size Size of the region in bytes. Must be within range <1, 2^28>.
+ @return Status of the operation.
+    @retval Gna2StatusSuccess On success.
+    @retval Gna2StatusNullArgumentNotAllowed If memory is NULL.
+    @retval Gna2StatusMemoryAlignmentInvalid If memory is not aligned.
+    @retval Gna2StatusMemorySizeInvalid If size is invalid.
+    @retval Gna2StatusMemoryBufferInvalid If region overlaps already allocated or registered memory.
+ */
+GNA2_API enum Gna2Status Gna2MemoryRegisterReadOnly(
+    void * memory,
+    uint32_t size);
+
 /**
  Adds special designation for the memory buffer.
  The buffer can be one of the previously obtained with Gna2MemoryAlloc.
  @note
  - This is for embedded model export only.
  - In case of some doubts, probably should not use this function.
+ - Software modes may leave outputs of copy and transposition operations unwritten,
+   when they are in memory tagged with ::Gna2MemoryTagScratch and are read only by subsequent operations.
 
  @param memory Starting address of the memory buffer to tag.
  @param tag Special purpose tag. Use zero to reset to default. @see ::Gna2MemoryTag
  @return Status of the operation.
     @retval Gna2StatusSuccess On success.
-    @retval Gna2StatusMemoryBufferInvalid If memory address is invalid.
+    @retval Gna2StatusMemoryBufferInvalid If memory address is invalid
+        or memory was registered with Gna2MemoryRegisterReadOnly().
  */
 GNA2_API enum Gna2Status Gna2MemorySetTag(
     void * memory,
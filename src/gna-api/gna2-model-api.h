@@ -149,6 +149,8 @@ enum Gna2OperationType
                     - W is a width of result tensor
                     - C is a depth of result tensor, same as the number of filters (filter N dimension)
                 - Layout: When set to "GNA1" the GNA 1.0 1D convolution (aka legacy CNN1D) will be enforced.
+                    @note Legacy CNN1D supports ::Gna2DataTypeInt8 inputs and filters for GNA 3.0 and later only,
+                    processed in software.
         + 2: filters [required]:
             Specifies filters (kernels) tensor. Filters are stored one after the other.
             @note: For 2D ::Gna2OperationTypeConvolution operation each filter must start
@@ -265,6 +267,12 @@ enum Gna2OperationType
                      (must be not greater than number of vectors of input and output)
                  - W is a number of elements to copy in each vector
                      (must be not greater than size of vectors of input and output)
+
+    @note When processed in software and whole vectors are copied to the outputs
+          that are read only by subsequent operations of the same model,
+          the copy may be skipped and those operations read the inputs directly.
+          Contents of such outputs are then undefined after the request.
+          This never happens when any operand buffer is set for the request configuration.
     */
     Gna2OperationTypeCopy = 2,
 
@@ -523,6 +531,10 @@ enum Gna2OperationType
                     - W is a number of elements of output vector, same as inputs [H],
 
     Parameters: none.
+
+    @note When processed in software, transposition which outputs are read only
+          by subsequent transposition restoring the original layout may be skipped,
+          see ::Gna2OperationTypeCopy note.
     */
     Gna2OperationTypeTransposition = 7,
 };
@@ -664,7 +676,11 @@ enum Gna2DataType
 
     /**
      4 bit Signed Integer.
-     Currently not supported.
+     Supported only as weights of fully connected, element wise
+     and grouped bias affine operations and as filters of 2D convolution
+     of models created for software device.
+     Pairs of elements are packed in single byte, lower nibble first,
+     each 2D convolution filter is packed separately and padded to 16 bytes.
      */
     Gna2DataTypeInt4 = 2,
 
@@ -690,7 +706,11 @@ enum Gna2DataType
 
     /**
      4 bit Unsigned Integer.
-     Currently not supported.
+     Supported only as weights of fully connected, element wise
+     and grouped bias affine operations and as filters of 2D convolution
+     of models created for software device.
+     Pairs of elements are packed in single byte, lower nibble first,
+     each 2D convolution filter is packed separately and padded to 16 bytes.
      */
     Gna2DataTypeUint4 = 7,
 
@@ -1338,6 +1358,95 @@ struct Gna2ModelError
     int64_t Value;
 };
 
+/**
+ Target processing operations of model partition.
+ */
+enum Gna2PartitionTarget
+{
+    /**
+     Operations not supported by the device, processed in software.
+     */
+    Gna2PartitionTargetSoftware = 0,
+
+    /**
+     Operations processed by the device in single submission.
+     */
+    Gna2PartitionTargetHardware = 1,
+
+    /**
+     Operations supported by the device, processed in software with the device consistency,
+     as estimated to be cheaper than separate device submission.
+     */
+    Gna2PartitionTargetSoftwareForHardware = 2,
+};
+
+/**
+ Consecutive operations of model processed by the same target.
+
+ Models are partitioned when created, for processing in ::Gna2AccelerationModeAuto
+ and ::Gna2AccelerationModeHardwareWithSoftwareFallback modes on the device.
+ Partitioning is based on operations supported by the device
+ and on estimated costs of processing, device submissions and data transfers,
+ hence hardware operations surrounded by software operations
+ may be processed in software to avoid additional submissions.
+
+ @see Gna2DeviceSetPartitionCosts()
+ */
+struct Gna2ModelPartition
+{
+    /**
+     Index of the first operation of partition.
+     */
+    uint32_t FirstOperationIndex;
+
+    /**
+     Number of operations of partition.
+     */
+    uint32_t NumberOfOperations;
+
+    /**
+     Target processing partition operations.
+     */
+    enum Gna2PartitionTarget Target;
+
+    /**
+     Estimated processing time of single request in nanoseconds,
+     including device submission and data transfers for ::Gna2PartitionTargetHardware.
+     */
+    uint64_t EstimatedCost;
+};
+
+/**
+ Gets number of partitions of the model.
+
+ Model processed without the device, e.g. when the device is not present, has single software partition.
+
+ @param modelId The model identifier.
+ @param [out] numberOfPartitions Number of model partitions.
+ @return Status of the operation.
+    @retval Gna2StatusIdentifierInvalid in case of invalid modelId.
+    @retval Gna2StatusNullArgumentNotAllowed in case of numberOfPartitions == NULL.
+ */
+GNA2_API enum Gna2Status Gna2ModelGetNumberOfPartitions(
+    uint32_t modelId,
+    uint32_t * numberOfPartitions);
+
+/**
+ Gets partition of the model.
+
+ @param modelId The model identifier.
+ @param partitionIndex Index of partition [0, Gna2ModelGetNumberOfPartitions() - 1],
+    partitions are ordered by operation indices.
+ @param [out] partition Description of the partition.
+ @return Status of the operation.
+    @retval Gna2StatusIdentifierInvalid in case of invalid modelId or partitionIndex.
+    @retval Gna2StatusNullArgumentNotAllowed in case of partition == NULL.
+ */
+GNA2_API enum Gna2Status Gna2ModelGetPartition(
+    uint32_t modelId,
+    uint32_t partitionIndex,
+    struct Gna2ModelPartition * partition);
+
 /**************************************************************************//**
  @}
 
@@ -1382,6 +1491,8 @@ GNA2_API enum Gna2Status Gna2ModelOperationInit(
 
  Useful for calculating the sizes of memory buffers.
 
+ @note 4 bit types report size of 1 byte, although two elements are packed in single byte.
+
  @param type The type of the data.
  @return Size in bytes of given data type.
  @retval GNA2_NOT_SUPPORTED If type is invalid.
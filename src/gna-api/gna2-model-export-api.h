@@ -164,6 +164,12 @@ enum Gna2MemoryTag
     Gna2MemoryTagExternalBufferOutput = 0x2000,
     Gna2MemoryTagScratch = 0x4000,
     Gna2MemoryTagState = 0x8000,
+
+    /**
+     Read-only region registered with Gna2MemoryRegisterReadOnly(), e.g., memory-mapped model file.
+     @note Treated as read-only memory during export.
+    */
+    Gna2MemoryTagReadOnlyMapped = 0x10000,
 };
 
 /**
@@ -0,0 +1,220 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+using namespace GnaBenchmark;
+
+using Clock = std::chrono::steady_clock;
+
+// prints "-" for not available (zero) values
+static void printColumn(double value, int width, int precision)
+{
+    if (value > 0)
+    {
+        printf(" %*.*f", width, precision, value);
+    }
+    else
+    {
+        printf(" %*s", width, "-");
+    }
+}
+
+Runner::Runner(Options optionsIn) :
+    options{ std::move(optionsIn) }
+{
+}
+
+bool Runner::IsEnabled(const std::string& name) const
+{
+    return options.Filter.empty() || name.find(options.Filter) != std::string::npos;
+}
+
+Measurement Runner::Measure(const std::string& name, const std::function<void()>& body,
+    const Metrics& metrics, const std::function<void()>& setup)
+{
+    Measurement measurement{};
+    if (!IsEnabled(name))
+    {
+        return measurement;
+    }
+
+    auto const minTime = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::milliseconds{ options.MinTimeMilliseconds });
+
+    auto runOnce = [&]()
+    {
+        if (setup)
+        {
+            setup();
+        }
+        auto const start = Clock::now();
+        body();
+        return Clock::now() - start;
+    };
+
+    try
+    {
+        // warm-up, also estimates number of iterations per repetition
+        auto const warmUp = std::max(runOnce(), Clock::duration{ 1 });
+        auto const iterations = static_cast<uint64_t>(std::max(Clock::duration::rep{ 1 },
+            minTime.count() / warmUp.count()));
+
+        std::vector<double> samples;
+        for (uint32_t r = 0; r < std::max(options.Repetitions, 1u); r++)
+        {
+            auto elapsed = Clock::duration::zero();
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                elapsed += runOnce();
+            }
+            auto const ns = std::chrono::duration<double, std::nano>(elapsed).count();
+            samples.push_back(ns / static_cast<double>(iterations));
+        }
+        std::sort(samples.begin(), samples.end());
+
+        measurement.Iterations = iterations * samples.size();
+        measurement.NanosecondsPerIteration = samples[samples.size() / 2];
+        measurement.MinNanosecondsPerIteration = samples.front();
+    }
+    catch (const std::exception& e)
+    {
+        ReportFailure(name, e.what());
+        return Measurement{};
+    }
+
+    print(name, measurement, metrics);
+    return measurement;
+}
+
+void Runner::Report(const std::string& name, const Measurement& measurement, const Metrics& metrics) const
+{
+    if (IsEnabled(name))
+    {
+        print(name, measurement, metrics);
+    }
+}
+
+void Runner::PrintHeader() const
+{
+    if (options.Csv)
+    {
+        printf("name,iterations,ns_per_iteration,min_ns_per_iteration,ns_per_frame,gops,gb_per_s,scaling_efficiency,heap_kb\n");
+    }
+    else
+    {
+        printf("%-64s %10s %14s %14s %12s %9s %9s %8s %10s\n",
+            "benchmark", "iterations", "ns/iter", "min ns/iter", "ns/frame", "GOPS", "GB/s", "scaling", "heap KB");
+    }
+}
+
+void Runner::print(const std::string& name, const Measurement& measurement, const Metrics& metrics) const
+{
+    auto const ns = measurement.NanosecondsPerIteration;
+    auto const nsPerFrame = metrics.FramesPerIteration > 0
+        ? ns / static_cast<double>(metrics.FramesPerIteration) : 0.0;
+    // operations per nanosecond equals giga operations per second
+    auto const gops = metrics.OperationsPerIteration > 0
+        ? static_cast<double>(metrics.OperationsPerIteration) / ns : 0.0;
+    auto const gbps = metrics.BytesPerIteration > 0
+        ? static_cast<double>(metrics.BytesPerIteration) / ns : 0.0;
+    auto const scaling = metrics.ScalingThreadCount > 0 && metrics.ScalingBaseline > 0
+        ? metrics.ScalingBaseline / (ns * static_cast<double>(metrics.ScalingThreadCount)) : 0.0;
+    auto const heapKb = static_cast<double>(metrics.RetainedBytes) / 1024.0;
+
+    if (options.Csv)
+    {
+        printf("%s,%llu,%.1f,%.1f,%.1f,%.3f,%.3f,%.3f,%.1f\n", name.c_str(),
+            static_cast<unsigned long long>(measurement.Iterations),
+            ns, measurement.MinNanosecondsPerIteration, nsPerFrame, gops, gbps, scaling, heapKb);
+    }
+    else
+    {
+        printf("%-64s %10llu %14.1f %14.1f", name.c_str(),
+            static_cast<unsigned long long>(measurement.Iterations),
+            ns, measurement.MinNanosecondsPerIteration);
+        printColumn(nsPerFrame, 12, 1);
+        printColumn(gops, 9, 3);
+        printColumn(gbps, 9, 3);
+        printColumn(scaling, 8, 2);
+        printColumn(heapKb, 10, 1);
+        printf("\n");
+    }
+    fflush(stdout);
+}
+
+uint32_t Runner::GetFailureCount() const
+{
+    return failureCount;
+}
+
+void Runner::ReportFailure(const std::string& name, const std::string& reason)
+{
+    failureCount++;
+    fprintf(stderr, "%s: FAILED: %s\n", name.c_str(), reason.c_str());
+}
+
+void Runner::ReportSkipped(const std::string& name, const std::string& reason) const
+{
+    if (!IsEnabled(name))
+    {
+        return;
+    }
+    if (options.Csv)
+    {
+        printf("%s,0,0,0,0,0,0,0,0\n", name.c_str());
+    }
+    else
+    {
+        printf("%-64s skipped: %s\n", name.c_str(), reason.c_str());
+    }
+    fflush(stdout);
+}
+
+std::vector<SuiteEntry>& GnaBenchmark::GetSuites()
+{
+    static std::vector<SuiteEntry> suites;
+    return suites;
+}
+
+SuiteRegistration::SuiteRegistration(const char * name, Suite suite)
+{
+    GetSuites().push_back({ name, std::move(suite) });
+}
+
+std::string GnaBenchmark::GetStatusMessage(Gna2Status status)
+{
+    auto const size = Gna2StatusGetMaxMessageLength();
+    auto message = std::unique_ptr<char[]>(new char[size]());
+    Gna2StatusGetMessage(status, message.get(), size);
+    return message.get();
+}
+
+void GnaBenchmark::Check(Gna2Status status, const char * what)
+{
+    if (!Gna2StatusIsSuccessful(status))
+    {
+        throw std::runtime_error(std::string{ what } + ": " + GetStatusMessage(status));
+    }
+}
+
+uint64_t GnaBenchmark::GetHeapInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
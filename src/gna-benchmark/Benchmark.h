@@ -0,0 +1,125 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "gna2-api.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace GnaBenchmark
+{
+
+/**
+ Optional per iteration work description used to derive throughput metrics.
+ Zeroed fields are not reported.
+ */
+struct Metrics
+{
+    // Number of frames (input vectors) processed by single iteration, reported as ns/frame
+    uint64_t FramesPerIteration = 0;
+
+    // Number of arithmetic operations (2 per MAC) executed by single iteration, reported as GOPS
+    uint64_t OperationsPerIteration = 0;
+
+    // Number of bytes written or copied by single iteration, reported as GB/s
+    uint64_t BytesPerIteration = 0;
+
+    // Time of single threaded reference [ns/iteration] and thread count, reported as scaling efficiency
+    double ScalingBaseline = 0;
+    uint32_t ScalingThreadCount = 0;
+
+    // Heap bytes retained by result of single iteration, e.g., created model, reported as KB
+    uint64_t RetainedBytes = 0;
+};
+
+struct Measurement
+{
+    uint64_t Iterations = 0;
+
+    // Median of repetitions
+    double NanosecondsPerIteration = 0;
+
+    // Best repetition
+    double MinNanosecondsPerIteration = 0;
+};
+
+struct Options
+{
+    // Only benchmarks which name contains filter are executed
+    std::string Filter;
+
+    // Minimal duration of single repetition
+    uint32_t MinTimeMilliseconds = 100;
+
+    uint32_t Repetitions = 5;
+
+    bool Csv = false;
+};
+
+class Runner
+{
+public:
+    explicit Runner(Options optionsIn);
+
+    bool IsEnabled(const std::string& name) const;
+
+    /**
+     Measures body execution time.
+     Body is executed in batches until MinTimeMilliseconds elapse,
+     that is repeated Repetitions times.
+     If setup is provided it is executed before every body execution and is not measured.
+     */
+    Measurement Measure(const std::string& name, const std::function<void()>& body,
+        const Metrics& metrics = {}, const std::function<void()>& setup = nullptr);
+
+    // Reports measurement taken by benchmark itself, e.g., from GNA instrumentation
+    void Report(const std::string& name, const Measurement& measurement, const Metrics& metrics = {}) const;
+
+    void PrintHeader() const;
+
+    uint32_t GetFailureCount() const;
+
+    void ReportFailure(const std::string& name, const std::string& reason);
+
+    // Notes enabled benchmark that cannot be executed in present environment, not a failure
+    void ReportSkipped(const std::string& name, const std::string& reason) const;
+
+private:
+    void print(const std::string& name, const Measurement& measurement, const Metrics& metrics) const;
+
+    Options options;
+
+    uint32_t failureCount = 0;
+};
+
+using Suite = std::function<void(Runner&)>;
+
+struct SuiteEntry
+{
+    const char * Name;
+    Suite Run;
+};
+
+std::vector<SuiteEntry>& GetSuites();
+
+// Registers suite at static initialization time
+struct SuiteRegistration
+{
+    SuiteRegistration(const char * name, Suite suite);
+};
+
+std::string GetStatusMessage(Gna2Status status);
+
+// Bytes of heap in use by the process, 0 when not available on present platform
+uint64_t GetHeapInUse();
+
+// Throws std::runtime_error with status message when status is not successful
+void Check(Gna2Status status, const char * what);
+
+}
@@ -0,0 +1,579 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+/**
+ Differential bit-exactness check of acceleration modes.
+ Random valid operations are created through Gna2ModelCreate and executed
+ with every supported acceleration mode. Outputs of all operations and request
+ saturation status have to match Gna2AccelerationModeGeneric bit for bit.
+ Failing case is reproduced with: --filter <family> --seed <seed> --iterations 1
+ */
+
+#include "Benchmark.h"
+#include "SyntheticModel.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace GnaBenchmark;
+
+namespace
+{
+
+class Random
+{
+public:
+    explicit Random(uint32_t seed) :
+        generator{ seed }
+    {
+    }
+
+    uint32_t Range(uint32_t min, uint32_t max)
+    {
+        return std::uniform_int_distribution<uint32_t>{ min, max }(generator);
+    }
+
+    // multiple of step from [min, max], min and max have to be multiples of step
+    uint32_t Multiple(uint32_t min, uint32_t max, uint32_t step)
+    {
+        return Range(min / step, max / step) * step;
+    }
+
+    // true with probability 1/n
+    bool OneIn(uint32_t n)
+    {
+        return 0 == Range(0, n - 1);
+    }
+
+    template<typename T>
+    T Pick(std::initializer_list<T> values)
+    {
+        return *(values.begin() + Range(0, static_cast<uint32_t>(values.size() - 1)));
+    }
+
+private:
+    std::mt19937 generator;
+};
+
+struct RandomCase
+{
+    std::string Description;
+
+    // active list of the first operation, disabled when 0
+    uint32_t ActiveListCount = 0;
+    const uint32_t * ActiveListIndices = nullptr;
+};
+
+struct OperationFamily
+{
+    const char * Name;
+    std::function<RandomCase(SyntheticModel&, Random&)> Build;
+};
+
+constexpr uint32_t MaxGrouping = 8;
+
+constexpr uint32_t MaxLargeBatchGrouping = 1024;
+
+const char * typeName(Gna2DataType type)
+{
+    switch (type)
+    {
+    case Gna2DataTypeInt8:
+        return "Int8";
+    case Gna2DataTypeInt16:
+        return "Int16";
+    case Gna2DataTypeInt32:
+        return "Int32";
+    case Gna2DataTypeUint8:
+        return "Uint8";
+    case Gna2DataTypeUint16:
+        return "Uint16";
+    case Gna2DataTypeUint32:
+        return "Uint32";
+    default:
+        return "other";
+    }
+}
+
+std::string describe(const Gna2Tensor& tensor)
+{
+    std::string description;
+    for (uint32_t i = 0; i < tensor.Shape.NumberOfDimensions; i++)
+    {
+        description += (0 == i ? "" : "x") + std::to_string(tensor.Shape.Dimensions[i]);
+    }
+    return description + " " + typeName(tensor.Type);
+}
+
+// inputs of affine and auxiliary operations are multiples of 16B
+uint32_t randomElementCount(Random& random, Gna2DataType type, uint32_t max)
+{
+    auto const multiple = 16 / Gna2DataTypeGetSize(type);
+    return random.Multiple(multiple, max, multiple);
+}
+
+// 0 disables activation
+uint32_t randomSegmentCount(Random& random)
+{
+    return random.OneIn(3) ? 0 : random.Range(2, 128);
+}
+
+void addActiveList(SyntheticModel& model, Random& random, RandomCase& randomCase, uint32_t range)
+{
+    if (random.OneIn(3))
+    {
+        randomCase.ActiveListCount = random.Range(1, range);
+        randomCase.ActiveListIndices = model.AddActiveList(randomCase.ActiveListCount, range);
+        randomCase.Description += ", active list " + std::to_string(randomCase.ActiveListCount);
+    }
+}
+
+RandomCase buildAffine(SyntheticModel& model, Random& random)
+{
+    auto const inputType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto & inputs = model.AddTensor(Gna2ShapeInit2D(randomElementCount(random, inputType, 1024),
+        random.Range(1, MaxGrouping)), inputType);
+    auto const outputCount = random.Range(1, 512);
+    auto const weightType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto const segmentCount = randomSegmentCount(random);
+    model.AddFullyConnected(inputs, outputCount, weightType, segmentCount);
+
+    RandomCase randomCase{ "inputs " + describe(inputs) + ", outputs " + std::to_string(outputCount)
+        + ", weights " + typeName(weightType) + ", pwl " + std::to_string(segmentCount) };
+    addActiveList(model, random, randomCase, outputCount);
+    return randomCase;
+}
+
+// software only grouping above hardware limit, without active list
+RandomCase buildAffineLargeBatch(SyntheticModel& model, Random& random)
+{
+    auto const inputType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto & inputs = model.AddTensor(Gna2ShapeInit2D(randomElementCount(random, inputType, 1024),
+        random.Range(MaxGrouping + 1, MaxLargeBatchGrouping)), inputType);
+    auto const outputCount = random.Range(1, 256);
+    auto const weightType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto const segmentCount = randomSegmentCount(random);
+    model.AddFullyConnected(inputs, outputCount, weightType, segmentCount);
+
+    return { "inputs " + describe(inputs) + ", outputs " + std::to_string(outputCount)
+        + ", weights " + typeName(weightType) + ", pwl " + std::to_string(segmentCount) };
+}
+
+RandomCase buildAffineBiasGrouping(SyntheticModel& model, Random& random)
+{
+    auto const inputType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto & inputs = model.AddTensor(Gna2ShapeInit2D(randomElementCount(random, inputType, 1024),
+        random.Range(1, MaxGrouping)), inputType);
+    auto const outputCount = random.Range(1, 512);
+    auto const weightType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto const segmentCount = randomSegmentCount(random);
+    auto const biasVectorCount = random.Range(1, MaxGrouping);
+    model.AddFullyConnectedBiasGrouping(inputs, outputCount, weightType, segmentCount, biasVectorCount);
+
+    return { "inputs " + describe(inputs) + ", outputs " + std::to_string(outputCount)
+        + ", weights " + typeName(weightType) + ", pwl " + std::to_string(segmentCount)
+        + ", bias vector " + std::to_string(biasVectorCount - 1) };
+}
+
+RandomCase buildDiagonal(SyntheticModel& model, Random& random)
+{
+    auto const inputType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto & inputs = model.AddTensor(Gna2ShapeInit2D(randomElementCount(random, inputType, 4096),
+        random.Range(1, MaxGrouping)), inputType);
+    auto const weightType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto const segmentCount = randomSegmentCount(random);
+    model.AddElementWiseAffine(inputs, weightType, segmentCount);
+
+    return { "inputs " + describe(inputs) + ", weights " + typeName(weightType)
+        + ", pwl " + std::to_string(segmentCount) };
+}
+
+RandomCase buildRecurrent(SyntheticModel& model, Random& random)
+{
+    auto const vectorCount = random.Range(1, MaxGrouping);
+    auto const inputType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto & inputs = model.AddTensor(Gna2ShapeInit2D(vectorCount, randomElementCount(random, inputType, 512)),
+        inputType);
+    // outputs preceded by feedback buffer have to stay 64B aligned
+    auto const outputMultiple = 64 / Gna2DataTypeGetSize(inputType);
+    auto const outputCount = random.Multiple(outputMultiple, 256, outputMultiple);
+    auto const weightType = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto const segmentCount = random.Range(2, 128);
+    auto const delay = random.Range(1, vectorCount);
+    model.AddRecurrent(inputs, outputCount, weightType, segmentCount, delay);
+
+    return { "inputs " + describe(inputs) + ", outputs " + std::to_string(outputCount)
+        + ", weights " + typeName(weightType) + ", pwl " + std::to_string(segmentCount)
+        + ", delay " + std::to_string(delay) };
+}
+
+RandomCase buildCopy(SyntheticModel& model, Random& random)
+{
+    auto const type = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto & inputs = model.AddTensor(Gna2ShapeInit2D(random.Range(1, MaxGrouping),
+        randomElementCount(random, type, 4096)), type);
+    model.AddCopy(inputs);
+    return { "inputs " + describe(inputs) };
+}
+
+RandomCase buildTransposition(SyntheticModel& model, Random& random)
+{
+    auto const type = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto const vectorCount = random.Range(1, MaxGrouping);
+    auto const elementCount = randomElementCount(random, type, 1024);
+    auto const isInterleave = random.OneIn(2);
+    auto & inputs = model.AddTensor(isInterleave
+            ? Gna2ShapeInit2D(vectorCount, elementCount)
+            : Gna2ShapeInit2D(elementCount, vectorCount),
+        type);
+    model.AddTransposition(inputs);
+    return { "inputs " + describe(inputs) };
+}
+
+PoolingConfig randomPooling(Random& random, uint32_t maxWindow, bool is2D)
+{
+    PoolingConfig pooling;
+    if (random.OneIn(2))
+    {
+        pooling.Mode = random.Pick({ Gna2PoolingModeMax, Gna2PoolingModeSum });
+        pooling.WindowWidth = random.Range(1, maxWindow);
+        pooling.StrideWidth = random.Range(1, pooling.WindowWidth);
+        // 2D pooling windows are square
+        if (is2D)
+        {
+            pooling.WindowHeight = pooling.WindowWidth;
+            pooling.StrideHeight = random.Range(1, pooling.WindowHeight);
+        }
+    }
+    return pooling;
+}
+
+std::string describe(const PoolingConfig& pooling)
+{
+    if (Gna2PoolingModeDisabled == pooling.Mode)
+    {
+        return "none";
+    }
+    return std::string{ Gna2PoolingModeMax == pooling.Mode ? "max " : "sum " }
+        + std::to_string(pooling.WindowHeight) + "x" + std::to_string(pooling.WindowWidth) + "/"
+        + std::to_string(pooling.StrideHeight) + "x" + std::to_string(pooling.StrideWidth);
+}
+
+// GNA 1.0 convolution, 1B inputs are supported in software only with 1B or 2B filters
+RandomCase buildConvolution1D(SyntheticModel& model, Random& random)
+{
+    auto const type = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto const filterType = Gna2DataTypeInt8 == type ? random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 }) : type;
+    auto const filterSize = random.Multiple(8, 96, 8);
+    auto const filterCount = random.Multiple(4, 64, 4);
+    auto const stride = random.Range(1, filterSize);
+    // inputs are multiples of 16B
+    auto const multiple = 16 / Gna2DataTypeGetSize(type);
+    auto & inputs = model.AddTensor(Gna2ShapeInit2D(1, random.Multiple(filterSize + 8, 2048, multiple)), type);
+    auto const segmentCount = randomSegmentCount(random);
+    auto const pooling = segmentCount > 0 ? randomPooling(random, 6, false) : PoolingConfig{};
+    model.AddConvolution1D(inputs, filterCount, filterSize, stride, filterType, segmentCount, pooling);
+
+    return { "inputs " + describe(inputs) + ", filters " + std::to_string(filterCount)
+        + "x" + std::to_string(filterSize) + " " + typeName(filterType) + ", stride " + std::to_string(stride)
+        + ", pwl " + std::to_string(segmentCount) + ", pooling " + describe(pooling) };
+}
+
+// GNA 3.0 convolution requires filters of inputs type and activated outputs of inputs type
+RandomCase buildConvolution2D(SyntheticModel& model, Random& random)
+{
+    auto const type = random.Pick({ Gna2DataTypeInt8, Gna2DataTypeInt16 });
+    auto & inputs = model.AddTensor(Gna2ShapeInit4D(1, random.Range(16, 32), random.Range(16, 32),
+        randomElementCount(random, type, 32)), type);
+    auto const filterCount = random.Multiple(8, 32, 8);
+    auto const filterHeight = random.Range(1, 5);
+    auto const filterWidth = random.Range(1, 5);
+    auto const segmentCount = randomSegmentCount(random);
+    auto const outputType = segmentCount > 0 ? type : Gna2DataTypeInt32;
+    auto const pooling = randomPooling(random, 3, true);
+    model.AddConvolution2D(inputs, filterCount, filterHeight, filterWidth, type,
+        segmentCount, outputType, pooling);
+
+    return { "inputs " + describe(inputs) + ", filters " + std::to_string(filterCount)
+        + "x" + std::to_string(filterHeight) + "x" + std::to_string(filterWidth)
+        + ", pwl " + std::to_string(segmentCount) + ", outputs " + typeName(outputType)
+        + ", pooling " + describe(pooling) };
+}
+
+RandomCase buildGmm(SyntheticModel& model, Random& random)
+{
+    auto & inputs = model.AddGmmInputs(random.Range(1, MaxGrouping), random.Multiple(24, 96, 8));
+    auto const stateCount = random.Range(1, 512);
+    auto const mixtureCount = random.Range(1, 16);
+    auto const covarianceType = random.Pick({ Gna2DataTypeUint8, Gna2DataTypeUint16 });
+    model.AddGmm(inputs, stateCount, mixtureCount, covarianceType);
+
+    RandomCase randomCase{ "inputs " + describe(inputs) + ", states " + std::to_string(stateCount)
+        + ", mixtures " + std::to_string(mixtureCount) + ", covariances " + typeName(covarianceType) };
+    addActiveList(model, random, randomCase, stateCount);
+    return randomCase;
+}
+
+const OperationFamily Families[] =
+{
+    { "affine", buildAffine },
+    { "affine-large-batch", buildAffineLargeBatch },
+    { "affine-bias-grouping", buildAffineBiasGrouping },
+    { "diagonal", buildDiagonal },
+    { "recurrent", buildRecurrent },
+    { "copy", buildCopy },
+    { "transposition", buildTransposition },
+    { "convolution1d", buildConvolution1D },
+    { "convolution2d", buildConvolution2D },
+    { "gmm", buildGmm },
+};
+
+struct Result
+{
+    Gna2Status Status = Gna2StatusSuccess;
+
+    // output bytes of all operations
+    std::vector<std::vector<uint8_t>> Outputs;
+};
+
+uint32_t getSize(const Gna2Tensor& tensor)
+{
+    return Gna2ShapeGetNumberOfElements(&tensor.Shape) * Gna2DataTypeGetSize(tensor.Type);
+}
+
+// outputs are cleared before each run, so values not written by mode under test are detected
+Result run(const SyntheticModel& model, const RandomCase& randomCase, Gna2AccelerationMode mode)
+{
+    for (uint32_t i = 0; i < model.GetOperationCount(); i++)
+    {
+        auto const & outputs = model.GetOperationOutput(i);
+        memset(outputs.Data, 0, getSize(outputs));
+    }
+
+    SyntheticRequest request{ model, mode };
+    if (randomCase.ActiveListCount > 0)
+    {
+        request.EnableActiveList(0, randomCase.ActiveListCount, randomCase.ActiveListIndices);
+    }
+
+    Result result;
+    result.Status = request.Run();
+    for (uint32_t i = 0; i < model.GetOperationCount(); i++)
+    {
+        auto const & outputs = model.GetOperationOutput(i);
+        auto const data = static_cast<const uint8_t *>(outputs.Data);
+        result.Outputs.emplace_back(data, data + getSize(outputs));
+    }
+    return result;
+}
+
+// returns empty string when results are equal
+std::string compare(const Result& reference, const Result& tested)
+{
+    if (reference.Status != tested.Status)
+    {
+        return "saturation status " + GetStatusMessage(tested.Status)
+            + " differs from generic " + GetStatusMessage(reference.Status);
+    }
+    for (size_t operation = 0; operation < reference.Outputs.size(); operation++)
+    {
+        auto const & expected = reference.Outputs[operation];
+        auto const & actual = tested.Outputs[operation];
+        size_t differences = 0;
+        size_t first = 0;
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            if (expected[i] != actual[i])
+            {
+                first = 0 == differences ? i : first;
+                differences++;
+            }
+        }
+        if (differences > 0)
+        {
+            return "operation " + std::to_string(operation) + " outputs differ in "
+                + std::to_string(differences) + " of " + std::to_string(expected.size())
+                + " bytes, first at byte " + std::to_string(first);
+        }
+    }
+    return {};
+}
+
+struct ConsistencyOptions
+{
+    std::string Filter;
+
+    uint32_t Iterations = 50;
+
+    uint32_t Seed = 1;
+
+    bool Verbose = false;
+};
+
+struct Summary
+{
+    uint32_t Passed = 0;
+    uint32_t Failed = 0;
+
+    // generated configurations rejected by model validation, not a failure
+    uint32_t Rejected = 0;
+};
+
+void printUsage(const char * name)
+{
+    printf("Usage: %s [options]\n"
+        "  --filter <text>       check only operation families which name contains <text>\n"
+        "  --iterations <n>      random cases per operation family (default 50)\n"
+        "  --seed <n>            seed of the first case, consecutive cases use consecutive seeds (default 1)\n"
+        "  --verbose             print every case\n"
+        "  --list                print names of operation families\n",
+        name);
+}
+
+Summary checkFamily(const OperationFamily& family, const ConsistencyOptions& options,
+    const std::vector<Gna2AccelerationMode>& modes)
+{
+    Summary summary;
+    for (uint32_t iteration = 0; iteration < options.Iterations; iteration++)
+    {
+        auto const seed = options.Seed + iteration;
+        auto const name = std::string{ family.Name } + " seed " + std::to_string(seed);
+        SyntheticModel model{ seed };
+        Random random{ seed };
+        auto const randomCase = family.Build(model, random);
+        try
+        {
+            model.Create();
+        }
+        catch (const std::runtime_error& e)
+        {
+            summary.Rejected++;
+            if (options.Verbose)
+            {
+                printf("%s rejected (%s): %s\n", name.c_str(), randomCase.Description.c_str(), e.what());
+            }
+            continue;
+        }
+
+        auto passed = true;
+        try
+        {
+            auto const reference = run(model, randomCase, Gna2AccelerationModeGeneric);
+            for (auto const mode : modes)
+            {
+                auto const mismatch = compare(reference, run(model, randomCase, mode));
+                if (!mismatch.empty())
+                {
+                    passed = false;
+                    printf("%s FAILED in %s (%s): %s\n", name.c_str(), GetAccelerationModeName(mode),
+                        randomCase.Description.c_str(), mismatch.c_str());
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            passed = false;
+            printf("%s FAILED (%s): %s\n", name.c_str(), randomCase.Description.c_str(), e.what());
+        }
+
+        if (passed)
+        {
+            summary.Passed++;
+            if (options.Verbose)
+            {
+                printf("%s passed (%s)\n", name.c_str(), randomCase.Description.c_str());
+            }
+        }
+        else
+        {
+            summary.Failed++;
+        }
+    }
+    return summary;
+}
+
+}
+
+int main(int argc, char * argv[])
+try
+{
+    ConsistencyOptions options;
+    for (int i = 1; i < argc; i++)
+    {
+        auto const hasValue = i + 1 < argc;
+        if (0 == strcmp(argv[i], "--filter") && hasValue)
+        {
+            options.Filter = argv[++i];
+        }
+        else if (0 == strcmp(argv[i], "--iterations") && hasValue)
+        {
+            options.Iterations = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (0 == strcmp(argv[i], "--seed") && hasValue)
+        {
+            options.Seed = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (0 == strcmp(argv[i], "--verbose"))
+        {
+            options.Verbose = true;
+        }
+        else if (0 == strcmp(argv[i], "--list"))
+        {
+            for (auto const & family : Families)
+            {
+                printf("%s\n", family.Name);
+            }
+            return 0;
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 0 == strcmp(argv[i], "--help") ? 0 : 1;
+        }
+    }
+
+    Check(Gna2DeviceOpen(0), "Gna2DeviceOpen");
+
+    std::vector<Gna2AccelerationMode> modes;
+    std::string modeNames;
+    for (auto const mode : GetAccelerationModes())
+    {
+        if (Gna2AccelerationModeGeneric != mode && IsAccelerationModeSupported(mode))
+        {
+            modes.push_back(mode);
+            modeNames += std::string{ " " } + GetAccelerationModeName(mode);
+        }
+    }
+    printf("Comparing with generic:%s\n", modeNames.c_str());
+
+    uint32_t failureCount = 0;
+    for (auto const & family : Families)
+    {
+        if (!options.Filter.empty() && std::string{ family.Name }.find(options.Filter) == std::string::npos)
+        {
+            continue;
+        }
+        auto const summary = checkFamily(family, options, modes);
+        printf("%-24s %6u passed %6u failed %6u rejected\n", family.Name,
+            summary.Passed, summary.Failed, summary.Rejected);
+        failureCount += summary.Failed;
+    }
+
+    Check(Gna2DeviceClose(0), "Gna2DeviceClose");
+    return 0 == failureCount ? 0 : 1;
+}
+catch (const std::exception& e)
+{
+    fprintf(stderr, "Unhandled exception: %s\n", e.what());
+    return -1;
+}
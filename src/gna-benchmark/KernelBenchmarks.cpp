@@ -0,0 +1,430 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "Benchmark.h"
+#include "SyntheticModel.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace GnaBenchmark;
+
+namespace
+{
+
+/**
+ Single operation model exercising one kernel.
+ Benchmarks are named after KernelType (kernels/XnnKernel.h) selected for generic mode,
+ accelerated modes execute SIMD counterpart of the same kernel.
+ */
+struct KernelCase
+{
+    std::string Name;
+
+    std::function<void(SyntheticModel&)> Build;
+
+    Metrics Work;
+
+    // active list of the only operation, disabled when 0
+    uint32_t ActiveListCount = 0;
+    uint32_t ActiveListRange = 0;
+
+    // set when kernel cannot be reached through API with present device generation
+    const char * UnavailableReason = nullptr;
+
+    // additionally measured with hardware consistency disabled, reported with "-relaxed" suffix
+    bool HasRelaxed = false;
+};
+
+struct DataModeName
+{
+    Gna2DataType Inputs;
+    Gna2DataType Weights;
+    // as in KernelType names, weight size first
+    const char * Suffix;
+};
+
+constexpr DataModeName AffineDataModes[] =
+{
+    { Gna2DataTypeInt8, Gna2DataTypeInt8, "1B1B" },
+    { Gna2DataTypeInt16, Gna2DataTypeInt8, "1B2B" },
+    { Gna2DataTypeInt8, Gna2DataTypeInt16, "2B1B" },
+    { Gna2DataTypeInt16, Gna2DataTypeInt16, "2B2B" },
+};
+
+constexpr uint32_t Groupings[] = { 1, 8 };
+
+std::string shapeName(std::initializer_list<uint32_t> dimensions)
+{
+    std::string name;
+    for (auto const dimension : dimensions)
+    {
+        name += (name.empty() ? "" : "x") + std::to_string(dimension);
+    }
+    return name;
+}
+
+const char * sizeName(Gna2DataType type)
+{
+    switch (type)
+    {
+    case Gna2DataTypeInt8:
+        return "1B";
+    case Gna2DataTypeInt16:
+        return "2B";
+    default:
+        return "4B";
+    }
+}
+
+void addAffineCases(std::vector<KernelCase>& cases)
+{
+    const uint32_t inputCount = 1024;
+    const uint32_t outputCount = 1024;
+    const uint32_t activeCount = 256;
+    const uint32_t biasVectorCount = 4;
+    const uint32_t largeBatchSize = 256;
+
+    for (auto const & mode : AffineDataModes)
+    {
+        for (auto const grouping : Groupings)
+        {
+            auto const shape = "/" + shapeName({ outputCount, inputCount, grouping });
+            auto const inputs = Gna2ShapeInit2D(inputCount, grouping);
+            auto const frames = uint64_t{ grouping };
+            auto const operations = 2 * frames * inputCount * outputCount;
+
+            cases.push_back({ std::string{ "affineSingle" } + mode.Suffix + "full" + shape,
+                [=](SyntheticModel& model)
+                {
+                    model.AddFullyConnected(model.AddTensor(inputs, mode.Inputs), outputCount, mode.Weights, 0);
+                },
+                Metrics{ frames, operations } });
+            cases.back().HasRelaxed = true;
+
+            auto active = KernelCase{ std::string{ "affineSingle" } + mode.Suffix + "al" + shape,
+                cases.back().Build,
+                Metrics{ frames, operations * activeCount / outputCount } };
+            active.ActiveListCount = activeCount;
+            active.ActiveListRange = outputCount;
+            active.HasRelaxed = true;
+            cases.push_back(active);
+
+            cases.push_back({ std::string{ "affineMulti" } + mode.Suffix + shape,
+                [=](SyntheticModel& model)
+                {
+                    model.AddFullyConnectedBiasGrouping(model.AddTensor(inputs, mode.Inputs),
+                        outputCount, mode.Weights, 0, biasVectorCount);
+                },
+                Metrics{ frames, operations } });
+            cases.back().HasRelaxed = true;
+        }
+
+        // software only model, compare per frame with grouping 8 of affineSingle
+        auto const inputs = Gna2ShapeInit2D(inputCount, largeBatchSize);
+        cases.push_back({ std::string{ "affineLargeBatch" } + mode.Suffix
+            + "/" + shapeName({ outputCount, inputCount, largeBatchSize }),
+            [=](SyntheticModel& model)
+            {
+                model.AddFullyConnected(model.AddTensor(inputs, mode.Inputs), outputCount, mode.Weights, 0);
+            },
+            Metrics{ largeBatchSize, 2 * uint64_t{ largeBatchSize } * inputCount * outputCount } });
+        cases.back().HasRelaxed = true;
+    }
+}
+
+void addDiagonalAndRecurrentCases(std::vector<KernelCase>& cases)
+{
+    const uint32_t elementCount = 8192;
+    const uint32_t recurrentInputCount = 512;
+    const uint32_t recurrentOutputCount = 512;
+    const uint32_t recurrentVectorCount = 8;
+    const uint32_t segmentCount = 16;
+
+    for (auto const & mode : AffineDataModes)
+    {
+        for (auto const grouping : Groupings)
+        {
+            auto const inputs = Gna2ShapeInit2D(elementCount, grouping);
+            cases.push_back({ std::string{ "diagonal" } + mode.Suffix + "/" + shapeName({ elementCount, grouping }),
+                [=](SyntheticModel& model)
+                {
+                    model.AddElementWiseAffine(model.AddTensor(inputs, mode.Inputs), mode.Weights, 0);
+                },
+                Metrics{ grouping, uint64_t{ 2 } * grouping * elementCount } });
+        }
+
+        auto const inputs = Gna2ShapeInit2D(recurrentVectorCount, recurrentInputCount);
+        cases.push_back({ std::string{ "recurrent" } + mode.Suffix + "/"
+                + shapeName({ recurrentOutputCount, recurrentInputCount + recurrentOutputCount, recurrentVectorCount }),
+            [=](SyntheticModel& model)
+            {
+                model.AddRecurrent(model.AddTensor(inputs, mode.Inputs), recurrentOutputCount,
+                    mode.Weights, segmentCount, 1);
+            },
+            Metrics{ recurrentVectorCount,
+                uint64_t{ 2 } * recurrentVectorCount * (recurrentInputCount + recurrentOutputCount) * recurrentOutputCount } });
+        cases.back().HasRelaxed = true;
+    }
+}
+
+void addDataMovementCases(std::vector<KernelCase>& cases)
+{
+    const uint32_t vectorCount = 8;
+    const uint32_t elementCount = 8192;
+
+    for (auto const type : { Gna2DataTypeInt8, Gna2DataTypeInt16 })
+    {
+        // read and written once
+        auto const bytes = uint64_t{ 2 } * vectorCount * elementCount * Gna2DataTypeGetSize(type);
+        auto const flat = Gna2ShapeInit2D(vectorCount, elementCount);
+        auto const interleaved = Gna2ShapeInit2D(elementCount, vectorCount);
+
+        cases.push_back({ std::string{ "copy" } + sizeName(type) + "/" + shapeName({ vectorCount, elementCount }),
+            [=](SyntheticModel& model)
+            {
+                model.AddCopy(model.AddTensor(flat, type));
+            },
+            Metrics{ vectorCount, 0, bytes } });
+
+        cases.push_back({ std::string{ "transpose" } + sizeName(type) + "/interleave/" + shapeName({ vectorCount, elementCount }),
+            [=](SyntheticModel& model)
+            {
+                model.AddTransposition(model.AddTensor(flat, type));
+            },
+            Metrics{ vectorCount, 0, bytes } });
+
+        cases.push_back({ std::string{ "transpose" } + sizeName(type) + "/deinterleave/" + shapeName({ elementCount, vectorCount }),
+            [=](SyntheticModel& model)
+            {
+                model.AddTransposition(model.AddTensor(interleaved, type));
+            },
+            Metrics{ vectorCount, 0, bytes } });
+    }
+}
+
+void addConvolutionCases(std::vector<KernelCase>& cases)
+{
+    // GNA 1.0 1D convolution
+    const uint32_t inputCount = 4096;
+    const uint32_t filterCount = 128;
+    const uint32_t filterSize = 96;
+    const uint32_t stride = 8;
+    const uint32_t segmentCount = 16;
+    const auto outputCount = uint64_t{ (inputCount - filterSize) / stride + 1 };
+    const auto operations1D = 2 * outputCount * filterCount * filterSize;
+    PoolingConfig pooling1D;
+    pooling1D.Mode = Gna2PoolingModeMax;
+    pooling1D.WindowWidth = 3;
+    pooling1D.StrideWidth = 3;
+
+    for (auto const type : { Gna2DataTypeInt8, Gna2DataTypeInt16 })
+    {
+        auto const inputs = Gna2ShapeInit2D(1, inputCount);
+        auto const shape = "/" + shapeName({ filterCount, filterSize, inputCount });
+        cases.push_back({ std::string{ "convolution" } + sizeName(type) + shape,
+            [=](SyntheticModel& model)
+            {
+                model.AddConvolution1D(model.AddTensor(inputs, type), filterCount, filterSize, stride, type, 0);
+            },
+            Metrics{ 1, operations1D } });
+
+        cases.push_back({ std::string{ "convolutionPooling" } + sizeName(type) + shape,
+            [=](SyntheticModel& model)
+            {
+                model.AddConvolution1D(model.AddTensor(inputs, type), filterCount, filterSize, stride,
+                    type, segmentCount, pooling1D);
+            },
+            Metrics{ 1, operations1D } });
+    }
+
+    // 2D convolution, 16B aligned filters
+    const uint32_t height = 32;
+    const uint32_t width = 32;
+    const uint32_t depth = 16;
+    const uint32_t filterCount2D = 32;
+    const uint32_t filterHeight = 3;
+    const uint32_t filterWidth = 3;
+    const auto operations2D = uint64_t{ 2 } * (height - filterHeight + 1) * (width - filterWidth + 1)
+        * filterCount2D * filterHeight * filterWidth * depth;
+    auto const inputs2D = Gna2ShapeInit4D(1, height, width, depth);
+    auto const shape2D = "/" + shapeName({ filterCount2D, filterHeight, filterWidth, height, width, depth });
+
+    for (auto const & mode : AffineDataModes)
+    {
+        cases.push_back({ std::string{ "convolution2D" } + mode.Suffix + shape2D,
+            [=](SyntheticModel& model)
+            {
+                model.AddConvolution2D(model.AddTensor(inputs2D, mode.Inputs), filterCount2D,
+                    filterHeight, filterWidth, mode.Weights, 0, Gna2DataTypeInt32);
+            },
+            Metrics{ 1, operations2D } });
+        if (mode.Inputs != mode.Weights)
+        {
+            cases.back().UnavailableReason = "GNA 3.0 convolution requires filters of inputs type";
+        }
+    }
+
+    PoolingConfig pooling2D;
+    pooling2D.Mode = Gna2PoolingModeMax;
+    pooling2D.WindowHeight = 2;
+    pooling2D.WindowWidth = 2;
+    pooling2D.StrideHeight = 2;
+    pooling2D.StrideWidth = 2;
+    // pooling kernel is selected by type of activation outputs, 1B outputs require 1B inputs
+    for (auto const outputType : { Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt32 })
+    {
+        auto const segments = Gna2DataTypeInt32 == outputType ? 0 : segmentCount;
+        auto const type = Gna2DataTypeInt8 == outputType ? Gna2DataTypeInt8 : Gna2DataTypeInt16;
+        cases.push_back({ std::string{ "convolutionPooling2D" } + sizeName(outputType) + shape2D,
+            [=](SyntheticModel& model)
+            {
+                model.AddConvolution2D(model.AddTensor(inputs2D, type), filterCount2D,
+                    filterHeight, filterWidth, type, segments, outputType, pooling2D);
+            },
+            Metrics{ 1, operations2D } });
+    }
+}
+
+void addPwlAndGmmCases(std::vector<KernelCase>& cases)
+{
+    const uint32_t elementCount = 8192;
+    const uint32_t grouping = 8;
+    for (auto const segmentCount : { 16u, 128u })
+    {
+        auto const inputs = Gna2ShapeInit2D(elementCount, grouping);
+        cases.push_back({ "pwl/" + shapeName({ elementCount, grouping }) + "/" + std::to_string(segmentCount) + "segments",
+            [=](SyntheticModel& model)
+            {
+                model.AddElementWiseAffine(model.AddTensor(inputs, Gna2DataTypeInt16),
+                    Gna2DataTypeInt16, segmentCount);
+            },
+            Metrics{ grouping } });
+    }
+
+    const uint32_t vectorCount = 8;
+    const uint32_t featureCount = 40;
+    const uint32_t stateCount = 2048;
+    const uint32_t mixtureCount = 16;
+    const uint32_t activeCount = 512;
+    // difference, square, inverse covariance scaling and accumulation per feature
+    auto const operations = uint64_t{ 4 } * vectorCount * stateCount * mixtureCount * featureCount;
+    auto const shape = "/" + shapeName({ stateCount, mixtureCount, featureCount, vectorCount });
+    for (auto const covarianceType : { Gna2DataTypeUint8, Gna2DataTypeUint16 })
+    {
+        auto const name = std::string{ "gmmMaxMix" } + (Gna2DataTypeUint8 == covarianceType ? "8" : "16");
+        cases.push_back({ name + shape,
+            [=](SyntheticModel& model)
+            {
+                model.AddGmm(model.AddGmmInputs(vectorCount, featureCount), stateCount, mixtureCount, covarianceType);
+            },
+            Metrics{ vectorCount, operations } });
+
+        auto active = KernelCase{ name + "ActiveList" + shape, cases.back().Build,
+            Metrics{ vectorCount, operations * activeCount / stateCount } };
+        active.ActiveListCount = activeCount;
+        active.ActiveListRange = stateCount;
+        cases.push_back(active);
+    }
+}
+
+std::vector<KernelCase> getKernelCases()
+{
+    std::vector<KernelCase> cases;
+    addAffineCases(cases);
+    addDiagonalAndRecurrentCases(cases);
+    addDataMovementCases(cases);
+    addConvolutionCases(cases);
+    addPwlAndGmmCases(cases);
+    return cases;
+}
+
+void runKernelCase(Runner& runner, const KernelCase& kernelCase)
+{
+    std::unique_ptr<SyntheticModel> model;
+    uint32_t * activeList = nullptr;
+
+    for (auto const mode : GetAccelerationModes())
+    {
+        for (auto const isRelaxed : { false, true })
+        {
+            if (isRelaxed && !kernelCase.HasRelaxed)
+            {
+                continue;
+            }
+            auto const name = "kernels/" + kernelCase.Name + "/" + GetAccelerationModeName(mode)
+                + (isRelaxed ? "-relaxed" : "");
+            if (!runner.IsEnabled(name))
+            {
+                continue;
+            }
+            if (kernelCase.UnavailableReason != nullptr)
+            {
+                runner.ReportSkipped(name, kernelCase.UnavailableReason);
+                continue;
+            }
+            if (!IsAccelerationModeSupported(mode))
+            {
+                runner.ReportSkipped(name, "acceleration mode not supported");
+                continue;
+            }
+            try
+            {
+                // built once, when first benchmark of the case is enabled
+                if (!model)
+                {
+                    model = std::make_unique<SyntheticModel>();
+                    kernelCase.Build(*model);
+                    if (kernelCase.ActiveListCount > 0)
+                    {
+                        activeList = model->AddActiveList(kernelCase.ActiveListCount, kernelCase.ActiveListRange);
+                    }
+                    model->Create();
+                }
+            }
+            catch (const std::exception& e)
+            {
+                runner.ReportFailure("kernels/" + kernelCase.Name, e.what());
+                return;
+            }
+            try
+            {
+                SyntheticRequest request{ *model, mode };
+                if (activeList != nullptr)
+                {
+                    request.EnableActiveList(0, kernelCase.ActiveListCount, activeList);
+                }
+                if (isRelaxed)
+                {
+                    request.DisableHardwareConsistency();
+                }
+                runner.Measure(name, [&]() { request.Run(); }, kernelCase.Work);
+            }
+            catch (const std::exception& e)
+            {
+                runner.ReportFailure(name, e.what());
+            }
+        }
+    }
+}
+
+void runKernelSuite(Runner& runner)
+{
+    Check(Gna2DeviceOpen(0), "Gna2DeviceOpen");
+
+    for (auto const & kernelCase : getKernelCases())
+    {
+        runKernelCase(runner, kernelCase);
+    }
+
+    Check(Gna2DeviceClose(0), "Gna2DeviceClose");
+}
+
+SuiteRegistration kernelSuite{ "kernels", runKernelSuite };
+
+}
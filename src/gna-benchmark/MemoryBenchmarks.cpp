@@ -0,0 +1,84 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "Benchmark.h"
+
+#include "gna2-memory-api.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace GnaBenchmark;
+
+namespace
+{
+
+constexpr uint32_t MB = 1024 * 1024;
+
+constexpr uint32_t AllocationSizes[] = { 1 * MB, 16 * MB, 64 * MB, 256 * MB };
+
+struct AllocationMode
+{
+    const char * Name;
+    uint32_t Flags;
+};
+
+constexpr AllocationMode AllocationModes[] =
+{
+    { "zero-fill", Gna2MemoryAllocFlagNone },
+    { "no-zero-fill", Gna2MemoryAllocFlagNoZeroFill },
+};
+
+void * allocate(uint32_t size, uint32_t flags)
+{
+    uint32_t granted = 0;
+    void * memory = nullptr;
+    Check(Gna2MemoryAllocWithFlags(0, size, flags, &granted, &memory), "Gna2MemoryAllocWithFlags");
+    return memory;
+}
+
+void runMemorySuite(Runner& runner)
+{
+    Check(Gna2DeviceOpen(0), "Gna2DeviceOpen");
+
+    for (auto const size : AllocationSizes)
+    {
+        auto const sizeName = std::to_string(size / MB) + "MB";
+        std::vector<uint8_t> weights;
+
+        for (auto const & mode : AllocationModes)
+        {
+            // allocation and release only
+            runner.Measure("memory/alloc/" + sizeName + "/" + mode.Name,
+                [&]()
+                {
+                    Check(Gna2MemoryFree(allocate(size, mode.Flags)), "Gna2MemoryFree");
+                });
+
+            // typical model loading, whole buffer is overwritten with weights read before
+            auto const loadName = "memory/alloc-load/" + sizeName + "/" + mode.Name;
+            if (runner.IsEnabled(loadName) && weights.empty())
+            {
+                weights.resize(size, 0x5a);
+            }
+            runner.Measure(loadName,
+                [&]()
+                {
+                    auto const memory = allocate(size, mode.Flags);
+                    memcpy(memory, weights.data(), size);
+                    Check(Gna2MemoryFree(memory), "Gna2MemoryFree");
+                },
+                Metrics{ 0, 0, size });
+        }
+    }
+
+    Check(Gna2DeviceClose(0), "Gna2DeviceClose");
+}
+
+SuiteRegistration memorySuite{ "memory", runMemorySuite };
+
+}
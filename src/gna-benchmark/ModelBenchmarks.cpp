@@ -0,0 +1,399 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "Benchmark.h"
+#include "SyntheticModel.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace GnaBenchmark;
+
+namespace
+{
+
+// Builds synthetic end-to-end model for given grouping and returns work of single request
+using ModelBuild = std::function<Metrics(SyntheticModel&, uint32_t grouping)>;
+
+struct ModelCase
+{
+    const char * Name;
+    ModelBuild Build;
+};
+
+constexpr uint32_t MaxGrouping = 8;
+
+constexpr uint32_t ThreadCounts[] = { 1, 2, 4 };
+
+constexpr uint32_t PwlSegmentCount = 64;
+
+uint64_t affineOperations(uint32_t inputCount, uint32_t outputCount, uint32_t grouping)
+{
+    return uint64_t{ 2 } * inputCount * outputCount * grouping;
+}
+
+// DNN acoustic model: 11 stacked frames of 40 features, 1B weights, 3 hidden layers
+Metrics buildFullyConnectedStack(SyntheticModel& model, uint32_t grouping)
+{
+    const uint32_t layerSizes[] = { 440, 1024, 1024, 1024, 2048 };
+    auto tensor = &model.AddTensor(Gna2ShapeInit2D(layerSizes[0], grouping), Gna2DataTypeInt16);
+    Metrics work{ grouping };
+    for (uint32_t i = 1; i < sizeof(layerSizes) / sizeof(layerSizes[0]); i++)
+    {
+        auto const isLast = i == sizeof(layerSizes) / sizeof(layerSizes[0]) - 1;
+        tensor = &model.AddFullyConnected(*tensor, layerSizes[i], Gna2DataTypeInt8,
+            isLast ? 0 : PwlSegmentCount);
+        work.OperationsPerIteration += affineOperations(layerSizes[i - 1], layerSizes[i], grouping);
+    }
+    return work;
+}
+
+// LSTM-like cell: recurrent layer on flat vectors, interleaved projection and element-wise gate
+Metrics buildRecurrent(SyntheticModel& model, uint32_t grouping)
+{
+    const uint32_t inputCount = 256;
+    const uint32_t cellCount = 512;
+    auto & inputs = model.AddTensor(Gna2ShapeInit2D(grouping, inputCount), Gna2DataTypeInt16);
+    auto & cell = model.AddRecurrent(inputs, cellCount, Gna2DataTypeInt16, PwlSegmentCount, 1);
+    auto & interleaved = model.AddTransposition(cell);
+    auto & projection = model.AddFullyConnected(interleaved, cellCount, Gna2DataTypeInt8, PwlSegmentCount);
+    model.AddElementWiseAffine(projection, Gna2DataTypeInt16, PwlSegmentCount);
+
+    return Metrics{ grouping,
+        affineOperations(inputCount + cellCount, cellCount, grouping)
+            + affineOperations(cellCount, cellCount, grouping)
+            + uint64_t{ 2 } * cellCount * grouping };
+}
+
+// 2D convolutions support single image batches only, grouping is number of images per request
+Metrics buildConvolutional(SyntheticModel& model, uint32_t grouping)
+{
+    const uint32_t size = 40;
+    const uint32_t depth = 16;
+    const uint32_t filterSize = 3;
+    const uint32_t filterCounts[] = { 16, 32 };
+    PoolingConfig pooling;
+    pooling.Mode = Gna2PoolingModeMax;
+    pooling.WindowHeight = 2;
+    pooling.WindowWidth = 2;
+    pooling.StrideHeight = 2;
+    pooling.StrideWidth = 2;
+
+    Metrics work{ grouping };
+    for (uint32_t image = 0; image < grouping; image++)
+    {
+        auto tensor = &model.AddTensor(Gna2ShapeInit4D(1, size, size, depth), Gna2DataTypeInt16);
+        for (auto const filterCount : filterCounts)
+        {
+            auto const height = tensor->Shape.Dimensions[1];
+            auto const width = tensor->Shape.Dimensions[2];
+            work.OperationsPerIteration += uint64_t{ 2 } * (height - filterSize + 1) * (width - filterSize + 1)
+                * filterCount * filterSize * filterSize * tensor->Shape.Dimensions[3];
+            tensor = &model.AddConvolution2D(*tensor, filterCount, filterSize, filterSize,
+                Gna2DataTypeInt16, PwlSegmentCount, Gna2DataTypeInt16, pooling);
+        }
+    }
+    return work;
+}
+
+// GMM acoustic model scoring all states
+Metrics buildGmm(SyntheticModel& model, uint32_t grouping)
+{
+    const uint32_t featureCount = 40;
+    const uint32_t stateCount = 4096;
+    const uint32_t mixtureCount = 16;
+    model.AddGmm(model.AddGmmInputs(grouping, featureCount), stateCount, mixtureCount, Gna2DataTypeUint8);
+    return Metrics{ grouping, uint64_t{ 4 } * grouping * stateCount * mixtureCount * featureCount };
+}
+
+// DNN acoustic model with 4-bit weights of hidden layer, supported in software only,
+// so on devices with hardware other layers are scored by device
+Metrics buildMixed(SyntheticModel& model, uint32_t grouping)
+{
+    const uint32_t layerSizes[] = { 440, 1024, 1024, 2048 };
+    const Gna2DataType weightTypes[] = { Gna2DataTypeInt8, Gna2DataTypeInt4, Gna2DataTypeInt8 };
+    auto tensor = &model.AddTensor(Gna2ShapeInit2D(layerSizes[0], grouping), Gna2DataTypeInt16);
+    Metrics work{ grouping };
+    for (uint32_t i = 1; i < sizeof(layerSizes) / sizeof(layerSizes[0]); i++)
+    {
+        auto const isLast = i == sizeof(layerSizes) / sizeof(layerSizes[0]) - 1;
+        tensor = &model.AddFullyConnected(*tensor, layerSizes[i], weightTypes[i - 1],
+            isLast ? 0 : PwlSegmentCount);
+        work.OperationsPerIteration += affineOperations(layerSizes[i - 1], layerSizes[i], grouping);
+    }
+    return work;
+}
+
+const ModelCase ModelCases[] =
+{
+    { "fc-stack", buildFullyConnectedStack },
+    { "lstm", buildRecurrent },
+    { "cnn2d-pool", buildConvolutional },
+    { "gmm", buildGmm },
+};
+
+/**
+ Each thread count N processes N independent models (streams) concurrently.
+ Scaling efficiency compares to single thread processing of N requests one by one,
+ so it is not reported when single thread benchmark is filtered out.
+ */
+void runModelCase(Runner& runner, const ModelCase& modelCase, uint32_t grouping)
+{
+    auto const prefix = std::string{ "models/" } + modelCase.Name + "/g" + std::to_string(grouping) + "/t";
+    std::vector<std::unique_ptr<SyntheticModel>> streams;
+    std::vector<std::unique_ptr<SyntheticRequest>> requests;
+    Metrics work;
+    double singleThreaded = 0;
+
+    for (auto const threadCount : ThreadCounts)
+    {
+        auto const name = prefix + std::to_string(threadCount);
+        if (!runner.IsEnabled(name))
+        {
+            continue;
+        }
+        try
+        {
+            while (streams.size() < threadCount)
+            {
+                streams.push_back(std::make_unique<SyntheticModel>(static_cast<uint32_t>(streams.size() + 1)));
+                work = modelCase.Build(*streams.back(), grouping);
+                streams.back()->Create();
+                requests.push_back(std::make_unique<SyntheticRequest>(*streams.back(), Gna2AccelerationModeAuto));
+            }
+            Check(Gna2DeviceSetNumberOfThreads(0, threadCount), "Gna2DeviceSetNumberOfThreads");
+        }
+        catch (const std::exception& e)
+        {
+            runner.ReportFailure(name, e.what());
+            return;
+        }
+
+        auto metrics = work;
+        metrics.FramesPerIteration *= threadCount;
+        metrics.OperationsPerIteration *= threadCount;
+        if (threadCount > 1)
+        {
+            metrics.ScalingBaseline = singleThreaded * threadCount;
+            metrics.ScalingThreadCount = threadCount;
+        }
+
+        auto const measurement = runner.Measure(name,
+            [&]()
+            {
+                std::vector<uint32_t> requestIds;
+                for (uint32_t i = 0; i < threadCount; i++)
+                {
+                    requestIds.push_back(requests[i]->Enqueue());
+                }
+                for (auto const requestId : requestIds)
+                {
+                    SyntheticRequest::Wait(requestId);
+                }
+            },
+            metrics);
+        if (1 == threadCount)
+        {
+            singleThreaded = measurement.NanosecondsPerIteration;
+        }
+    }
+}
+
+void runModelSuite(Runner& runner)
+{
+    Check(Gna2DeviceOpen(0), "Gna2DeviceOpen");
+
+    for (auto const & modelCase : ModelCases)
+    {
+        for (uint32_t grouping = 1; grouping <= MaxGrouping; grouping++)
+        {
+            runModelCase(runner, modelCase, grouping);
+        }
+    }
+
+    Check(Gna2DeviceSetNumberOfThreads(0, 1), "Gna2DeviceSetNumberOfThreads");
+    Check(Gna2DeviceClose(0), "Gna2DeviceClose");
+}
+
+SuiteRegistration modelSuite{ "models", runModelSuite };
+
+/**
+ Gna2ModelCreate and Gna2ModelRelease of model with maximal grouping.
+ Heap retained by created model is measured once, before timing.
+ On devices with hardware it includes software and hardware models.
+ */
+void runModelLoad(Runner& runner, const ModelCase& modelCase)
+{
+    auto const name = std::string{ "load/" } + modelCase.Name + "/g" + std::to_string(MaxGrouping);
+    if (!runner.IsEnabled(name))
+    {
+        return;
+    }
+
+    SyntheticModel model;
+    modelCase.Build(model, MaxGrouping);
+
+    Metrics metrics;
+    auto const heapBefore = GetHeapInUse();
+    model.Create();
+    auto const heapAfter = GetHeapInUse();
+    metrics.RetainedBytes = heapAfter > heapBefore ? heapAfter - heapBefore : 0;
+    model.Release();
+
+    runner.Measure(name,
+        [&]()
+        {
+            model.Create();
+            model.Release();
+        },
+        metrics);
+}
+
+void runLoadSuite(Runner& runner)
+{
+    Check(Gna2DeviceOpen(0), "Gna2DeviceOpen");
+
+    // mixed model is built with software emulation and present device limitations
+    const ModelCase mixedCase{ "fc-mixed", buildMixed };
+    std::vector<ModelCase> loadCases{ std::begin(ModelCases), std::end(ModelCases) };
+    loadCases.push_back(mixedCase);
+    for (auto const & modelCase : loadCases)
+    {
+        try
+        {
+            runModelLoad(runner, modelCase);
+        }
+        catch (const std::exception& e)
+        {
+            runner.ReportFailure(std::string{ "load/" } + modelCase.Name, e.what());
+        }
+    }
+
+    Check(Gna2DeviceClose(0), "Gna2DeviceClose");
+}
+
+SuiteRegistration loadSuite{ "load", runLoadSuite };
+
+constexpr uint32_t ProfiledGrouping = 4;
+
+constexpr uint32_t ProfiledRequestCount = 200;
+
+constexpr uint32_t MaxOperationResultCount = 256;
+
+const char * getStageName(Gna2InstrumentationStage stage)
+{
+    switch (stage)
+    {
+    case Gna2InstrumentationStageOperation:
+        return "total";
+    case Gna2InstrumentationStageAffine:
+        return "affine";
+    case Gna2InstrumentationStageElementWiseAffine:
+        return "element-wise-affine";
+    case Gna2InstrumentationStageRecurrent:
+        return "recurrent";
+    case Gna2InstrumentationStageConvolution:
+        return "convolution";
+    case Gna2InstrumentationStagePooling:
+        return "pooling";
+    case Gna2InstrumentationStageActivation:
+        return "activation";
+    case Gna2InstrumentationStageCopy:
+        return "copy";
+    case Gna2InstrumentationStageTransposition:
+        return "transposition";
+    case Gna2InstrumentationStageGmm:
+        return "gmm";
+    default:
+        return "unknown";
+    }
+}
+
+/**
+ Breaks single stream model processing down to operations and their stages
+ using software operation instrumentation, times are median of per request samples.
+ Results are reported in microseconds, what is precise enough for medians of many requests.
+ Results come in order of processing, so their positions are stable between requests.
+ */
+void runOperationProfile(Runner& runner, const ModelCase& modelCase)
+{
+    auto const prefix = std::string{ "operations/" } + modelCase.Name + "/g" + std::to_string(ProfiledGrouping) + "/";
+
+    SyntheticModel model;
+    modelCase.Build(model, ProfiledGrouping);
+    model.Create();
+    auto request = std::make_unique<SyntheticRequest>(model, Gna2AccelerationModeAuto);
+
+    auto point = Gna2InstrumentationPointLibExecution;
+    uint64_t pointResult = 0;
+    std::vector<Gna2InstrumentationOperationResult> results(MaxOperationResultCount);
+    uint32_t instrumentationConfigId = 0;
+    Check(Gna2InstrumentationConfigCreate(1, &point, &pointResult, &instrumentationConfigId),
+        "Gna2InstrumentationConfigCreate");
+    Check(Gna2InstrumentationConfigSetOperationResults(instrumentationConfigId,
+        MaxOperationResultCount, results.data()), "Gna2InstrumentationConfigSetOperationResults");
+    Check(Gna2InstrumentationConfigAssignToRequestConfig(instrumentationConfigId, request->GetConfigId()),
+        "Gna2InstrumentationConfigAssignToRequestConfig");
+
+    std::vector<std::vector<double>> samples;
+    for (uint32_t i = 0; i < ProfiledRequestCount; i++)
+    {
+        SyntheticRequest::Wait(request->Enqueue());
+        uint32_t resultCount = 0;
+        Check(Gna2InstrumentationConfigGetNumberOfOperationResults(instrumentationConfigId, &resultCount),
+            "Gna2InstrumentationConfigGetNumberOfOperationResults");
+        resultCount = std::min(resultCount, MaxOperationResultCount);
+        samples.resize(resultCount);
+        for (uint32_t r = 0; r < resultCount; r++)
+        {
+            samples[r].push_back(static_cast<double>(results[r].Time) * 1000.0);
+        }
+    }
+    request.reset();
+    Check(Gna2InstrumentationConfigRelease(instrumentationConfigId), "Gna2InstrumentationConfigRelease");
+
+    for (uint32_t r = 0; r < samples.size(); r++)
+    {
+        auto & resultSamples = samples[r];
+        std::sort(resultSamples.begin(), resultSamples.end());
+        auto const & result = results[r];
+        Measurement measurement;
+        measurement.Iterations = resultSamples.size();
+        measurement.NanosecondsPerIteration = resultSamples[resultSamples.size() / 2];
+        measurement.MinNanosecondsPerIteration = resultSamples.front();
+        Metrics metrics;
+        metrics.OperationsPerIteration = 2 * result.NumberOfMultiplyAccumulates;
+        metrics.BytesPerIteration = result.NumberOfBytes;
+        runner.Report(prefix + std::to_string(result.OperationIndex) + "/" + getStageName(result.Stage)
+            + "/" + GetAccelerationModeName(result.AccelerationMode), measurement, metrics);
+    }
+}
+
+void runOperationSuite(Runner& runner)
+{
+    Check(Gna2DeviceOpen(0), "Gna2DeviceOpen");
+
+    for (auto const & modelCase : ModelCases)
+    {
+        try
+        {
+            runOperationProfile(runner, modelCase);
+        }
+        catch (const std::exception& e)
+        {
+            runner.ReportFailure(std::string{ "operations/" } + modelCase.Name, e.what());
+        }
+    }
+
+    Check(Gna2DeviceClose(0), "Gna2DeviceClose");
+}
+
+SuiteRegistration operationSuite{ "operations", runOperationSuite };
+
+}
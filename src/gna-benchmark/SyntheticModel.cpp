@@ -0,0 +1,511 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "SyntheticModel.h"
+
+#include "Benchmark.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+using namespace GnaBenchmark;
+
+static void * allocateOperationArray(uint32_t size)
+{
+    return malloc(size);
+}
+
+static uint32_t getGroupCount(const Gna2Tensor& interleaved)
+{
+    return interleaved.Shape.Dimensions[1];
+}
+
+static Gna2DataType getBiasType(const Gna2Tensor& inputs, Gna2DataType weightType)
+{
+    // 1B and 4-bit weights with 2B inputs use per row weight scaling stored along with bias
+    return (Gna2DataTypeInt8 == weightType || Gna2DataTypeInt4 == weightType) && Gna2DataTypeInt16 == inputs.Type
+        ? Gna2DataTypeCompoundBias : Gna2DataTypeInt32;
+}
+
+SyntheticModel::SyntheticModel(uint32_t seed) :
+    generator{ seed }
+{
+}
+
+SyntheticModel::~SyntheticModel()
+{
+    if (created)
+    {
+        Gna2ModelRelease(modelId);
+    }
+    for (auto & operation : operations)
+    {
+        free(const_cast<Gna2Tensor **>(operation.Operands));
+        free(operation.Parameters);
+    }
+    for (auto const buffer : memory)
+    {
+        Gna2MemoryFree(buffer);
+    }
+}
+
+void * SyntheticModel::allocate(uint32_t size)
+{
+    uint32_t granted = 0;
+    void * buffer = nullptr;
+    Check(Gna2MemoryAlloc(size, &granted, &buffer), "Gna2MemoryAlloc");
+    memory.push_back(buffer);
+    return buffer;
+}
+
+void SyntheticModel::randomize(void * data, uint32_t size)
+{
+    auto bytes = static_cast<uint8_t *>(data);
+    std::uniform_int_distribution<uint32_t> distribution{ 0, 255 };
+    for (uint32_t i = 0; i < size; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(distribution(generator));
+    }
+}
+
+Gna2Operation & SyntheticModel::addOperation()
+{
+    if (created)
+    {
+        throw std::logic_error("Operation added after model creation");
+    }
+    operations.emplace_back();
+    auto & operation = operations.back();
+    operation.Type = Gna2OperationTypeNone;
+    return operation;
+}
+
+Gna2Shape & SyntheticModel::addShape(const Gna2Shape& shape)
+{
+    shapes.push_back(shape);
+    return shapes.back();
+}
+
+Gna2Tensor & SyntheticModel::AddTensor(const Gna2Shape& shape, Gna2DataType type, uint32_t prefixSize)
+{
+    Gna2Tensor tensor{};
+    tensor.Shape = shape;
+    tensor.Mode = Gna2TensorModeDefault;
+    tensor.Type = type;
+    auto const size = prefixSize + Gna2ShapeGetNumberOfElements(&shape) * Gna2DataTypeGetSize(type);
+    auto const buffer = allocate(size);
+    randomize(buffer, size);
+    tensor.Data = static_cast<uint8_t *>(buffer) + prefixSize;
+    tensors.push_back(tensor);
+    return tensors.back();
+}
+
+Gna2Tensor & SyntheticModel::AddActivation(uint32_t segmentCount)
+{
+    if (0 == segmentCount)
+    {
+        tensors.push_back(Gna2TensorInitDisabled());
+        return tensors.back();
+    }
+
+    auto & activation = AddTensor(Gna2ShapeInit1D(segmentCount), Gna2DataTypePwlSegment);
+    auto const segments = static_cast<Gna2PwlSegment *>(activation.Data);
+    // segments evenly cover whole input range, x bases are multiples of 4 with slope scale in 2 LSB
+    auto const xStep = (int64_t{ 1 } << 32) / segmentCount;
+    auto const yStep = (int32_t{ 1 } << 16) / static_cast<int32_t>(segmentCount);
+    std::uniform_int_distribution<int32_t> slopes{ 0, std::numeric_limits<int16_t>::max() };
+    std::uniform_int_distribution<int32_t> scales{ 0, 3 };
+    for (uint32_t i = 0; i < segmentCount; i++)
+    {
+        auto const xBase = std::numeric_limits<int32_t>::min() + xStep * i;
+        segments[i].xBase = static_cast<int32_t>(xBase & ~int64_t{ 3 }) | scales(generator);
+        segments[i].yBase = static_cast<int16_t>(std::numeric_limits<int16_t>::min()
+            + yStep * static_cast<int32_t>(i));
+        segments[i].Slope = static_cast<int16_t>(slopes(generator));
+    }
+    return activation;
+}
+
+uint32_t * SyntheticModel::AddActiveList(uint32_t count, uint32_t range)
+{
+    auto const indices = static_cast<uint32_t *>(allocate(count * static_cast<uint32_t>(sizeof(uint32_t))));
+    for (uint32_t i = 0; i < count; i++)
+    {
+        indices[i] = static_cast<uint32_t>(uint64_t{ i } * range / count);
+    }
+    return indices;
+}
+
+Gna2Tensor & SyntheticModel::AddFullyConnected(Gna2Tensor & inputs, uint32_t outputCount,
+    Gna2DataType weightType, uint32_t segmentCount)
+{
+    auto const inputCount = inputs.Shape.Dimensions[0];
+    auto & weights = AddTensor(Gna2ShapeInit2D(outputCount, inputCount), weightType);
+    auto & biases = AddTensor(Gna2ShapeInit1D(outputCount), getBiasType(inputs, weightType));
+    auto & activation = AddActivation(segmentCount);
+    auto & outputs = AddTensor(Gna2ShapeInit2D(outputCount, getGroupCount(inputs)),
+        segmentCount > 0 ? Gna2DataTypeInt16 : Gna2DataTypeInt32);
+
+    Check(Gna2OperationInitFullyConnectedAffine(&addOperation(), allocateOperationArray,
+        &inputs, &outputs, &weights, &biases, segmentCount > 0 ? &activation : nullptr),
+        "Gna2OperationInitFullyConnectedAffine");
+    return outputs;
+}
+
+Gna2Tensor & SyntheticModel::AddFullyConnectedBiasGrouping(Gna2Tensor & inputs, uint32_t outputCount,
+    Gna2DataType weightType, uint32_t segmentCount, uint32_t biasVectorCount)
+{
+    auto const inputCount = inputs.Shape.Dimensions[0];
+    auto & weights = AddTensor(Gna2ShapeInit2D(outputCount, inputCount), weightType);
+    auto & biases = AddTensor(Gna2ShapeInit2D(outputCount, biasVectorCount), Gna2DataTypeInt32);
+    auto & activation = AddActivation(segmentCount);
+    auto & outputs = AddTensor(Gna2ShapeInit2D(outputCount, getGroupCount(inputs)),
+        segmentCount > 0 ? Gna2DataTypeInt16 : Gna2DataTypeInt32);
+    auto weightScaleFactors = Gna2DataTypeInt8 == weightType
+        ? &AddTensor(Gna2ShapeInit1D(outputCount), Gna2DataTypeWeightScaleFactor)
+        : nullptr;
+
+    Check(Gna2OperationInitFullyConnectedBiasGrouping(&addOperation(), allocateOperationArray,
+        &inputs, &outputs, &weights, &biases, segmentCount > 0 ? &activation : nullptr,
+        weightScaleFactors, addParameter(Gna2BiasModeGrouping), addParameter(biasVectorCount - 1)),
+        "Gna2OperationInitFullyConnectedBiasGrouping");
+    return outputs;
+}
+
+Gna2Tensor & SyntheticModel::AddElementWiseAffine(Gna2Tensor & inputs,
+    Gna2DataType weightType, uint32_t segmentCount)
+{
+    auto const elementCount = inputs.Shape.Dimensions[0];
+    auto & weights = AddTensor(Gna2ShapeInit1D(elementCount), weightType);
+    auto & biases = AddTensor(Gna2ShapeInit1D(elementCount), getBiasType(inputs, weightType));
+    auto & activation = AddActivation(segmentCount);
+    auto & outputs = AddTensor(Gna2ShapeInit2D(elementCount, getGroupCount(inputs)),
+        segmentCount > 0 ? Gna2DataTypeInt16 : Gna2DataTypeInt32);
+
+    Check(Gna2OperationInitElementWiseAffine(&addOperation(), allocateOperationArray,
+        &inputs, &outputs, &weights, &biases, segmentCount > 0 ? &activation : nullptr),
+        "Gna2OperationInitElementWiseAffine");
+    return outputs;
+}
+
+Gna2Tensor & SyntheticModel::AddRecurrent(Gna2Tensor & inputs, uint32_t outputCount,
+    Gna2DataType weightType, uint32_t segmentCount, uint32_t delay)
+{
+    auto const vectorCount = inputs.Shape.Dimensions[0];
+    auto const inputCount = inputs.Shape.Dimensions[1];
+    auto & weights = AddTensor(Gna2ShapeInit2D(outputCount, inputCount + outputCount), weightType);
+    auto & biases = AddTensor(Gna2ShapeInit1D(outputCount), getBiasType(inputs, weightType));
+    auto & activation = AddActivation(segmentCount);
+    // feedback buffer precedes outputs by delay vectors
+    auto const feedbackSize = delay * outputCount * Gna2DataTypeGetSize(inputs.Type);
+    auto & outputs = AddTensor(Gna2ShapeInit2D(vectorCount, outputCount), inputs.Type, feedbackSize);
+
+    Check(Gna2OperationInitRecurrent(&addOperation(), allocateOperationArray,
+        &inputs, &outputs, &weights, &biases, &activation, addParameter(delay)),
+        "Gna2OperationInitRecurrent");
+    return outputs;
+}
+
+Gna2Tensor & SyntheticModel::AddCopy(Gna2Tensor & inputs)
+{
+    auto & outputs = AddTensor(inputs.Shape, inputs.Type);
+    auto & copyShape = addShape(inputs.Shape);
+
+    Check(Gna2OperationInitCopy(&addOperation(), allocateOperationArray,
+        &inputs, &outputs, &copyShape), "Gna2OperationInitCopy");
+    return outputs;
+}
+
+Gna2Tensor & SyntheticModel::AddTransposition(Gna2Tensor & inputs)
+{
+    auto & outputs = AddTensor(
+        Gna2ShapeInit2D(inputs.Shape.Dimensions[1], inputs.Shape.Dimensions[0]), inputs.Type);
+
+    Check(Gna2OperationInitTransposition(&addOperation(), allocateOperationArray,
+        &inputs, &outputs), "Gna2OperationInitTransposition");
+    return outputs;
+}
+
+Gna2Tensor & SyntheticModel::AddConvolution1D(Gna2Tensor & inputs, uint32_t filterCount, uint32_t filterSize,
+    uint32_t stride, Gna2DataType filterType, uint32_t segmentCount, const PoolingConfig& pooling)
+{
+    auto const inputCount = inputs.Shape.Dimensions[1];
+    // filters are padded to 16B, padding is excluded from filters shape
+    auto const elementSize = Gna2DataTypeGetSize(filterType);
+    auto const paddedFilterSize = (filterSize * elementSize + 15) / 16 * 16 / elementSize;
+    auto & filters = AddTensor(Gna2ShapeInit2D(filterCount, paddedFilterSize), filterType);
+    filters.Shape.Dimensions[1] = filterSize;
+    auto & biases = AddTensor(Gna2ShapeInit1D(filterCount), Gna2DataTypeInt32);
+    auto & activation = AddActivation(segmentCount);
+
+    auto outputCount = (inputCount - filterSize) / stride + 1;
+    auto const isPooled = Gna2PoolingModeDisabled != pooling.Mode;
+    if (isPooled)
+    {
+        outputCount = (outputCount - 1) / pooling.StrideWidth + 1;
+    }
+    auto & outputs = AddTensor(Gna2ShapeInit3D(1, outputCount, filterCount),
+        segmentCount > 0 ? Gna2DataTypeInt16 : Gna2DataTypeInt32);
+    // enforces GNA 1.0 convolution
+    memcpy(outputs.Layout, "GNA1", 4);
+
+    auto & convolutionStride = addShape(Gna2ShapeInit1D(stride));
+    auto const activationTensor = segmentCount > 0 ? &activation : nullptr;
+    if (isPooled)
+    {
+        Check(Gna2OperationInitConvolutionFused(&addOperation(), allocateOperationArray,
+            &inputs, &outputs, &filters, &biases, activationTensor, &convolutionStride,
+            addParameter(Gna2BiasModeDefault), addParameter(pooling.Mode),
+            &addShape(Gna2ShapeInit1D(pooling.WindowWidth)),
+            &addShape(Gna2ShapeInit1D(pooling.StrideWidth)), nullptr),
+            "Gna2OperationInitConvolutionFused");
+    }
+    else
+    {
+        Check(Gna2OperationInitConvolution(&addOperation(), allocateOperationArray,
+            &inputs, &outputs, &filters, &biases, activationTensor, &convolutionStride,
+            addParameter(Gna2BiasModeDefault)),
+            "Gna2OperationInitConvolution");
+    }
+    return outputs;
+}
+
+Gna2Tensor & SyntheticModel::AddConvolution2D(Gna2Tensor & inputs, uint32_t filterCount,
+    uint32_t filterHeight, uint32_t filterWidth, Gna2DataType filterType,
+    uint32_t segmentCount, Gna2DataType outputType, const PoolingConfig& pooling)
+{
+    auto const inputHeight = inputs.Shape.Dimensions[1];
+    auto const inputWidth = inputs.Shape.Dimensions[2];
+    auto const depth = inputs.Shape.Dimensions[3];
+    auto & filters = AddTensor(Gna2ShapeInit4D(filterCount, filterHeight, filterWidth, depth), filterType);
+    auto & biases = AddTensor(Gna2ShapeInit1D(filterCount), Gna2DataTypeInt32);
+    auto & activation = AddActivation(segmentCount);
+
+    auto outputHeight = inputHeight - filterHeight + 1;
+    auto outputWidth = inputWidth - filterWidth + 1;
+    auto const isPooled = Gna2PoolingModeDisabled != pooling.Mode;
+    if (isPooled)
+    {
+        auto const ceilDiv = [](uint32_t value, uint32_t divider) { return (value + divider - 1) / divider; };
+        outputHeight = 1 + ceilDiv(outputHeight - pooling.WindowHeight, pooling.StrideHeight);
+        outputWidth = 1 + ceilDiv(outputWidth - pooling.WindowWidth, pooling.StrideWidth);
+    }
+    auto & outputs = AddTensor(Gna2ShapeInit4D(1, outputHeight, outputWidth, filterCount), outputType);
+
+    auto & convolutionStride = addShape(Gna2ShapeInit2D(1, 1));
+    auto const activationTensor = segmentCount > 0 ? &activation : nullptr;
+    if (isPooled)
+    {
+        Check(Gna2OperationInitConvolutionFused(&addOperation(), allocateOperationArray,
+            &inputs, &outputs, &filters, &biases, activationTensor, &convolutionStride,
+            addParameter(Gna2BiasModeDefault), addParameter(pooling.Mode),
+            &addShape(Gna2ShapeInit2D(pooling.WindowHeight, pooling.WindowWidth)),
+            &addShape(Gna2ShapeInit2D(pooling.StrideHeight, pooling.StrideWidth)), nullptr),
+            "Gna2OperationInitConvolutionFused");
+    }
+    else
+    {
+        Check(Gna2OperationInitConvolution(&addOperation(), allocateOperationArray,
+            &inputs, &outputs, &filters, &biases, activationTensor, &convolutionStride,
+            addParameter(Gna2BiasModeDefault)),
+            "Gna2OperationInitConvolution");
+    }
+    return outputs;
+}
+
+Gna2Tensor & SyntheticModel::AddGmmInputs(uint32_t vectorCount, uint32_t featureCount)
+{
+    const uint32_t vectorStride = 64;
+    auto & inputs = AddTensor(Gna2ShapeInit2D(vectorCount, (featureCount + vectorStride - 1) / vectorStride * vectorStride),
+        Gna2DataTypeUint8);
+    inputs.Shape.Dimensions[1] = featureCount;
+    return inputs;
+}
+
+Gna2Tensor & SyntheticModel::AddGmm(Gna2Tensor & inputs, uint32_t stateCount, uint32_t mixtureCount,
+    Gna2DataType inverseCovarianceType)
+{
+    auto const vectorCount = inputs.Shape.Dimensions[0];
+    auto const featureCount = inputs.Shape.Dimensions[1];
+    auto & means = AddTensor(Gna2ShapeInit3D(stateCount, mixtureCount, featureCount), Gna2DataTypeUint8);
+    auto & inverseCovariances = AddTensor(Gna2ShapeInit3D(stateCount, mixtureCount, featureCount),
+        inverseCovarianceType);
+    // constants of each state are padded to 8B
+    auto & constants = AddTensor(Gna2ShapeInit2D(stateCount, (mixtureCount + 1) / 2 * 2), Gna2DataTypeUint32);
+    auto & outputs = AddTensor(Gna2ShapeInit2D(stateCount, vectorCount), Gna2DataTypeUint32);
+
+    Check(Gna2OperationInitGmm(&addOperation(), allocateOperationArray,
+        &inputs, &outputs, &means, &inverseCovariances, &constants,
+        addParameter(std::numeric_limits<uint32_t>::max())), "Gna2OperationInitGmm");
+    return outputs;
+}
+
+uint32_t SyntheticModel::GetOperationCount() const
+{
+    return static_cast<uint32_t>(operations.size());
+}
+
+const Gna2Tensor & SyntheticModel::GetOperationOutput(uint32_t operationIndex) const
+{
+    // all operation initializers place outputs right after inputs
+    return *operations.at(operationIndex).Operands[1];
+}
+
+uint32_t SyntheticModel::Create(uint32_t deviceIndex)
+{
+    Gna2Model model{ GetOperationCount(), operations.data() };
+    auto const status = Gna2ModelCreate(deviceIndex, &model, &modelId);
+    if (!Gna2StatusIsSuccessful(status))
+    {
+        auto description = "Gna2ModelCreate: " + GetStatusMessage(status);
+        Gna2ModelError error{};
+        if (Gna2StatusSuccess == Gna2ModelGetLastError(&error))
+        {
+            auto const size = Gna2ModelErrorGetMaxMessageLength();
+            auto message = std::unique_ptr<char[]>(new char[size]());
+            Gna2ModelErrorGetMessage(&error, message.get(), size);
+            description += std::string{ " (" } + message.get() + ")";
+        }
+        throw std::runtime_error(description);
+    }
+    created = true;
+    return modelId;
+}
+
+void SyntheticModel::Release()
+{
+    if (created)
+    {
+        Check(Gna2ModelRelease(modelId), "Gna2ModelRelease");
+        created = false;
+    }
+}
+
+uint32_t SyntheticModel::GetModelId() const
+{
+    return modelId;
+}
+
+SyntheticRequest::SyntheticRequest(const SyntheticModel& model, Gna2AccelerationMode mode)
+{
+    Check(Gna2RequestConfigCreate(model.GetModelId(), &configId), "Gna2RequestConfigCreate");
+    auto const status = Gna2RequestConfigSetAccelerationMode(configId, mode);
+    if (!Gna2StatusIsSuccessful(status))
+    {
+        Gna2RequestConfigRelease(configId);
+        Check(status, "Gna2RequestConfigSetAccelerationMode");
+    }
+}
+
+SyntheticRequest::~SyntheticRequest()
+{
+    Gna2RequestConfigRelease(configId);
+}
+
+void SyntheticRequest::EnableActiveList(uint32_t operationIndex, uint32_t count, const uint32_t * indices)
+{
+    Check(Gna2RequestConfigEnableActiveList(configId, operationIndex, count, indices),
+        "Gna2RequestConfigEnableActiveList");
+}
+
+void SyntheticRequest::DisableHardwareConsistency()
+{
+    Check(Gna2RequestConfigDisableHardwareConsistency(configId), "Gna2RequestConfigDisableHardwareConsistency");
+}
+
+uint32_t SyntheticRequest::Enqueue()
+{
+    uint32_t requestId = 0;
+    Check(Gna2RequestEnqueue(configId, &requestId), "Gna2RequestEnqueue");
+    return requestId;
+}
+
+Gna2Status SyntheticRequest::Wait(uint32_t requestId)
+{
+    auto const status = Gna2RequestWait(requestId, 10000);
+    Check(status, "Gna2RequestWait");
+    return status;
+}
+
+Gna2Status SyntheticRequest::Run()
+{
+    return Wait(Enqueue());
+}
+
+uint32_t SyntheticRequest::GetConfigId() const
+{
+    return configId;
+}
+
+const std::vector<Gna2AccelerationMode>& GnaBenchmark::GetAccelerationModes()
+{
+    static const std::vector<Gna2AccelerationMode> modes =
+    {
+        Gna2AccelerationModeAuto,
+        Gna2AccelerationModeSoftware,
+        Gna2AccelerationModeHardware,
+        Gna2AccelerationModeHardwareWithSoftwareFallback,
+        Gna2AccelerationModeAvx2,
+        Gna2AccelerationModeAvx1,
+        Gna2AccelerationModeSse4x2,
+        Gna2AccelerationModeGeneric,
+    };
+    return modes;
+}
+
+const char * GnaBenchmark::GetAccelerationModeName(Gna2AccelerationMode mode)
+{
+    switch (mode)
+    {
+    case Gna2AccelerationModeAuto:
+        return "auto";
+    case Gna2AccelerationModeSoftware:
+        return "software";
+    case Gna2AccelerationModeHardware:
+        return "hardware";
+    case Gna2AccelerationModeHardwareWithSoftwareFallback:
+        return "hardware-fallback";
+    case Gna2AccelerationModeAvx2:
+        return "avx2";
+    case Gna2AccelerationModeAvx1:
+        return "avx1";
+    case Gna2AccelerationModeSse4x2:
+        return "sse4.2";
+    case Gna2AccelerationModeGeneric:
+        return "generic";
+    default:
+        return "unknown";
+    }
+}
+
+bool GnaBenchmark::IsAccelerationModeSupported(Gna2AccelerationMode mode)
+{
+    static std::map<Gna2AccelerationMode, bool> supported;
+    auto const found = supported.find(mode);
+    if (found != supported.end())
+    {
+        return found->second;
+    }
+
+    SyntheticModel model;
+    model.AddCopy(model.AddTensor(Gna2ShapeInit2D(8, 16), Gna2DataTypeInt16));
+    model.Create();
+    auto isSupported = false;
+    try
+    {
+        SyntheticRequest request{ model, mode };
+        request.Run();
+        isSupported = true;
+    }
+    catch (const std::runtime_error&)
+    {
+        isSupported = false;
+    }
+    supported[mode] = isSupported;
+    return isSupported;
+}
@@ -0,0 +1,175 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "gna2-api.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace GnaBenchmark
+{
+
+struct PoolingConfig
+{
+    Gna2PoolingMode Mode = Gna2PoolingModeDisabled;
+    uint32_t WindowHeight = 1;
+    uint32_t WindowWidth = 1;
+    uint32_t StrideHeight = 1;
+    uint32_t StrideWidth = 1;
+};
+
+/**
+ Model built operation by operation from pseudo-random data.
+ Owns GNA memory of all tensors, operations and created GNA model.
+ Operation helpers take input tensor and return output tensor,
+ so consecutive operations can be chained.
+ */
+class SyntheticModel
+{
+public:
+    explicit SyntheticModel(uint32_t seed = 1);
+    ~SyntheticModel();
+
+    SyntheticModel(const SyntheticModel&) = delete;
+    SyntheticModel& operator=(const SyntheticModel&) = delete;
+
+    // Tensor allocated from GNA memory and filled with pseudo-random data
+    Gna2Tensor & AddTensor(const Gna2Shape& shape, Gna2DataType type, uint32_t prefixSize = 0);
+
+    // Monotonic piecewise-linear activation function, disabled when segmentCount is 0
+    Gna2Tensor & AddActivation(uint32_t segmentCount);
+
+    // Active list with count evenly distributed indices from [0, range), allocated from GNA memory
+    uint32_t * AddActiveList(uint32_t count, uint32_t range);
+
+    // inputs [W x N] interleaved, outputs [outputCount x N],
+    // outputs are Int32 when segmentCount is 0, Int16 otherwise
+    Gna2Tensor & AddFullyConnected(Gna2Tensor & inputs, uint32_t outputCount,
+        Gna2DataType weightType, uint32_t segmentCount);
+
+    Gna2Tensor & AddFullyConnectedBiasGrouping(Gna2Tensor & inputs, uint32_t outputCount,
+        Gna2DataType weightType, uint32_t segmentCount, uint32_t biasVectorCount);
+
+    Gna2Tensor & AddElementWiseAffine(Gna2Tensor & inputs,
+        Gna2DataType weightType, uint32_t segmentCount);
+
+    // inputs [N x W] flat, outputs [N x outputCount] flat of inputs type
+    Gna2Tensor & AddRecurrent(Gna2Tensor & inputs, uint32_t outputCount,
+        Gna2DataType weightType, uint32_t segmentCount, uint32_t delay);
+
+    Gna2Tensor & AddCopy(Gna2Tensor & inputs);
+
+    // [H x W] to [W x H]
+    Gna2Tensor & AddTransposition(Gna2Tensor & inputs);
+
+    // GNA 1.0 1D convolution, inputs [1 x W], filters [N x filterSize] each starting at 16B boundary
+    Gna2Tensor & AddConvolution1D(Gna2Tensor & inputs, uint32_t filterCount, uint32_t filterSize,
+        uint32_t stride, Gna2DataType filterType, uint32_t segmentCount, const PoolingConfig& pooling = {});
+
+    // inputs [1 x H x W x C], filters [N x H x W x C] of inputs type
+    Gna2Tensor & AddConvolution2D(Gna2Tensor & inputs, uint32_t filterCount,
+        uint32_t filterHeight, uint32_t filterWidth, Gna2DataType filterType,
+        uint32_t segmentCount, Gna2DataType outputType, const PoolingConfig& pooling = {});
+
+    // GMM feature vectors [N x W] Uint8, each vector is stored with 64B stride expected by GMM kernels
+    Gna2Tensor & AddGmmInputs(uint32_t vectorCount, uint32_t featureCount);
+
+    // inputs [N x W] Uint8 feature vectors, outputs [stateCount x N] Uint32 scores
+    Gna2Tensor & AddGmm(Gna2Tensor & inputs, uint32_t stateCount, uint32_t mixtureCount,
+        Gna2DataType inverseCovarianceType);
+
+    uint32_t GetOperationCount() const;
+
+    // Output tensor of operation, operations are indexed in order of addition
+    const Gna2Tensor & GetOperationOutput(uint32_t operationIndex) const;
+
+    /**
+     Creates GNA model from all added operations.
+     Throws std::runtime_error with model error details on failure.
+     */
+    uint32_t Create(uint32_t deviceIndex = 0);
+
+    // Releases created model, so it may be created again
+    void Release();
+
+    uint32_t GetModelId() const;
+
+private:
+    void * allocate(uint32_t size);
+
+    void randomize(void * data, uint32_t size);
+
+    Gna2Operation & addOperation();
+
+    Gna2Shape & addShape(const Gna2Shape& shape);
+
+    template<typename T>
+    T * addParameter(T value)
+    {
+        auto parameter = std::make_shared<T>(value);
+        parameters.push_back(parameter);
+        return parameter.get();
+    }
+
+    std::mt19937 generator;
+
+    std::vector<void *> memory;
+
+    std::deque<Gna2Tensor> tensors;
+
+    std::deque<Gna2Shape> shapes;
+
+    std::vector<std::shared_ptr<void>> parameters;
+
+    std::vector<Gna2Operation> operations;
+
+    uint32_t modelId = 0;
+
+    bool created = false;
+};
+
+/**
+ Request configuration of created model, released on destruction.
+ */
+class SyntheticRequest
+{
+public:
+    SyntheticRequest(const SyntheticModel& model, Gna2AccelerationMode mode);
+    ~SyntheticRequest();
+
+    SyntheticRequest(const SyntheticRequest&) = delete;
+    SyntheticRequest& operator=(const SyntheticRequest&) = delete;
+
+    void EnableActiveList(uint32_t operationIndex, uint32_t count, const uint32_t * indices);
+
+    void DisableHardwareConsistency();
+
+    uint32_t Enqueue();
+
+    // Waits for the request and returns processing status (success or saturation warning)
+    static Gna2Status Wait(uint32_t requestId);
+
+    Gna2Status Run();
+
+    uint32_t GetConfigId() const;
+
+private:
+    uint32_t configId = 0;
+};
+
+const std::vector<Gna2AccelerationMode>& GetAccelerationModes();
+
+const char * GetAccelerationModeName(Gna2AccelerationMode mode);
+
+// Verifies whether mode can execute requests in present environment, results are cached
+bool IsAccelerationModeSupported(Gna2AccelerationMode mode);
+
+}
@@ -0,0 +1,84 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "Benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <string>
+
+using namespace GnaBenchmark;
+
+static void printUsage(const char * name)
+{
+    printf("Usage: %s [options]\n"
+        "  --filter <text>       run only benchmarks which name contains <text>\n"
+        "  --min-time <ms>       minimal duration of single repetition (default 100)\n"
+        "  --repetitions <n>     number of repetitions, median is reported (default 5)\n"
+        "  --csv                 print results as CSV\n"
+        "  --list                print names of benchmark suites\n",
+        name);
+}
+
+int main(int argc, char * argv[])
+try
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        auto const hasValue = i + 1 < argc;
+        if (0 == strcmp(argv[i], "--filter") && hasValue)
+        {
+            options.Filter = argv[++i];
+        }
+        else if (0 == strcmp(argv[i], "--min-time") && hasValue)
+        {
+            options.MinTimeMilliseconds = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (0 == strcmp(argv[i], "--repetitions") && hasValue)
+        {
+            options.Repetitions = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (0 == strcmp(argv[i], "--csv"))
+        {
+            options.Csv = true;
+        }
+        else if (0 == strcmp(argv[i], "--list"))
+        {
+            for (auto const & suite : GetSuites())
+            {
+                printf("%s\n", suite.Name);
+            }
+            return 0;
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 0 == strcmp(argv[i], "--help") ? 0 : 1;
+        }
+    }
+
+    Runner runner{ options };
+    runner.PrintHeader();
+    for (auto const & suite : GetSuites())
+    {
+        try
+        {
+            suite.Run(runner);
+        }
+        catch (const std::exception& e)
+        {
+            runner.ReportFailure(suite.Name, e.what());
+        }
+    }
+    return runner.GetFailureCount() == 0 ? 0 : 1;
+}
+catch (const std::exception& e)
+{
+    fprintf(stderr, "Unhandled exception: %s\n", e.what());
+    return -1;
+}
@@ -26,8 +26,10 @@
 
 #include "gna2-inference-impl.h"
 
+#include <cstring>
 #include <map>
 #include <memory>
+#include <string>
 
 using namespace GNA;
 
@@ -50,7 +52,7 @@ using namespace GNA;
 
 template<Gna2AccelerationMode accelerationMode,
     bool isAccelerated>
-    KernelMap<VoidKernel>::allocator_type::value_type MakeSingleEntry(KernelType kernel)
+    KernelMap<VoidKernel>::Entry MakeSingleEntry(KernelType kernel)
 {
     return {
         AccelerationMode{accelerationMode},
@@ -129,8 +131,30 @@ KernelMap<VoidKernel> MakeAllGeneric()
     false, false, false>();
 }
 
+template<Gna2AccelerationMode accelerationMode>
+KernelMap<VoidKernel>::Entry MakeRelaxedEntry(KernelType kernel)
+{
+    return {
+        AccelerationMode{accelerationMode, true},
+        { GetXnnKernel<accelerationMode>(kernel) }
+    };
+}
+
+// Adds kernels not consistent with hardware, used when consistency is disabled by request config
+template<KernelType relaxedKernel>
+KernelMap<VoidKernel> WithRelaxed(KernelMap<VoidKernel> consistentKernels)
+{
+    consistentKernels.Add({
+        MakeRelaxedEntry<Gna2AccelerationModeGeneric>(relaxedKernel),
+        MakeRelaxedEntry<Gna2AccelerationModeSse4x2>(relaxedKernel),
+        MakeRelaxedEntry<Gna2AccelerationModeAvx1>(relaxedKernel),
+        MakeRelaxedEntry<Gna2AccelerationModeAvx2>(relaxedKernel),
+    });
+    return consistentKernels;
+}
+
 template<Gna2AccelerationMode mode, typename GmmKernelType>
-KernelMap<VoidKernel>::allocator_type::value_type MakeGmm(GmmKernelType kernel)
+KernelMap<VoidKernel>::Entry MakeGmm(GmmKernelType kernel)
 {
     return {
         AccelerationMode{ mode },
@@ -156,46 +180,88 @@ const KernelMap<VoidKernel>& AccelerationDetector::GetKernels(kernel_op operatio
     {
         { KERNEL_AFFINE, {
             {{Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeCompoundBias },
-                MakeAllAccelerated<affineSingle1B2Bfull, affineSingle1Bfull>()},
+                WithRelaxed<affineRelaxed1B2B>(MakeAllAccelerated<affineSingle1B2Bfull, affineSingle1Bfull>())},
             {
                 { Gna2DataTypeInt16, Gna2DataTypeInt16, Gna2DataTypeInt8 },
-                MakeAllAccelerated<affineSingle2B2Bfull, affineSingle2Bfull>()
+                WithRelaxed<affineRelaxed2B2B>(MakeAllAccelerated<affineSingle2B2Bfull, affineSingle2Bfull>())
             },
             {{ Gna2DataTypeInt8, Gna2DataTypeInt8, Gna2DataTypeInt8 },
-                MakeAVX2AndSSE4SatAccelerated<affineSingle1B1Bfull>()
+                WithRelaxed<affineRelaxed1B1B>(MakeAVX2AndSSE4SatAccelerated<affineSingle1B1Bfull>())
             },
             {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
-                MakeAVX2AndSSE4SatAccelerated<affineSingle2B1Bfull>()}
+                WithRelaxed<affineRelaxed2B1B>(MakeAVX2AndSSE4SatAccelerated<affineSingle2B1Bfull>())},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt4, Gna2DataTypeCompoundBias },
+                MakeAllAccelerated<affineSingle4b2Bfull, affineSingle4b2Bfull>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineSingle4b1Bfull, affineSingle4b1Bfull>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeUint4, Gna2DataTypeCompoundBias },
+                MakeAllAccelerated<affineSingleU4b2Bfull, affineSingleU4b2Bfull>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeUint4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineSingleU4b1Bfull, affineSingleU4b1Bfull>()},
         }},
         { KERNEL_AFFINE_AL, {
             {{ Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeCompoundBias },
-                MakeAllAccelerated<affineSingle1B2Bal, affineSingle1Bal>()},
+                WithRelaxed<affineRelaxedAl1B2B>(MakeAllAccelerated<affineSingle1B2Bal, affineSingle1Bal>())},
             {{ Gna2DataTypeInt16, Gna2DataTypeInt16, Gna2DataTypeInt8 },
-                MakeAllAccelerated<affineSingle2B2Bal, affineSingle2Bal>()},
+                WithRelaxed<affineRelaxedAl2B2B>(MakeAllAccelerated<affineSingle2B2Bal, affineSingle2Bal>())},
             {{ Gna2DataTypeInt8, Gna2DataTypeInt8, Gna2DataTypeInt8 },
-                MakeAVX2AndSSE4SatAccelerated<affineSingle1B1Bal>()},
+                WithRelaxed<affineRelaxedAl1B1B>(MakeAVX2AndSSE4SatAccelerated<affineSingle1B1Bal>())},
             {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
-                MakeAVX2AndSSE4SatAccelerated<affineSingle2B1Bal>()},
+                WithRelaxed<affineRelaxedAl2B1B>(MakeAVX2AndSSE4SatAccelerated<affineSingle2B1Bal>())},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt4, Gna2DataTypeCompoundBias },
+                MakeAllAccelerated<affineSingle4b2Bal, affineSingle4b2Bal>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineSingle4b1Bal, affineSingle4b1Bal>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeUint4, Gna2DataTypeCompoundBias },
+                MakeAllAccelerated<affineSingleU4b2Bal, affineSingleU4b2Bal>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeUint4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineSingleU4b1Bal, affineSingleU4b1Bal>()},
+        }},
+        { KERNEL_AFFINE_LARGE_BATCH, {
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeCompoundBias },
+                WithRelaxed<affineLargeBatchRelaxed1B2B>(MakeAllAccelerated<affineLargeBatch1B2B, affineLargeBatch1B2B>())},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt16, Gna2DataTypeInt8 },
+                WithRelaxed<affineLargeBatchRelaxed2B2B>(MakeAllAccelerated<affineLargeBatch2B2B, affineLargeBatch2B2B>())},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt8, Gna2DataTypeInt8 },
+                WithRelaxed<affineLargeBatchRelaxed1B1B>(MakeAllAccelerated<affineLargeBatch1B1B, affineLargeBatch1B1B>())},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
+                WithRelaxed<affineLargeBatchRelaxed2B1B>(MakeAllAccelerated<affineLargeBatch2B1B, affineLargeBatch2B1B>())},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt4, Gna2DataTypeCompoundBias },
+                MakeAllAccelerated<affineSingle4b2Bfull, affineSingle4b2Bfull>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineSingle4b1Bfull, affineSingle4b1Bfull>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeUint4, Gna2DataTypeCompoundBias },
+                MakeAllAccelerated<affineSingleU4b2Bfull, affineSingleU4b2Bfull>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeUint4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineSingleU4b1Bfull, affineSingleU4b1Bfull>()},
         }},
         { KERNEL_AFFINE_MULTIBIAS,{
             {{ Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeInt8 },
-                MakeAllAccelerated<affineMulti1B2B, affineMulti1B>()},
+                WithRelaxed<affineMultiRelaxed1B2B>(MakeAllAccelerated<affineMulti1B2B, affineMulti1B>())},
             {{ Gna2DataTypeInt16, Gna2DataTypeInt16, Gna2DataTypeInt8 },
-                MakeAllAccelerated<affineMulti2B2B, affineMulti2B>()},
+                WithRelaxed<affineMultiRelaxed2B2B>(MakeAllAccelerated<affineMulti2B2B, affineMulti2B>())},
             {{ Gna2DataTypeInt8, Gna2DataTypeInt8, Gna2DataTypeInt8 },
-                MakeAVX2AndSSE4SatAccelerated<affineMulti1B1B>()},
+                WithRelaxed<affineMultiRelaxed1B1B>(MakeAVX2AndSSE4SatAccelerated<affineMulti1B1B>())},
             {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
-                MakeAVX2AndSSE4SatAccelerated<affineMulti2B1B>()},
+                WithRelaxed<affineMultiRelaxed2B1B>(MakeAVX2AndSSE4SatAccelerated<affineMulti2B1B>())},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineMulti4b2B, affineMulti4b2B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineMulti4b1B, affineMulti4b1B>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeUint4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineMultiU4b2B, affineMultiU4b2B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeUint4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<affineMultiU4b1B, affineMultiU4b1B>()},
         }},
         { KERNEL_RECURRENT,{
             {{ Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeCompoundBias },
-                MakeAVX2AndSSE4Accelerated<recurrent1B2B, recurrent1B>()},
+                WithRelaxed<recurrentRelaxed1B2B>(MakeAVX2AndSSE4Accelerated<recurrent1B2B, recurrent1B>())},
             {{ Gna2DataTypeInt16, Gna2DataTypeInt16, Gna2DataTypeInt8 },
-                MakeAVX2AndSSE4Accelerated<recurrent2B2B, recurrent2B>()},
+                WithRelaxed<recurrentRelaxed2B2B>(MakeAVX2AndSSE4Accelerated<recurrent2B2B, recurrent2B>())},
             {{ Gna2DataTypeInt8, Gna2DataTypeInt8, Gna2DataTypeInt8 },
-                MakeAVX2AndSSE4SatAccelerated<recurrent1B1B>()},
+                WithRelaxed<recurrentRelaxed1B1B>(MakeAVX2AndSSE4SatAccelerated<recurrent1B1B>())},
             {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
-                MakeAVX2AndSSE4SatAccelerated<recurrent2B1B>()},
+                WithRelaxed<recurrentRelaxed2B1B>(MakeAVX2AndSSE4SatAccelerated<recurrent2B1B>())},
         }},
         { KERNEL_AFFINE_DIAGONAL, {
             {{ Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeCompoundBias },
@@ -203,27 +269,35 @@ const KernelMap<VoidKernel>& AccelerationDetector::GetKernels(kernel_op operatio
             {{ Gna2DataTypeInt16, Gna2DataTypeInt16, Gna2DataTypeInt8 },
                 MakeAllAccelerated<diagonal2B2B, diagonal2B>()},
             {{ Gna2DataTypeInt8, Gna2DataTypeInt8, Gna2DataTypeInt8 },
-                MakeAllGeneric<diagonal1B1B>()},
+                MakeAllAccelerated<diagonal1B1B, diagonal1B1B>()},
             {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
-                MakeAllGeneric<diagonal2B1B>()},
+                MakeAllAccelerated<diagonal2B1B, diagonal2B1B>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt4, Gna2DataTypeCompoundBias },
+                MakeAllAccelerated<diagonal4b2B, diagonal4b2B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<diagonal4b1B, diagonal4b1B>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeUint4, Gna2DataTypeCompoundBias },
+                MakeAllAccelerated<diagonalU4b2B, diagonalU4b2B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeUint4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<diagonalU4b1B, diagonalU4b1B>()},
         }},
         { KERNEL_TRANSPOSE, {
             {{ Gna2DataTypeInt8},
-                MakeAVX2AndSSE4Accelerated<transpose1B, transpose1B>()},
+                MakeAllAccelerated<transpose1B, transpose1B>()},
             {{ Gna2DataTypeInt16},
                 MakeAllAccelerated<transpose2B, transpose2B>()},
         }},
         { KERNEL_COPY,{
             {{ Gna2DataTypeInt8 },
-                MakeAllGeneric<copy1B>()},
+                MakeAllAccelerated<copy1B, copy1B>()},
             {{ Gna2DataTypeInt16 },
-                MakeAllAccelerated<copy2B, copy>()},
+                MakeAllAccelerated<copy2B, copy2B>()},
         }},
         { KERNEL_CONVOLUTIONAL, {
             {{ Gna2DataTypeInt16 },
                 MakeAllAccelerated<convolution2B, convolution>()},
             {{ Gna2DataTypeInt8 },
-                MakeAllGeneric<convolution1B>()},
+                MakeAllAccelerated<convolution1B, convolution1B>()},
         }},
         { KERNEL_CONVOLUTIONAL_2D, {
             {{ Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeInt8 },
@@ -234,12 +308,50 @@ const KernelMap<VoidKernel>& AccelerationDetector::GetKernels(kernel_op operatio
                 MakeAVX2AndSSE4SatAccelerated<convolution2D1B1B>()},
             {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
                 MakeAVX2AndSSE4SatAccelerated<convolution2D2B1B>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<convolution2D4b2B, convolution2D4b2B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<convolution2D4b1B, convolution2D4b1B>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeUint4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<convolution2DU4b2B, convolution2DU4b2B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeUint4, Gna2DataTypeInt8 },
+                MakeAllAccelerated<convolution2DU4b1B, convolution2DU4b1B>()},
+        }},
+        { KERNEL_CONVOLUTIONAL_2D_1X1, {
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D1x1_1B2B>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt16, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D1x1_2B2B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt8, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D1x1_1B1B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D1x1_2B1B>()},
+        }},
+        { KERNEL_CONVOLUTIONAL_2D_3X3, {
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D3x3_1B2B>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt16, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D3x3_2B2B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt8, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D3x3_1B1B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D3x3_2B1B>()},
+        }},
+        { KERNEL_CONVOLUTIONAL_2D_3X3_STRIDE_2, {
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt8, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D3x3Stride2_1B2B>()},
+            {{ Gna2DataTypeInt16, Gna2DataTypeInt16, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D3x3Stride2_2B2B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt8, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D3x3Stride2_1B1B>()},
+            {{ Gna2DataTypeInt8, Gna2DataTypeInt16, Gna2DataTypeInt8 },
+                MakeAVX2AndSSE4SatAccelerated<convolution2D3x3Stride2_2B1B>()},
         }},
         { KERNEL_POOLING, {
             {{ Gna2DataTypeInt16, },
                 MakeAllAccelerated<convolutionPooling2B, convolutionPooling>()},
             {{ Gna2DataTypeInt8 },
-                MakeAllGeneric<convolutionPooling1B>()},
+                MakeAllAccelerated<convolutionPooling1B, convolutionPooling1B>()},
         }},
         { KERNEL_POOLING_2D, {
             {{ Gna2DataTypeInt8 },
@@ -285,6 +397,27 @@ const KernelMap<VoidKernel>& AccelerationDetector::GetKernels(kernel_op operatio
 AccelerationDetector::AccelerationDetector()
 {
     DetectSoftwareAccelerationModes();
+    detectCpuName();
+}
+
+void AccelerationDetector::detectCpuName()
+{
+    unsigned int cpuId[4];
+    cpuid(cpuId, 0x80000000);
+    if (cpuId[0] < 0x80000004)
+    {
+        return;
+    }
+    char brand[3 * sizeof(cpuId) + 1] = {};
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        cpuid(cpuId, 0x80000002 + i);
+        memcpy(brand + i * sizeof(cpuId), cpuId, sizeof(cpuId));
+    }
+    cpuName = brand;
+    auto const first = cpuName.find_first_not_of(' ');
+    auto const last = cpuName.find_last_not_of(' ');
+    cpuName = std::string::npos == first ? std::string{} : cpuName.substr(first, last - first + 1);
 }
 
 void AccelerationDetector::DetectSoftwareAccelerationModes()
@@ -347,3 +480,8 @@ const std::vector<Gna2AccelerationMode>& AccelerationDetector::GetSupportedCpuAc
 {
     return supportedCpuAccelerations;
 }
+
+const std::string& AccelerationDetector::GetCpuName() const
+{
+    return cpuName;
+}
@@ -22,6 +22,7 @@
 #include "gna2-inference-impl.h"
 
 #include <map>
+#include <string>
 #include <vector>
 
 namespace GNA
@@ -86,6 +87,10 @@ typedef enum _kernel_op
     KERNEL_PWL,
     KERNEL_AFFINE_AL,
     KERNEL_GMM_AL,
+    KERNEL_AFFINE_LARGE_BATCH,
+    KERNEL_CONVOLUTIONAL_2D_1X1,
+    KERNEL_CONVOLUTIONAL_2D_3X3,
+    KERNEL_CONVOLUTIONAL_2D_3X3_STRIDE_2,
 
 } kernel_op;
 
@@ -104,6 +109,9 @@ public:
 
     const std::vector<Gna2AccelerationMode>& GetSupportedCpuAccelerations() const;
 
+    // CPU brand string, empty when not reported by CPU
+    const std::string& GetCpuName() const;
+
     template<typename KernelType>
     static const KernelMap<KernelType>&
     GetKernelMap(kernel_op operation, KernelMode dataMode = {Gna2DataTypeInt16})
@@ -130,9 +138,14 @@ protected:
 
 private:
     void DetectSoftwareAccelerationModes();
+
+    void detectCpuName();
+
     //sorted from slowest to fastest
     std::vector<Gna2AccelerationMode> supportedCpuAccelerations;
 
+    std::string cpuName;
+
     static const KernelMap<VoidKernel>& GetKernels(kernel_op operation, KernelMode dataMode);
 };
 
@@ -5,6 +5,7 @@
 
 #include "ActivationFunction.h"
 
+#include "AffineLayerCapabilities.h"
 #include "AffineLayers.h"
 #include "ActivationHelper.h"
 #include "AccelerationDetector.h"
@@ -125,8 +126,8 @@ ActivationFunction::ActivationFunction(const BaseTransformConfig<ActivationKerne
     Segments{ std::move(pwl) },
     Pwl{ createPwlCached(config.outputMode.Size, Segments->Buffer, Segments->Count) }
 {
-    Output = std::make_unique<OutputTensor>(config.input->Dimensions, mode, config.outputBuffer,
-        config.validator, outputCapabilities);
+    Output = std::make_unique<OutputTensor>(config.input->Dimensions, mode, config.outputBuffer, config.validator,
+        AffineLayerCapabilities::GetBatchOperands(config.validator, outputCapabilities, OutputOperandIndex));
 
     hiddenConfig = std::make_unique<KernelConfig<ActivationConfig>>(
         ActivationConfig{ Output->Count, Pwl.get() }, BaseConfig{ Input->Buffer, config.outputBuffer });
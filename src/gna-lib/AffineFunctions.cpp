@@ -52,7 +52,11 @@ std::unique_ptr<AffineFunction> AffineFunction::Create(
 std::unique_ptr<AffineFunction> AffineFunction::createAffineSingleFunction(
     const TransformFactoryConfig& config, const OperationConfig& operationConfig)
 {
-    auto const kernelOperation = operationConfig.GetKernelOperation();
+    auto kernelOperation = operationConfig.GetKernelOperation();
+    if (KERNEL_AFFINE == kernelOperation && config.input->Dimensions.at('W') > BatchSizeMax)
+    {
+        kernelOperation = KERNEL_AFFINE_LARGE_BATCH;
+    }
     auto weightTensor = operationConfig.WeightsTensor;
     auto biasTensor = operationConfig.BiasesTensor;
     auto weights = std::make_unique<const WeightTensor>(weightTensor, config.validator);
@@ -139,8 +143,8 @@ AffineFunctionSingle::AffineFunctionSingle(
 
     Output = std::make_unique<OutputTensor>(
         Shape{GNA_TENSOR_HW, config.output->Dimensions.at('H'), config.output->Dimensions.at('W')},
-        config.output->Mode, config.outputBuffer,
-        config.validator, outputCapabilities);
+        config.output->Mode, config.outputBuffer, config.validator,
+        AffineLayerCapabilities::GetBatchOperands(config.validator, outputCapabilities, OutputOperandIndex));
 
     hiddenConfig = std::make_unique<KernelConfig<AffineConfig>>(kernelAffineConfig,
             BaseConfig { Input->Buffer, Output->Buffer });
@@ -161,17 +165,18 @@ void AffineFunctionSingle::Compute(AccelerationMode accel,
     LayerConfiguration const * layerConfiguration, ExecutionConfig const & execution) const
 {
     auto executionConfig = createExecutionConfig(layerConfiguration, execution);
+    setSoftwareScratchPad(*executionConfig);
     try
     {
         if (layerConfiguration != nullptr && layerConfiguration->ActList)
         {
-            kernelsAl.at(accel)(executionConfig.get(), AffineConfigAl{
+            kernelsAl.Get(accel)(executionConfig.get(), AffineConfigAl{
                                 layerConfiguration->ActList->Indices,
                                 layerConfiguration->ActList->IndicesCount});
         }
         else
         {
-            kernels->at(accel)(executionConfig.get());
+            kernels->Get(accel)(executionConfig.get());
         }
     }
     catch (const std::out_of_range&)
@@ -181,4 +181,56 @@ const FullCapabilitiesMap& AffineLayerCapabilities::GetOperands(uint32_t operand
     return operands.at(operandIndex);
 }
 
-}
\ No newline at end of file
+const FullCapabilitiesMap& AffineLayerCapabilities::GetLargeBatchOperands(uint32_t operandIndex)
+{
+    static const ComponentFullCapabilityMap operands =
+    {
+        {InputOperandIndex,{
+            {INTEL_AFFINE, {
+                LayerCaps::Make<Gna2DeviceGeneration3_0>(
+                    {GNA_TENSOR_HW},
+                    {{GNA_DIM_H, MakeLimitsMulti<LegacyInputs, InputOperandIndex>()},
+                    {GNA_DIM_W, MakeLimits<InputGroupMaxLargeBatch, InputOperandIndex>()}},
+                    GetCommonModes(InputOperandIndex, Gna2DeviceGeneration3_0)),
+            }},
+        }},
+        {OutputOperandIndex,{
+            {INTEL_AFFINE, {
+                LayerCaps::Make<Gna2DeviceGeneration3_0>(
+                    {GNA_TENSOR_HW},
+                    {{GNA_DIM_H, MakeLimits<Input, OutputOperandIndex>()},
+                    {GNA_DIM_W, MakeLimits<InputGroupMaxLargeBatch, OutputOperandIndex>()}},
+                    GetCommonModes(OutputOperandIndex, Gna2DeviceGeneration3_0)),
+            }},
+        }},
+    };
+
+    return operands.at(operandIndex);
+}
+
+const FullCapabilitiesMap& AffineLayerCapabilities::GetSoftwareOnlyWeightOperands()
+{
+    static const auto modes = DataModeLimits{
+        { Gna2DataTypeInt4, Gna2DataTypeUint4, Gna2DataTypeInt8, Gna2DataTypeInt16 },
+        GetError<WeightOperandIndex>().second };
+    static const auto matrix = std::vector<uint32_t>{
+        Input[0], Input[1], Input[2], WeightMultiplier[0], WeightMultiplier[1], WeightMultiplier[2] };
+    static const auto diagonal = std::vector<uint32_t>{
+        WeightMultiplier[0], WeightMultiplier[1], WeightMultiplier[2] };
+    static const FullCapabilitiesMap operands =
+    {
+        {INTEL_AFFINE, {
+            LayerCaps::MakeCaps<Gna2DeviceGeneration3_0, GNA_TENSOR_HW, WeightOperandIndex>(matrix, modes),
+        }},
+        {INTEL_AFFINE_DIAGONAL, {
+            LayerCaps::MakeCaps<Gna2DeviceGeneration3_0, GNA_TENSOR_H, WeightOperandIndex>(diagonal, modes),
+        }},
+        {INTEL_AFFINE_MULTIBIAS, {
+            LayerCaps::MakeCaps<Gna2DeviceGeneration3_0, GNA_TENSOR_HW, WeightOperandIndex>(matrix, modes),
+        }},
+    };
+
+    return operands;
+}
+
+}
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "LayerCapabilities.h"
+#include "Validator.h"
 
 namespace GNA
 {
@@ -13,6 +14,47 @@ namespace GNA
 struct AffineLayerCapabilities : LayerCapabilities
 {
     static const FullCapabilitiesMap& GetOperands(uint32_t operandIndex);
+
+    /**
+     Gets input or output capabilities of fully connected affine
+     with grouping limit relaxed to LargeBatchSizeMax for software only models.
+     */
+    static const FullCapabilitiesMap& GetLargeBatchOperands(uint32_t operandIndex);
+
+    /**
+     Selects large batch capabilities when enabled by validator
+     for fully connected affine, otherwise returns capabilities.
+     */
+    static const FullCapabilitiesMap& GetBatchOperands(const LayerValidator& validator,
+        const FullCapabilitiesMap& capabilities, uint32_t operandIndex)
+    {
+        if (validator.IsSoftwareOnly && INTEL_AFFINE == validator.Operation)
+        {
+            return GetLargeBatchOperands(operandIndex);
+        }
+        return capabilities;
+    }
+
+    /**
+     Gets weight capabilities of affine operations
+     with 4-bit weights allowed for software only models.
+     */
+    static const FullCapabilitiesMap& GetSoftwareOnlyWeightOperands();
+
+    /**
+     Selects software only weight capabilities when enabled by validator
+     for affine operations, otherwise returns capabilities.
+     */
+    static const FullCapabilitiesMap& GetWeightOperands(const LayerValidator& validator,
+        const FullCapabilitiesMap& capabilities)
+    {
+        if (validator.IsSoftwareOnly && (INTEL_AFFINE == validator.Operation
+            || INTEL_AFFINE_DIAGONAL == validator.Operation || INTEL_AFFINE_MULTIBIAS == validator.Operation))
+        {
+            return GetSoftwareOnlyWeightOperands();
+        }
+        return capabilities;
+    }
 };
 
 }
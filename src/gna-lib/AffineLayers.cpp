@@ -47,16 +47,31 @@ void AffineBaseLayer::RelaseGlobal2MBScrachpad()
     scratchPad = nullptr;
 }
 
+bool AffineBaseLayer::IsLargeBatch(const Gna2Operation& operation, const LayerValidator& validatorIn)
+{
+    if (!validatorIn.IsSoftwareOnly || INTEL_AFFINE != validatorIn.Operation)
+    {
+        return false;
+    }
+    auto const output = ModelWrapper::GetOperand(operation, OutputOperandIndex);
+    return output.Shape.NumberOfDimensions > 1 && output.Shape.Dimensions[1] > BatchSizeMax;
+}
+
 AffineBaseLayer::AffineBaseLayer(
         const Gna2Operation& operation,
         const std::vector<TransformOperation> transforms,
         const LayerValidator& validatorIn) :
-    Layer(operation, validatorIn, transforms, BaseAddress(LayerOutput::getScratchpadForOperation(validatorIn.Operation)))
+    Layer(operation, validatorIn, transforms, BaseAddress(LayerOutput::getScratchpadForOperation(operation, validatorIn)))
 {
 }
 
 void AffineLayer::UpdateKernelConfigs(LayerConfiguration& layerConfiguration) const
 {
+    if (layerConfiguration.ActList)
+    {
+        // active list kernels support hardware grouping only
+        Expect::InRange(Input.Grouping, 1u, BatchSizeMax, Gna2StatusXnnErrorGrouping);
+    }
     AffineBaseLayer::UpdateKernelConfigs(layerConfiguration);
     auto const activation = Transforms.GetOptional<ActivationFunction>(ActivationTransform);
     if (activation)
@@ -86,7 +101,13 @@ Tensor const & AffineBaseLayer::GetOperand(uint32_t operandIndex) const
     switch (operandIndex)
     {
     case ScratchpadOperandIndex:
-        if (!dataConfig.IsActivationDisabled)
+        if (!dataConfig.IsActivationDisabled && Output.ScratchPad.Buffer)
+        {
+            return Output.ScratchPad;
+        }
+        throw GnaException(Gna2StatusXnnErrorLyrCfg);
+    case SoftwareScratchpadOperandIndex:
+        if (!dataConfig.IsActivationDisabled && !Output.ScratchPad.Buffer)
         {
             return Output.ScratchPad;
         }
@@ -26,6 +26,9 @@ public:
     static void *GetGlobal2MBScratchpad();
     static void RelaseGlobal2MBScrachpad();
 
+    // Whether fully connected affine grouping exceeds BatchSizeMax, allowed only for software only models
+    static bool IsLargeBatch(const Gna2Operation& operation, const LayerValidator& validatorIn);
+
 protected:
     AffineBaseLayer(
             const Gna2Operation& operation, std::vector<TransformOperation> transforms,
@@ -18,6 +18,9 @@ namespace GNA
 /** Number of input groups constraint - max */
 constexpr auto BatchSizeMax = uint32_t{ 8 };
 
+/** Number of input groups constraint of software only large batch fully connected affine - max */
+constexpr auto LargeBatchSizeMax = uint32_t{ 1024 };
+
 class LayerValidator;
 struct ComponentLimits;
 
@@ -16,6 +16,8 @@
 #include "Layer.h"
 #include "Logger.h"
 #include "Memory.h"
+#include "ModelError.h"
+#include "PartitionCostModel.h"
 #include "Request.h"
 #include "RequestConfiguration.h"
 
@@ -77,26 +79,70 @@ Memory const * CompiledModel::GetMemoryIfNotPartOfModel(const void *buffer, size
 Gna2Status CompiledModel::Score(
     RequestConfiguration& config,
     RequestProfiler &profiler,
-    KernelBuffers *buffers)
+    KernelBuffers *buffers,
+    std::atomic<bool> const * cancellation)
 {
-    auto context = ScoreContext{ 0, LayerCount, config, profiler, buffers };
+    auto context = ScoreContext{ 0, LayerCount, config, profiler, buffers, cancellation };
+    auto const start = std::chrono::steady_clock::now();
+    auto status = Gna2StatusSuccess;
     try
     {
         profiler.Measure(Gna2InstrumentationPointLibProcessing);
         score(context);
         profiler.Measure(Gna2InstrumentationPointLibCompletion);
+        status = context.saturationCount > 0 ? Gna2StatusWarningArithmeticSaturation : Gna2StatusSuccess;
     }
     catch (const GnaException& e)
     {
-        return e.GetStatus();
+        status = e.GetStatus();
     }
     catch (...)
     {
         Log->Error("Unknown Exception in CompiledModel::Score()\n");
-        return Gna2StatusUnknownError;
+        status = Gna2StatusUnknownError;
     }
-    return context.saturationCount > 0 ? Gna2StatusWarningArithmeticSaturation : Gna2StatusSuccess;
+    addScoredRequest(context, status, start);
+    return status;
 }
+
+bool CompiledModel::ScoreBatch(std::vector<ScoreContext> & contexts)
+{
+    for (auto & context : contexts)
+    {
+        context.profiler.Measure(Gna2InstrumentationPointLibProcessing);
+    }
+    auto const start = std::chrono::steady_clock::now();
+    try
+    {
+        if (!scoreBatch(contexts))
+        {
+            return false;
+        }
+    }
+    catch (...)
+    {
+        // requests scored one by one report their own statuses
+        return false;
+    }
+    for (auto & context : contexts)
+    {
+        context.profiler.Measure(Gna2InstrumentationPointLibCompletion);
+        // each request of batch takes time of whole batch
+        addScoredRequest(context,
+            context.saturationCount > 0 ? Gna2StatusWarningArithmeticSaturation : Gna2StatusSuccess, start);
+    }
+    return true;
+}
+
+void CompiledModel::addScoredRequest(ScoreContext const & context, Gna2Status status,
+    std::chrono::steady_clock::time_point start)
+{
+    auto const executionTime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+    statistics.AddScored(status, executionTime, context.driverTime, context.isFallback);
+    context.requestConfiguration.Statistics.AddScored(status, executionTime, context.driverTime, context.isFallback);
+}
+
 void CompiledModel::InvalidateRequestConfig(uint32_t configId) const
 {
     invalidateRequestConfig(configId);
@@ -113,22 +159,42 @@ bool CompiledModel::IsHardwareEnforcedModeValid()
 }
 
 CompiledModel::CompiledModel(const ApiModel & model, const AccelerationDetector& detectorIn, const HardwareCapabilities& hwCapabilitiesIn,
-    Gna2DeviceVersion softwareModelVersion) :
-    LayerCount{ GetNumberOfOperations(model, softwareModelVersion) },
+    const PartitionCostModel& costModelIn, Gna2DeviceVersion softwareModelVersionIn, bool isSoftwareModelDeferred) :
+    LayerCount{ GetNumberOfOperations(model, softwareModelVersionIn) },
     GmmCount{ getGmmCount(GetFirstOperation(model), LayerCount) },
     detector{ detectorIn },
     hwCapabilities{ hwCapabilitiesIn },
+    costModel{ costModelIn },
     apiModel{ model },
-    softwareModel
+    softwareModelVersion{ softwareModelVersionIn }
+{
+    expectOutputsWritable();
+    if (!isSoftwareModelDeferred)
     {
-        apiModel,
-        makeValidator(HardwareCapabilities::GetDeviceGeneration(softwareModelVersion)),
-        detector.GetSupportedCpuAccelerations()
+        buildSoftwareModel();
+    }
+}
+
+void CompiledModel::buildSoftwareModel()
+{
+    if (softwareModel)
+    {
+        return;
     }
+    softwareModel = std::make_unique<SoftwareModel>(
+        apiModel,
+        makeSoftwareModelValidator(),
+        detector.GetSupportedCpuAccelerations());
+    Expect::NotNull(softwareModel, Gna2StatusResourceAllocationError);
+}
+
+BaseValidator CompiledModel::makeSoftwareModelValidator()
 {
+    return makeValidator(HardwareCapabilities::GetDeviceGeneration(softwareModelVersion),
+        Gna2DeviceVersionSoftwareEmulation == softwareModelVersion);
 }
 
-BaseValidator CompiledModel::makeValidator(Gna2DeviceGeneration generation)
+BaseValidator CompiledModel::makeValidator(Gna2DeviceGeneration generation, bool isSoftwareOnly)
 {
     return BaseValidator
     {
@@ -138,10 +204,56 @@ BaseValidator CompiledModel::makeValidator(Gna2DeviceGeneration generation)
             {
                 VerifyBufferAndStoreMemory(buffer, bufferSize, alignment);
             }
-        }
+        },
+        isSoftwareOnly
     };
 }
 
+std::vector<Gna2ModelPartition> CompiledModel::getSoftwarePartitions() const
+{
+    uint64_t cost = 0;
+    for (auto const & layer : GetLayers())
+    {
+        cost += costModel.GetSoftwareCost(*layer);
+    }
+    return { { 0, LayerCount, Gna2PartitionTargetSoftware, cost } };
+}
+
+void CompiledModel::expectOutputsWritable() const
+{
+    for (uint32_t i = 0; i < LayerCount && nullptr != apiModel.Operations; i++)
+    {
+        auto const & operation = apiModel.Operations[i];
+        if (nullptr == operation.Operands || operation.NumberOfOperands <= OutputOperandIndex)
+        {
+            continue;
+        }
+        auto const output = operation.Operands[OutputOperandIndex];
+        if (nullptr != output && nullptr != output->Data && DeviceManager::Get().IsReadOnlyMemory(output->Data))
+        {
+            auto error = ModelError{ Gna2ErrorTypeArgumentInvalid, reinterpret_cast<int64_t>(output->Data),
+                ModelItem{ Gna2ItemTypeOperandData, OutputOperandIndex } };
+            error.Source.OperationIndex = static_cast<int32_t>(i);
+            ModelErrorHelper::SaveLastError(error);
+            throw GnaException(Gna2StatusMemoryBufferInvalid);
+        }
+    }
+}
+
+bool CompiledModel::isUsingReadOnlyMemory(uint32_t layerIndex) const
+{
+    auto const & operation = apiModel.Operations[layerIndex];
+    for (uint32_t i = 0; i < operation.NumberOfOperands; i++)
+    {
+        auto const operand = operation.Operands[i];
+        if (nullptr != operand && nullptr != operand->Data && DeviceManager::Get().IsReadOnlyMemory(operand->Data))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 Memory const & CompiledModel::getMemoryFromDeviceAllocations(const void *buffer, size_t bufferSize) const
 {
     const auto& allAllocations = DeviceManager::Get().GetAllAllocated();
@@ -7,6 +7,8 @@
 
 #include "AccelerationDetector.h"
 #include "MemoryContainer.h"
+#include "PartitionCostModel.h"
+#include "RequestStatistics.h"
 #include "SoftwareModel.h"
 #include "Validator.h"
 
@@ -14,6 +16,7 @@
 #include "gna2-common-api.h"
 #include "gna2-model-api.h"
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -69,7 +72,29 @@ public:
     Gna2Status Score(
         RequestConfiguration& config,
         RequestProfiler &profiler,
-        KernelBuffers *buffers);
+        KernelBuffers *buffers,
+        std::atomic<bool> const * cancellation = nullptr);
+
+    // Whether request may be scored coalesced with other requests for this model
+    bool IsBatchable(RequestConfiguration const & config) const
+    {
+        return isBatchable(config);
+    }
+
+    // Scores requests for this model coalesced into single grouped execution,
+    // returns false when requests have to be scored one by one
+    bool ScoreBatch(std::vector<ScoreContext> & contexts);
+
+    // Size in bytes of scratch needed by each scoring thread to score batch of batchSize requests
+    uint32_t GetBatchScratchSize(uint32_t batchSize) const
+    {
+        return GetSoftwareModel().GetBatchScratchSize(batchSize);
+    }
+
+    void EnableKernelTuning(KernelTuner & tuner)
+    {
+        GetSoftwareModel().EnableKernelTuning(tuner);
+    }
 
     MemoryContainer const & GetAllocations() const
     {
@@ -82,6 +107,18 @@ public:
 
     bool IsHardwareEnforcedModeValid();
 
+    // Partitions of model processed by device, single software partition when processed in software only
+    std::vector<Gna2ModelPartition> GetPartitions()
+    {
+        return getPartitions();
+    }
+
+    // Statistics of requests of all configurations of this model
+    RequestStatistics & GetStatistics()
+    {
+        return statistics;
+    }
+
     const uint32_t LayerCount;
     const uint32_t GmmCount;
 
@@ -90,9 +127,17 @@ protected:
         const ApiModel & model,
         const AccelerationDetector& detectorIn,
         const HardwareCapabilities& hwCapabilitiesIn,
-        Gna2DeviceVersion softwareModelVersion);
+        const PartitionCostModel& costModelIn,
+        Gna2DeviceVersion softwareModelVersionIn,
+        bool isSoftwareModelDeferred = false);
+
+    // Builds software model with softwareModelVersion limitations if not built yet
+    void buildSoftwareModel();
+
+    BaseValidator makeValidator(Gna2DeviceGeneration generation, bool isSoftwareOnly = false);
 
-    BaseValidator makeValidator(Gna2DeviceGeneration generation);
+    // Validator with softwareModelVersion limitations, used for operations scored only in software
+    BaseValidator makeSoftwareModelValidator();
 
     static uint32_t GetNumberOfOperations(const Gna2Model& model, Gna2DeviceVersion softwareModelVersion)
     {
@@ -126,37 +171,65 @@ protected:
 
     Memory const & getMemoryFromDeviceAllocations(const void *buffer, size_t bufferSize) const;
 
+    // Whether any operand of operation is in read-only registered memory, not accessible by device
+    bool isUsingReadOnlyMemory(uint32_t layerIndex) const;
+
+    // Single partition of all operations processed in software
+    std::vector<Gna2ModelPartition> getSoftwarePartitions() const;
+
     const AccelerationDetector& detector;
 
     const HardwareCapabilities& hwCapabilities;
 
+    // copy of device cost model at the time of model creation, as partitions are not rebuilt
+    const PartitionCostModel costModel;
+
     MemoryContainer allocations;
 
     const ApiModel & apiModel;
 
     virtual SoftwareModel & GetSoftwareModel()
     {
-        return softwareModel;
+        return *softwareModel;
     }
 
     virtual SoftwareModel const & GetSoftwareModel() const
     {
-        return softwareModel;
+        return *softwareModel;
     }
 
+    const Gna2DeviceVersion softwareModelVersion;
+
     // Software only model, built with latest/relaxed limitations
+    // including large batch when built for software emulation
     // used for Software scoring only
     // not used with hardware model (actually some common properties may be used)
-    SoftwareModel softwareModel;
+    // may be deferred by derived models and not built at all when not needed
+    std::unique_ptr<SoftwareModel> softwareModel;
 
 private:
+    // Rejects outputs placed in read-only registered memory, as outputs are written by GNA
+    void expectOutputsWritable() const;
+
+    // Records scored request in statistics of model and request configuration
+    void addScoredRequest(ScoreContext const & context, Gna2Status status,
+        std::chrono::steady_clock::time_point start);
+
+    RequestStatistics statistics;
+
     virtual void score(ScoreContext & context) = 0;
 
+    virtual bool isBatchable(RequestConfiguration const & config) const = 0;
+
+    virtual bool scoreBatch(std::vector<ScoreContext> & contexts) = 0;
+
     virtual void invalidateRequestConfig(uint32_t configId) const = 0;
 
     virtual void validateBuffer(MemoryContainer const & requestAllocations, Memory const & memory) const = 0;
 
     virtual bool isFullyHardwareCompatible() = 0;
+
+    virtual std::vector<Gna2ModelPartition> getPartitions() = 0;
 };
 
 }
@@ -106,14 +106,14 @@ void ConvolutionFunction::ComputeHidden(AccelerationMode accel, ExecutionConfig
 {
     auto convConfig = ConvolutionConfig{hiddenConfig.get(), execution};
 
-    kernels.at(accel)(&convConfig);
+    kernels.Get(accel)(&convConfig);
 }
 
 void ConvolutionFunction::Compute(const ConvolutionConfig* const config, AccelerationMode accel, ExecutionConfig const & execution) const
 {
     auto convConfig = ConvolutionConfig{ config, execution };
 
-    kernels.at(accel)(&convConfig);
+    kernels.Get(accel)(&convConfig);
 }
 
 std::unique_ptr<const ConvolutionFunction> ConvolutionFunction::finalizeCreation(
@@ -64,12 +64,41 @@ std::unique_ptr<ConvolutionFunction2D> ConvolutionFunction2D::create(
     auto biases = CreateBiasTensor(biasTensor, biasMode, filters->Count,
         outputDims, config.validator);
 
+    auto const kernelOperation = getKernelOperation(*filters, *stride, *padding);
     return std::make_unique<ConvolutionFunction2D>(BaseTransformConfig<ConvolutionKernel2D>{config,
         AccelerationDetector::GetKernelMap<ConvolutionKernel2D>(
-            KERNEL_CONVOLUTIONAL_2D, { config.input->Mode, filters->Mode, (biases ? biases->Mode : DataMode{}) })},
+            kernelOperation, { config.input->Mode, filters->Mode, (biases ? biases->Mode : DataMode{}) })},
         move(filters), move(biases), move(stride), move(padding));
 }
 
+kernel_op ConvolutionFunction2D::getKernelOperation(FiltersTensor const & filters,
+    Component const & stride, Component const & padding)
+{
+    // 4-bit filters are supported only by generic geometry kernels
+    if (Gna2DataTypeInt4 == filters.Mode.Type || Gna2DataTypeUint4 == filters.Mode.Type
+        || 0 != padding.at(GNA_DIM_H) || 0 != padding.at(GNA_DIM_W)
+        || filters.at(GNA_DIM_H) != filters.at(GNA_DIM_W)
+        || stride.at(GNA_DIM_H) != stride.at(GNA_DIM_W))
+    {
+        return KERNEL_CONVOLUTIONAL_2D;
+    }
+    auto const filterSize = filters.at(GNA_DIM_W);
+    auto const strideSize = stride.at(GNA_DIM_W);
+    if (1 == filterSize && 1 == strideSize)
+    {
+        return KERNEL_CONVOLUTIONAL_2D_1X1;
+    }
+    if (3 == filterSize && 1 == strideSize)
+    {
+        return KERNEL_CONVOLUTIONAL_2D_3X3;
+    }
+    if (3 == filterSize && 2 == strideSize)
+    {
+        return KERNEL_CONVOLUTIONAL_2D_3X3_STRIDE_2;
+    }
+    return KERNEL_CONVOLUTIONAL_2D;
+}
+
 Shape ConvolutionFunction2D::CalculateBiasShape(const Gna2BiasMode mode, const uint32_t filterCount, Shape const & outputShape)
 {
     switch (mode)
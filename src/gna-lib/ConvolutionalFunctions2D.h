@@ -48,6 +48,10 @@ protected:
         const TransformFactoryConfig & config,
         const OperationConfig& operationConfig);
 
+    // Selects kernels specialized for filter geometry when layer has no zero padding
+    static kernel_op getKernelOperation(FiltersTensor const & filters,
+        Component const & stride, Component const & padding);
+
     static Shape CalculateBiasShape(Gna2BiasMode mode, uint32_t filterCount, Shape const & outputShape);
 
     static std::unique_ptr<const BiasTensor> CreateBiasTensor(
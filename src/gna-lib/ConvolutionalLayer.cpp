@@ -109,6 +109,11 @@ Tensor const & CnnLayer::GetOperand(uint32_t operandIndex) const
     }
 }
 
+uint64_t CnnLayer::GetMultiplyAccumulateCount() const
+{
+    return uint64_t{ Convolution->Filters->Count } * Convolution->OutputsPerFilterCount;
+}
+
 void CnnLayer::UpdateKernelConfigs(LayerConfiguration& layerConfiguration) const
 {
     Layer::UpdateKernelConfigs(layerConfiguration);
@@ -35,6 +35,8 @@ public:
 
     virtual Tensor const & GetOperand(uint32_t operandIndex) const override;
 
+    virtual uint64_t GetMultiplyAccumulateCount() const override;
+
 protected:
     void Init();
 
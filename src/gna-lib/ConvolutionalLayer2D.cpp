@@ -13,17 +13,22 @@
 #include "HardwareCapabilities.h"
 #include "HardwareLayer.h"
 #include "KernelArguments.h"
+#include "LayerConfiguration.h"
 #include "LayerInput.h"
 #include "LayerOutput.h"
 #include "PoolingFunctions2D.h"
 #include "Tensor.h"
+#include "ThreadPool.h"
 #include "Transform.h"
 #include "TransformMap.h"
 #include "Validator.h"
 
+#include "gna2-memory-impl.h"
+
 #include <algorithm>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 using namespace GNA;
 
@@ -47,6 +52,106 @@ void ConvolutionalLayer2D::Init()
     const auto biasMode = convolutionTransform.Biases->Mode;
     auto const activation = Transforms.GetOptional<ActivationFunction>(ActivationTransform);
     dataConfig = { Input.Mode, filterMode, biasMode, Output.Mode, activation == nullptr };
+
+    if (nullptr != Transforms.GetOptional(PoolingTransform2D))
+    {
+        ComputeHidden = [this](AccelerationMode accel, ExecutionConfig const & executionConfig)
+        {this->computeFused(nullptr, accel, executionConfig); };
+
+        Compute = [this](LayerConfiguration &layerConfiguration,
+            AccelerationMode accel,
+            ExecutionConfig const & executionConfig)
+        {this->computeFused(&layerConfiguration, accel, executionConfig); };
+    }
+}
+
+void ConvolutionalLayer2D::computeFused(LayerConfiguration const * layerConfiguration,
+    AccelerationMode accel, ExecutionConfig const & execution) const
+{
+    // profiling of single transforms and scratch pad provided by user require transforms computed one by one
+    if (nullptr != execution.Profiler || nullptr == execution.Intermediate
+        || (nullptr != layerConfiguration && layerConfiguration->Buffers.count(ScratchpadOperandIndex) > 0))
+    {
+        compute(layerConfiguration, accel, execution);
+        return;
+    }
+
+    auto const & convolution = Transforms.Get<ConvolutionFunction2D>(ConvolutionalTransform2D);
+    auto const * const activation = Transforms.GetOptional<ActivationFunction>(ActivationTransform);
+    auto const & pooling = Transforms.Get<PoolingFunction2D>(PoolingTransform2D);
+
+    auto const & convolutionConfig = convolution.GetKernelConfig(layerConfiguration);
+    auto const & poolingConfig = pooling.GetKernelConfig(layerConfiguration);
+    auto const & poolingTransform = poolingConfig.Transform;
+
+    auto const rowCount = convolution.Output->at(GNA_DIM_H);
+    auto const rowElementCount = convolution.Output->at(GNA_DIM_W) * convolution.Output->at(GNA_DIM_D);
+    auto const pooledRowCount = pooling.Output->at(GNA_DIM_H);
+    auto const pooledRowSize = pooling.Output->at(GNA_DIM_W) * pooling.Output->at(GNA_DIM_D)
+        * pooling.Output->Mode.Size;
+
+    auto const * const threadPool = execution.Intermediate->threadPool;
+    auto const bandHeight = getFusedBandHeight(nullptr != threadPool ? threadPool->GetNumberOfThreads() : 1);
+    auto const bandCount = GnaCeilDiv(pooledRowCount, bandHeight);
+    auto saturationCounts = std::vector<uint32_t>(bandCount, 0);
+
+    auto const computeBand = [&](uint32_t band, KernelBuffers * buffers)
+    {
+        auto const pooledRowFirst = band * bandHeight;
+        auto const pooledRowEnd = (std::min)(pooledRowFirst + bandHeight, pooledRowCount);
+        auto const rowFirst = pooledRowFirst * poolingTransform.StrideHeight;
+        auto const rowEnd = (std::min)(rowCount,
+            (pooledRowEnd - 1) * poolingTransform.StrideHeight + poolingTransform.WindowHeight);
+        auto const bandExecution = ExecutionConfig{ buffers, &saturationCounts.at(band), execution.BufferElementCount };
+        auto * const intermediate = buffers->cnnFusedBuffer;
+
+        auto convolutionBand = convolutionConfig;
+        convolutionBand.Transform.OutputRowFirst = rowFirst;
+        convolutionBand.Transform.OutputRowCount = rowEnd - rowFirst;
+        convolutionBand.SetBuffer(OutputOperandIndex, intermediate);
+        convolution.ComputePart(accel, convolutionBand, bandExecution);
+
+        if (nullptr != activation)
+        {
+            // activated outputs overwrite convolution outputs in place, as when computed separately
+            auto activationBand = activation->GetKernelConfig(layerConfiguration);
+            activationBand.Transform.ElementCount = (rowEnd - rowFirst) * rowElementCount;
+            activationBand.SetBuffer(InputOperandIndex, intermediate);
+            activationBand.SetBuffer(OutputOperandIndex, intermediate);
+            activation->ComputePart(accel, activationBand, bandExecution);
+        }
+
+        auto const poolingBand = KernelConfig<PoolingConfig2D>{
+            PoolingConfig2D{ poolingTransform.InputWidth, rowEnd - rowFirst, poolingTransform.InputDepth,
+                poolingTransform.Mode, poolingTransform.StrideWidth, poolingTransform.StrideHeight,
+                poolingTransform.WindowWidth, poolingTransform.WindowHeight },
+            BaseConfig{ intermediate, poolingConfig.Outputs + pooledRowFirst * pooledRowSize } };
+        pooling.ComputePart(accel, poolingBand, bandExecution);
+    };
+    ThreadPool::Parallelize(execution.Intermediate, bandCount, computeBand);
+
+    for (auto const saturationCount : saturationCounts)
+    {
+        *execution.SaturationCount += saturationCount;
+    }
+}
+
+uint32_t ConvolutionalLayer2D::getFusedBandHeight(uint32_t threadCount) const
+{
+    auto const & convolution = Transforms.Get<ConvolutionFunction2D>(ConvolutionalTransform2D);
+    auto const & pooling = Transforms.Get<PoolingFunction2D>(PoolingTransform2D);
+    auto const rowSize = convolution.Output->at(GNA_DIM_W) * convolution.Output->at(GNA_DIM_D)
+        * convolution.Output->Mode.Size;
+    auto const windowHeight = pooling.Window->at(GNA_DIM_H);
+    auto const strideHeight = pooling.Stride->at(GNA_DIM_H);
+    auto const pooledRowCount = pooling.Output->at(GNA_DIM_H);
+
+    // windows of consecutive bands overlap, thus overlapping convolution rows are computed twice
+    auto const rowsInCache = (std::max)(FusedBandSizeMax / rowSize, 1u);
+    auto bandHeight = rowsInCache > windowHeight ? (rowsInCache - windowHeight) / strideHeight + 1 : 1;
+    // at least one band per thread
+    bandHeight = (std::min)(bandHeight, GnaCeilDiv(pooledRowCount, threadCount));
+    return (std::max)(bandHeight, 1u);
 }
 
 void ConvolutionalLayer2D::Validate3_0ExtraLimits() const
@@ -71,7 +176,11 @@ void ConvolutionalLayer2D::Validate3_0ExtraLimits() const
         auto const pooling = Transforms.GetOptional<PoolingFunction2D>(PoolingTransform2D);
         auto const & filter = GetInputTransform().GetOperand(FilterOperandIndex);
         ModelErrorHelper::ExpectEqual(filter.Mode.Mode, Input.Mode.Mode, ModelItem{ Gna2ItemTypeOperandMode, FilterOperandIndex });
-        ModelErrorHelper::ExpectEqual(filter.Mode.Type, Input.Mode.Type, ModelItem{ Gna2ItemTypeOperandType, FilterOperandIndex });
+        // 4-bit filters of software only models are used with inputs of any precision
+        if (Gna2DataTypeInt4 != filter.Mode.Type && Gna2DataTypeUint4 != filter.Mode.Type)
+        {
+            ModelErrorHelper::ExpectEqual(filter.Mode.Type, Input.Mode.Type, ModelItem{ Gna2ItemTypeOperandType, FilterOperandIndex });
+        }
         if (activation)
         {
             ModelErrorHelper::ExpectEqual(Output.Mode.Mode, Input.Mode.Mode, ModelItem{ Gna2ItemTypeOperandMode, OutputOperandIndex, });
@@ -30,6 +30,17 @@ public:
 protected:
     void Init();
     void Validate3_0ExtraLimits() const;
+
+private:
+    // Computes convolution, activation and pooling band by band of pooled output rows,
+    // so intermediate outputs of band stay in cache, bands are computed in parallel
+    void computeFused(LayerConfiguration const * layerConfiguration,
+        AccelerationMode accel, ExecutionConfig const & execution) const;
+
+    uint32_t getFusedBandHeight(uint32_t threadCount) const;
+
+    // Size of intermediate convolution outputs of single band
+    static constexpr uint32_t FusedBandSizeMax = 256 * 1024;
 };
 
 }
@@ -85,6 +85,33 @@ static auto MakeBiasCaps(const std::vector<uint32_t>& limits)
         ComponentCaps<BiasOperandIndex, operation>::GetModes());
 }
 
+// Filter limits of 2D convolution, shared by hardware and software only capabilities
+static const std::vector<uint32_t>& getFilter2DLimits3_0()
+{
+    using Caps = ConvolutionalLayer2DCapabilities;
+    static const std::vector<uint32_t> limits =
+    {
+        8, 1024, 8,
+        Caps::Filter2DElementsMin, 7, Caps::Filter2DElementsMin,
+        Caps::Filter2DElementsMin, 7, Caps::Filter2DElementsMin, //New limitations for ADL 2D CNN
+        Caps::Filter2DElementsMin, Caps::Filter2DDepthMax, Caps::Filter2DElementsMin,
+    };
+    return limits;
+}
+
+static const std::vector<uint32_t>& getFilter2DLimits3_1()
+{
+    using Caps = ConvolutionalLayer2DCapabilities;
+    static const std::vector<uint32_t> limits =
+    {
+        Caps::Filter2DElementsMin, 1024, Caps::Filter2DElementsMin,
+        Caps::Filter2DElementsMin, Caps::Filter2DElementsMax, Caps::Filter2DElementsMin,
+        Caps::Filter2DElementsMin, Caps::Filter2DElementsMax, Caps::Filter2DElementsMin,
+        Caps::Filter2DElementsMin, Caps::Filter2DDepthMax, Caps::Filter2DElementsMin,
+    };
+    return limits;
+}
+
 const FullCapabilitiesMap & ConvolutionalLayer2DCapabilities::GetOperands(uint32_t operandIndex)
 {
     static const ComponentFullCapabilityMap operands =
@@ -95,6 +122,11 @@ const FullCapabilitiesMap & ConvolutionalLayer2DCapabilities::GetOperands(uint32
                     {GNA_TENSOR_HW},
                     {{GNA_DIM_H, MakeLimits<InputEqual1, InputOperandIndex>()},
                     {GNA_DIM_W, MakeLimitsMulti<LegacyInputs, InputOperandIndex>()}}),
+                // 1B inputs processed in software only, as device does not support legacy convolution since 3.0
+                LayerCaps::Make<Gna2DeviceGeneration3_0, InputOperandIndex, Gna2DeviceGeneration3_0, INTEL_CONVOLUTIONAL>(
+                    {GNA_TENSOR_HW},
+                    {{GNA_DIM_H, MakeLimits<InputEqual1, InputOperandIndex>()},
+                    {GNA_DIM_W, MakeLimitsMulti<LegacyInputs, InputOperandIndex>()}}),
             }},
             {INTEL_CONVOLUTIONAL_2D,{
                 MakeNHWDInput<Gna2DeviceGeneration3_0, INTEL_CONVOLUTIONAL_2D>(
@@ -136,19 +168,18 @@ const FullCapabilitiesMap & ConvolutionalLayer2DCapabilities::GetOperands(uint32
                 MakeFilterCaps<Gna2DeviceGeneration1_0, GNA_TENSOR_NW, INTEL_CONVOLUTIONAL>(
                     // N - # filters, W - # filter coefficients
                     { Filter1DElementsMultiplier, Filter1DCountMax, Filter1DElementsMultiplier,
-                     Filter1DElementsMin, Filter1DElementsMax, InputElementCountMultiplier })
+                     Filter1DElementsMin, Filter1DElementsMax, InputElementCountMultiplier }),
+                // 1B filters processed in software only, as 1B inputs
+                LayerCaps::MakeCaps<Gna2DeviceGeneration3_0, GNA_TENSOR_NW, FilterOperandIndex>(
+                    { Filter1DElementsMultiplier, Filter1DCountMax, Filter1DElementsMultiplier,
+                     Filter1DElementsMin, Filter1DElementsMax, InputElementCountMultiplier },
+                    {Gna2DataTypeInt8, Gna2DataTypeInt16}),
             }},
             {INTEL_CONVOLUTIONAL_2D, {
                 MakeFilterCaps<Gna2DeviceGeneration3_0, GNA_TENSOR_NHWD, INTEL_CONVOLUTIONAL_2D>(
-                    {8, 1024, 8,
-                    Filter2DElementsMin, 7, Filter2DElementsMin,
-                    Filter2DElementsMin, 7, Filter2DElementsMin, //New limitations for ADL 2D CNN
-                    Filter2DElementsMin, Filter2DDepthMax, Filter2DElementsMin}), // Padding to 16B is required for each Kernel
+                    getFilter2DLimits3_0()), // Padding to 16B is required for each Kernel
                 MakeFilterCaps<Gna2DeviceGeneration3_1, GNA_TENSOR_NHWD, INTEL_CONVOLUTIONAL_2D>(
-                    {Filter2DElementsMin, 1024, Filter2DElementsMin,
-                    Filter2DElementsMin, Filter2DElementsMax, Filter2DElementsMin,
-                    Filter2DElementsMin, Filter2DElementsMax, Filter2DElementsMin,
-                    Filter2DElementsMin, Filter2DDepthMax, Filter2DElementsMin}),// Padding to 16B is required for each Kernel
+                    getFilter2DLimits3_1()), // Padding to 16B is required for each Kernel
             }},
             {INTEL_CONVOLUTIONAL_1D, {
                 LayerCaps::MakeCaps<Gna2DeviceGeneration3_0, GNA_TENSOR_NHWD, FilterOperandIndex>(
@@ -197,6 +228,21 @@ const OperationCapabilityMap& ConvolutionalLayer2DCapabilities::GetOperands(uint
     return GetOperands(operandIndex).at(operation);
 }
 
+const FullCapabilitiesMap& ConvolutionalLayer2DCapabilities::GetSoftwareOnlyFilterOperands()
+{
+    static const auto modes = DataModeLimits{
+        { Gna2DataTypeInt4, Gna2DataTypeUint4, Gna2DataTypeInt8, Gna2DataTypeInt16 },
+        GetError<FilterOperandIndex>().second };
+    static const FullCapabilitiesMap operands =
+    {
+        {INTEL_CONVOLUTIONAL_2D, {
+            LayerCaps::MakeCaps<Gna2DeviceGeneration3_0, GNA_TENSOR_NHWD, FilterOperandIndex>(getFilter2DLimits3_0(), modes),
+            LayerCaps::MakeCaps<Gna2DeviceGeneration3_1, GNA_TENSOR_NHWD, FilterOperandIndex>(getFilter2DLimits3_1(), modes),
+        }},
+    };
+    return operands;
+}
+
 const FullCapabilitiesMap & ConvolutionalLayer2DCapabilities::GetParameters(uint32_t parameterIndex)
 {
     static const ComponentFullCapabilityMap parameters =
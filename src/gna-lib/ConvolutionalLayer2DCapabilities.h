@@ -18,6 +18,12 @@ struct ConvolutionalLayer2DCapabilities : LayerCapabilities
     static const OperationCapabilityMap & GetOperands(uint32_t operandIndex, nn_operation operation);
     static const OperationCapabilityMap & GetParameters(uint32_t parameterIndex, nn_operation operation);
 
+    /**
+     Filter capabilities of 2D convolution for models created for software device,
+     same as hardware ones extended with 4-bit filters.
+     */
+    static const FullCapabilitiesMap& GetSoftwareOnlyFilterOperands();
+
     /** CNN minimum number of filter coefficients */
     static constexpr uint32_t Filter1DElementsMin = 8;
 
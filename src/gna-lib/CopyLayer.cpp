@@ -97,14 +97,14 @@ void CopyLayer::UpdateKernelConfigs(LayerConfiguration& layerConfiguration) cons
 void CopyLayer::computeHidden(AccelerationMode accel, ExecutionConfig const & executionConfig) const
 {
     UNREFERENCED_PARAMETER(executionConfig);
-    copyKernels.at(accel)(&copyHiddenConfig);
+    copyKernels.Get(accel)(&copyHiddenConfig);
 }
 
 void CopyLayer::compute(const LayerConfiguration& layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig) const
 {
     UNREFERENCED_PARAMETER(executionConfig);
     auto copyConfig = layerConfiguration.Configs.Copy.get();
-    copyKernels.at(accel)(copyConfig);
+    copyKernels.Get(accel)(copyConfig);
 }
 
 Shape CopyLayer::GetCopyShape(const Gna2Operation& operation)
@@ -39,6 +39,30 @@ void Device::SetNumberOfThreads(uint32_t threadCount)
     requestHandler.ChangeNumberOfThreads(threadCount);
 }
 
+void Device::SetRequestBatching(uint32_t batchSizeMax, uint32_t waitTimeMax)
+{
+    requestHandler.SetBatching(batchSizeMax, waitTimeMax);
+    for (auto const & model : models)
+    {
+        requestHandler.ReserveScratchPad(model.second->GetBatchScratchSize(batchSizeMax));
+    }
+}
+
+void Device::SetSoftwareFallbackBudget(uint32_t budget)
+{
+    fallbackDispatcher.SetSoftwareBudget(budget);
+}
+
+void Device::EnableKernelTuning(std::string const & tuningCacheFile)
+{
+    kernelTuner.Enable(tuningCacheFile);
+}
+
+void Device::SetPartitionCosts(Gna2PartitionCosts const & costs)
+{
+    partitionCostModel = PartitionCostModel{ costs };
+}
+
 uint32_t Device::StoreModel(std::unique_ptr<CompiledModel> && compiledModel)
 {
     if (!compiledModel)
@@ -48,6 +72,10 @@ uint32_t Device::StoreModel(std::unique_ptr<CompiledModel> && compiledModel)
 
     auto modelId = modelIdSequence++;
 
+    if (kernelTuner.IsEnabled())
+    {
+        compiledModel->EnableKernelTuning(kernelTuner);
+    }
     models.emplace(modelId, std::move(compiledModel));
     return modelId;
 }
@@ -83,6 +111,24 @@ void Device::EnforceAcceleration(uint32_t configId, Gna2AccelerationMode acceler
     requestConfiguration.EnforceAcceleration(accelerationMode);
 }
 
+void Device::EnableHardwareConsistency(uint32_t configId)
+{
+    auto& requestConfiguration = requestBuilder.GetConfiguration(configId);
+    requestConfiguration.EnableHardwareConsistency();
+}
+
+void Device::DisableHardwareConsistency(uint32_t configId)
+{
+    auto& requestConfiguration = requestBuilder.GetConfiguration(configId);
+    requestConfiguration.DisableHardwareConsistency();
+}
+
+void Device::SetRequestDeadline(uint32_t configId, uint32_t deadline)
+{
+    auto& requestConfiguration = requestBuilder.GetConfiguration(configId);
+    requestConfiguration.SetDeadline(deadline);
+}
+
 void Device::AttachActiveList(uint32_t configId, uint32_t layerIndex,
     uint32_t indicesCount, const uint32_t* const indices)
 {
@@ -97,6 +143,11 @@ bool Device::HasRequestConfigId(uint32_t requestConfigId) const
     return requestBuilder.HasConfiguration(requestConfigId);
 }
 
+bool Device::HasSessionId(uint32_t sessionId) const
+{
+    return requestBuilder.HasSession(sessionId);
+}
+
 bool Device::HasRequestId(uint32_t requestId) const
 {
     return requestHandler.HasRequest(requestId);
@@ -107,6 +158,11 @@ CompiledModel const& Device::GetModel(uint32_t modelId)
     return *models.at(modelId);
 }
 
+std::vector<Gna2ModelPartition> Device::GetModelPartitions(uint32_t modelId)
+{
+    return models.at(modelId)->GetPartitions();
+}
+
 void Device::ReleaseModel(uint32_t const modelId)
 {
     models.erase(modelId);
@@ -120,11 +176,39 @@ void Device::PropagateRequest(uint32_t configId, uint32_t *requestId)
     requestHandler.Enqueue(requestId, std::move(request));
 }
 
+void Device::CreateSession(uint32_t configId, uint32_t *sessionId)
+{
+    requestBuilder.CreateSession(configId, sessionId);
+}
+
+void Device::ReleaseSession(uint32_t sessionId)
+{
+    requestBuilder.ReleaseSession(sessionId);
+}
+
+void Device::PropagateSessionRequest(uint32_t sessionId, uint32_t *requestId)
+{
+    Expect::NotNull(requestId);
+
+    auto request = requestBuilder.CreateSessionRequest(sessionId);
+    requestHandler.Enqueue(requestId, std::move(request));
+}
+
+Session & Device::GetSession(uint32_t sessionId)
+{
+    return requestBuilder.GetSession(sessionId);
+}
+
 Gna2Status Device::WaitForRequest(uint32_t requestId, uint32_t milliseconds)
 {
     return requestHandler.WaitFor(requestId, milliseconds);
 }
 
+bool Device::CancelRequest(uint32_t requestId)
+{
+    return requestHandler.Cancel(requestId);
+}
+
 void Device::Stop()
 {
     requestHandler.StopRequests();
@@ -135,6 +219,16 @@ bool Device::HasModel(uint32_t modelId) const
     return models.count(modelId) > 0;
 }
 
+RequestStatistics & Device::GetModelStatistics(uint32_t modelId)
+{
+    return models.at(modelId)->GetStatistics();
+}
+
+RequestStatistics & Device::GetRequestConfigStatistics(uint32_t requestConfigId)
+{
+    return requestBuilder.GetConfiguration(requestConfigId).Statistics;
+}
+
 void Device::AssignProfilerConfigToRequestConfig(uint32_t requestConfigId, ProfilerConfiguration& profilerConfiguration)
 {
     auto& requestConfiguration = requestBuilder.GetConfiguration(requestConfigId);
@@ -8,14 +8,18 @@
 #include "AccelerationDetector.h"
 #include "CompiledModel.h"
 #include "DriverInterface.h"
+#include "FallbackDispatcher.h"
 #include "HardwareCapabilities.h"
+#include "KernelTuner.h"
 #include "Memory.h"
+#include "PartitionCostModel.h"
 #include "RequestBuilder.h"
 #include "RequestHandler.h"
 
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <string>
 
 struct Gna2ModelSueCreekHeader;
 
@@ -38,12 +42,24 @@ public:
 
     void SetNumberOfThreads(uint32_t threadCount);
 
+    void SetRequestBatching(uint32_t batchSizeMax, uint32_t waitTimeMax);
+
+    void SetSoftwareFallbackBudget(uint32_t budget);
+
+    // Enables kernel tuning of models loaded afterwards, empty path disables tuning cache file
+    void EnableKernelTuning(std::string const & tuningCacheFile);
+
+    // Sets costs used to partition models loaded afterwards
+    void SetPartitionCosts(Gna2PartitionCosts const & costs);
+
     virtual uint32_t LoadModel(const ApiModel& model) = 0;
 
     CompiledModel const & GetModel(uint32_t modelId);
 
     void ReleaseModel(uint32_t modelId);
 
+    std::vector<Gna2ModelPartition> GetModelPartitions(uint32_t modelId);
+
     void AttachBuffer(uint32_t configId, uint32_t operandIndex, uint32_t layerIndex, void *address);
 
     void CreateConfiguration(uint32_t modelId, uint32_t *configId);
@@ -54,22 +70,44 @@ public:
 
     void EnforceAcceleration(uint32_t configId, Gna2AccelerationMode accelerationMode);
 
+    void EnableHardwareConsistency(uint32_t configId);
+
+    void DisableHardwareConsistency(uint32_t configId);
+
+    void SetRequestDeadline(uint32_t configId, uint32_t deadline);
+
     void AttachActiveList(uint32_t configId, uint32_t layerIndex, uint32_t indicesCount, const uint32_t* indices);
 
     void PropagateRequest(uint32_t configId, uint32_t *requestId);
 
+    void CreateSession(uint32_t configId, uint32_t *sessionId);
+
+    void ReleaseSession(uint32_t sessionId);
+
+    void PropagateSessionRequest(uint32_t sessionId, uint32_t *requestId);
+
+    Session & GetSession(uint32_t sessionId);
+
     Gna2Status WaitForRequest(uint32_t requestId, uint32_t milliseconds);
 
+    bool CancelRequest(uint32_t requestId);
+
     void Stop();
 
     void AssignProfilerConfigToRequestConfig(uint32_t requestConfigId, ProfilerConfiguration& profilerConfiguration);
 
+    RequestStatistics & GetModelStatistics(uint32_t modelId);
+
+    RequestStatistics & GetRequestConfigStatistics(uint32_t requestConfigId);
+
     bool HasModel(uint32_t modelId) const;
 
     bool HasRequestConfigId(uint32_t requestConfigId) const;
 
     bool HasRequestId(uint32_t requestId) const;
 
+    bool HasSessionId(uint32_t sessionId) const;
+
     virtual void MapMemory(Memory& memoryObject)
     {
         UNREFERENCED_PARAMETER(memoryObject);
@@ -101,6 +139,12 @@ protected:
 
     AccelerationDetector accelerationDetector;
 
+    FallbackDispatcher fallbackDispatcher;
+
+    PartitionCostModel partitionCostModel;
+
+    KernelTuner kernelTuner{ accelerationDetector.GetCpuName(), accelerationDetector.GetSupportedCpuAccelerations() };
+
     RequestBuilder requestBuilder;
 
     RequestHandler requestHandler;
@@ -15,6 +15,7 @@
 
 #include "gna2-common-api.h"
 
+#include <algorithm>
 #include <memory>
 
 using namespace GNA;
@@ -146,6 +147,30 @@ uint32_t DeviceManager::GetThreadCount(uint32_t deviceIndex)
     return device.GetNumberOfThreads();
 }
 
+void DeviceManager::SetRequestBatching(uint32_t deviceIndex, uint32_t batchSizeMax, uint32_t waitTimeMax)
+{
+    auto& device = GetDevice(deviceIndex);
+    device.SetRequestBatching(batchSizeMax, waitTimeMax);
+}
+
+void DeviceManager::SetSoftwareFallbackBudget(uint32_t deviceIndex, uint32_t budget)
+{
+    auto& device = GetDevice(deviceIndex);
+    device.SetSoftwareFallbackBudget(budget);
+}
+
+void DeviceManager::EnableKernelTuning(uint32_t deviceIndex, std::string const & tuningCacheFile)
+{
+    auto& device = GetDevice(deviceIndex);
+    device.EnableKernelTuning(tuningCacheFile);
+}
+
+void DeviceManager::SetPartitionCosts(uint32_t deviceIndex, Gna2PartitionCosts const & costs)
+{
+    auto& device = GetDevice(deviceIndex);
+    device.SetPartitionCosts(costs);
+}
+
 void DeviceManager::OpenDevice(uint32_t deviceIndex)
 {
     Expect::InRange(deviceIndex, GetDeviceCount() - 1, Gna2StatusIdentifierInvalid);
@@ -206,10 +231,11 @@ Device* DeviceManager::TryGetDeviceForModel(uint32_t modelId)
 }
 
 void DeviceManager::AllocateMemory(uint32_t deviceIndex, uint32_t requestedSize,
-                                   uint32_t *sizeGranted, void **memoryAddress)
+                                   uint32_t *sizeGranted, void **memoryAddress, uint32_t flags)
 {
     Expect::NotNull(sizeGranted);
     Expect::NotNull(memoryAddress);
+    Expect::Zero(flags & ~static_cast<uint32_t>(Gna2MemoryAllocFlagNoZeroFill), Gna2StatusNotImplemented);
 
     *sizeGranted = 0;
 
@@ -226,9 +252,10 @@ void DeviceManager::AllocateMemory(uint32_t deviceIndex, uint32_t requestedSize,
 
     const auto deviceInterface = GetDev(deviceIndex);
 
+    auto const zeroFill = 0 == (flags & Gna2MemoryAllocFlagNoZeroFill);
     const auto memoryObject = (deviceInterface == nullptr) ?
-        CreateInternalMemory(requestedSize) :
-        CreateInternalMemory(deviceInterface->MemoryCreate(requestedSize));
+        CreateInternalMemory(requestedSize, Memory::GNA_BUFFER_ALIGNMENT, zeroFill) :
+        CreateInternalMemory(deviceInterface->MemoryCreate(requestedSize, Memory::GNA_BUFFER_ALIGNMENT, zeroFill));
 
     Expect::NotNull(memoryObject, Gna2StatusResourceAllocationError);
 
@@ -238,6 +265,32 @@ void DeviceManager::AllocateMemory(uint32_t deviceIndex, uint32_t requestedSize,
     *sizeGranted = memoryObject->GetSize();
 }
 
+void DeviceManager::RegisterReadOnlyMemory(void * memory, uint32_t size)
+{
+    Expect::NotNull(memory);
+
+    auto memoryObject = Memory::CreateReadOnlyMapped(memory, size);
+    auto const memoryEnd = memoryObject->GetBuffer<uint8_t>() + memoryObject->GetSize();
+    for (auto const & allocated : memoryObjects)
+    {
+        auto const allocatedBuffer = allocated->GetBuffer<uint8_t>();
+        auto const overlaps = memoryObject->GetBuffer<uint8_t>() < allocatedBuffer + allocated->GetSize()
+            && allocatedBuffer < memoryEnd;
+        Expect::False(overlaps, Gna2StatusMemoryBufferInvalid);
+    }
+    memoryObjects.emplace_back(std::move(memoryObject));
+}
+
+bool DeviceManager::IsReadOnlyMemory(const void * buffer) const
+{
+    return std::any_of(memoryObjects.begin(), memoryObjects.end(),
+        [buffer](const std::unique_ptr<Memory>& memory)
+    {
+        return memory->IsReadOnlyMapped()
+            && Expect::InMemoryRange(buffer, 1, memory->GetBuffer(), memory->GetSize());
+    });
+}
+
 std::pair<bool, std::vector<std::unique_ptr<Memory>>::iterator> DeviceManager::FindMemory(void * buffer)
 {
     auto memoryIterator = std::find_if(memoryObjects.begin(), memoryObjects.end(),
@@ -311,6 +364,30 @@ Device & DeviceManager::GetDeviceForRequestId(uint32_t requestId)
     throw GnaException(Gna2StatusIdentifierInvalid);
 }
 
+Device & DeviceManager::GetDeviceForSessionId(uint32_t sessionId)
+{
+    for (const auto& device : devices)
+    {
+        if (device.second->HasSessionId(sessionId))
+        {
+            return *device.second;
+        }
+    }
+    throw GnaException(Gna2StatusIdentifierInvalid);
+}
+
+void DeviceManager::CancelRequest(uint32_t requestId)
+{
+    for (const auto& device : devices)
+    {
+        if (device.second->CancelRequest(requestId))
+        {
+            return;
+        }
+    }
+    throw GnaException(Gna2StatusIdentifierInvalid);
+}
+
 const std::vector<std::unique_ptr<Memory>> & DeviceManager::GetAllAllocated() const
 {
     return memoryObjects;
@@ -320,6 +397,8 @@ void DeviceManager::TagMemory(void* memory, uint32_t tag)
 {
     const auto found = FindMemory(memory);
     Expect::True(found.first, Gna2StatusMemoryBufferInvalid);
+    // tags of read-only regions are fixed, as other tags denote memory written by GNA
+    Expect::False(found.second->get()->IsReadOnlyMapped(), Gna2StatusMemoryBufferInvalid);
     found.second->get()->SetTag(tag);
 }
 
@@ -11,10 +11,12 @@
 
 #include "ExportDevice.h"
 #include "gna2-common-impl.h"
+#include "gna2-memory-api.h"
 #include "ProfilerConfiguration.h"
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace GNA
@@ -47,6 +49,14 @@ public:
 
     uint32_t GetThreadCount(uint32_t deviceIndex);
 
+    void SetRequestBatching(uint32_t deviceIndex, uint32_t batchSizeMax, uint32_t waitTimeMax);
+
+    void SetSoftwareFallbackBudget(uint32_t deviceIndex, uint32_t budget);
+
+    void EnableKernelTuning(uint32_t deviceIndex, std::string const & tuningCacheFile);
+
+    void SetPartitionCosts(uint32_t deviceIndex, Gna2PartitionCosts const & costs);
+
     void OpenDevice(uint32_t deviceIndex);
 
     void CreateExportDevice(uint32_t * deviceIndex, Gna2DeviceVersion targetDeviceVersion);
@@ -56,7 +66,8 @@ public:
     Device& GetDeviceForModel(uint32_t modelId);
     Device* TryGetDeviceForModel(uint32_t modelId);
 
-    void AllocateMemory(uint32_t deviceIndex, uint32_t requestedSize, uint32_t *sizeGranted, void **memoryAddress);
+    void AllocateMemory(uint32_t deviceIndex, uint32_t requestedSize, uint32_t *sizeGranted, void **memoryAddress,
+        uint32_t flags = Gna2MemoryAllocFlagNone);
 
     template<typename ... T>
     Memory * CreateInternalMemory(T ... params)
@@ -71,6 +82,11 @@ public:
         return ptr;
     }
 
+    void RegisterReadOnlyMemory(void * memory, uint32_t size);
+
+    // Whether buffer is in region registered with RegisterReadOnlyMemory(), not mapped to devices
+    bool IsReadOnlyMemory(const void * buffer) const;
+
     std::pair<bool, std::vector<std::unique_ptr<Memory>>::iterator> FindMemory(void * buffer);
     void FreeMemory(void * buffer);
 
@@ -83,6 +99,12 @@ public:
 
     Device& GetDeviceForRequestId(uint32_t requestId);
 
+    Device& GetDeviceForSessionId(uint32_t sessionId);
+
+    // Cancels request on device it was enqueued to,
+    // request being waited for is not registered on device, thus all devices are tried
+    void CancelRequest(uint32_t requestId);
+
     const std::vector<std::unique_ptr<Memory>>& GetAllAllocated() const;
     void TagMemory(void* memory, uint32_t tag);
 
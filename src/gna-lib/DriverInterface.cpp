@@ -11,8 +11,19 @@
 #include "Macros.h"
 #include "WindowsDriverInterface.h"
 
+#include <utility>
+
 using namespace GNA;
 
+namespace
+{
+DriverInterface::Factory & getFactory()
+{
+    static DriverInterface::Factory factory;
+    return factory;
+}
+}
+
 DeviceVersion DriverInterface::Query(uint32_t deviceIndex)
 {
     auto const driverInterface = Create(deviceIndex);
@@ -23,17 +34,31 @@ DeviceVersion DriverInterface::Query(uint32_t deviceIndex)
 
 std::unique_ptr<DriverInterface> DriverInterface::Create(uint32_t deviceIndex)
 {
-    auto driverInterface =
+    auto const & factory = getFactory();
+    std::unique_ptr<DriverInterface> driverInterface;
+    if (factory)
+    {
+        driverInterface = factory();
+    }
+    else
+    {
+        driverInterface =
 #if defined(_WIN32)
-        std::make_unique<WindowsDriverInterface>();
+            std::make_unique<WindowsDriverInterface>();
 #else // GNU/Linux / Android / ChromeOS
-        std::make_unique<LinuxDriverInterface>();
+            std::make_unique<LinuxDriverInterface>();
 #endif
+    }
     Expect::NotNull(driverInterface);
     driverInterface->OpenDevice(deviceIndex);
     return driverInterface;
 }
 
+void DriverInterface::SetFactory(Factory factoryIn)
+{
+    getFactory() = std::move(factoryIn);
+}
+
 const DriverCapabilities& DriverInterface::GetCapabilities() const
 {
     return driverCapabilities;
@@ -94,9 +119,9 @@ void DriverInterface::convertPerfResultUnit(DriverPerfResults& driverPerf,
     driverPerf.Completion = newProcessing + newRequestCompleted + newRequestCompletion;
 }
 
-Memory DriverInterface::MemoryCreate(uint32_t size, uint32_t ldSize)
+Memory DriverInterface::MemoryCreate(uint32_t size, uint32_t ldSize, bool zeroFill)
 {
-    return Memory(size, ldSize);
+    return Memory(size, ldSize, zeroFill);
 }
 
 
@@ -15,6 +15,9 @@
 
 #include "gna2-common-impl.h"
 
+#include <functional>
+#include <memory>
+
 namespace GNA
 {
 
@@ -113,6 +116,12 @@ public:
     // unique_ptr is guaranteed to be not null
     static std::unique_ptr<DriverInterface> Create(uint32_t deviceIndex);
 
+    using Factory = std::function<std::unique_ptr<DriverInterface>()>;
+
+    // Replaces operating system driver interface, e.g., with simulated driver in tests,
+    // has to be set before devices are queried by the first API call
+    static void SetFactory(Factory factoryIn);
+
     static constexpr uint8_t MAX_GNA_DEVICES =
 #if defined(_WIN32)
             16
@@ -127,7 +136,8 @@ public:
 
     const DriverCapabilities& GetCapabilities() const;
 
-    virtual Memory MemoryCreate(uint32_t size, uint32_t ldSize = Memory::GNA_BUFFER_ALIGNMENT);
+    // zeroFill may be ignored by drivers providing memory zeroed by the operating system
+    virtual Memory MemoryCreate(uint32_t size, uint32_t ldSize = Memory::GNA_BUFFER_ALIGNMENT, bool zeroFill = true);
 
     virtual uint64_t MemoryMap(void *memory, uint32_t memorySize) = 0;
     // return 'true' when object has also been dealocated.
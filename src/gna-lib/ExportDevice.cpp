@@ -4,7 +4,6 @@
 */
 
 #include "ExportDevice.h"
-#include "HardwareModelNoMMU.h"
 #include "HardwareModelSue1.h"
 #include "SoftwareOnlyModel.h"
 
@@ -19,7 +18,8 @@ ExportDevice::ExportDevice(Gna2DeviceVersion targetDeviceVersion) :
 
 uint32_t ExportDevice::LoadModel(const ApiModel& model)
 {
-    auto compiledModel = std::make_unique<SoftwareOnlyModel>(model, accelerationDetector, *hardwareCapabilities);
+    auto compiledModel = std::make_unique<SoftwareOnlyModel>(model, accelerationDetector, *hardwareCapabilities,
+        partitionCostModel);
 
     return StoreModel(std::move(compiledModel));
 }
@@ -49,18 +49,3 @@ void* GNA::Dump(CompiledModel const & model, Gna2ModelSueCreekHeader* modelHeade
     return address;
 }
 
-void GNA::DumpComponentNoMMu(CompiledModel const & model, Gna2UserAllocator customAlloc,
-    void *& exportData, uint32_t & exportDataSize, const Gna2ModelExportComponent component,
-    const Gna2DeviceVersion targetDevice)
-{
-    Expect::NotNull(customAlloc);
-
-    // creating HW layer descriptors directly into dump memory
-    auto hwModel = std::make_unique<HardwareModelNoMMU>(model, customAlloc, targetDevice);
-    if (!hwModel)
-    {
-        throw GnaException{ Gna2StatusResourceAllocationError };
-    }
-
-    hwModel->ExportComponent(exportData, exportDataSize, component);
-}
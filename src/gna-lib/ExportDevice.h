@@ -27,8 +27,4 @@ public:
 void* Dump(CompiledModel const & model, Gna2ModelSueCreekHeader* modelHeader, Gna2Status* status,
     Gna2UserAllocator customAlloc);
 
-void DumpComponentNoMMu(CompiledModel const & model, Gna2UserAllocator customAlloc,
-    void *& exportData, uint32_t & exportDataSize, Gna2ModelExportComponent component,
-    Gna2DeviceVersion targetDevice);
-
 }
@@ -0,0 +1,102 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "FallbackDispatcher.h"
+
+#include <chrono>
+
+using namespace GNA;
+
+FallbackDispatcher::QueueEntry::QueueEntry(FallbackDispatcher & dispatcherIn, ModelLatency & latencyIn) :
+    dispatcher{ dispatcherIn },
+    latency{ latencyIn },
+    depthAtSubmission{ dispatcherIn.queueDepth++ },
+    start{ getTime() }
+{
+}
+
+FallbackDispatcher::QueueEntry::~QueueEntry()
+{
+    dispatcher.queueDepth--;
+}
+
+void FallbackDispatcher::QueueEntry::Complete()
+{
+    // requests queued before are assumed to take the same time
+    updateEstimate(latency.Hardware, (getTime() - start) / (depthAtSubmission + 1));
+}
+
+FallbackDispatcher::SoftwareEntry::SoftwareEntry(FallbackDispatcher & dispatcherIn, ModelLatency & latencyIn) :
+    dispatcher{ dispatcherIn },
+    latency{ latencyIn },
+    start{ getTime() }
+{
+}
+
+FallbackDispatcher::SoftwareEntry::~SoftwareEntry()
+{
+    dispatcher.softwareRequestCount--;
+}
+
+void FallbackDispatcher::SoftwareEntry::Complete()
+{
+    updateEstimate(latency.Software, getTime() - start);
+}
+
+void FallbackDispatcher::SetSoftwareBudget(uint32_t budget)
+{
+    softwareBudget = budget;
+}
+
+uint32_t FallbackDispatcher::GetSoftwareBudget() const
+{
+    return softwareBudget;
+}
+
+bool FallbackDispatcher::ShouldScoreInSoftware(ModelLatency const & latency)
+{
+    auto const depth = uint64_t{ queueDepth };
+    if (0 == depth)
+    {
+        return false;
+    }
+    auto const hardwareExpected = latency.Hardware * (depth + 1);
+    auto const softwareExpected = latency.Software.load();
+    // unknown software latency is measured, as it is expected to be shorter than queueing on device
+    if (0 != softwareExpected && softwareExpected >= hardwareExpected)
+    {
+        return false;
+    }
+
+    auto count = softwareRequestCount.load();
+    do
+    {
+        if (count >= softwareBudget)
+        {
+            return false;
+        }
+    } while (!softwareRequestCount.compare_exchange_weak(count, count + 1));
+    return true;
+}
+
+uint32_t FallbackDispatcher::GetQueueDepth() const
+{
+    return queueDepth;
+}
+
+uint64_t FallbackDispatcher::getTime()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void FallbackDispatcher::updateEstimate(std::atomic<uint64_t> & estimate, uint64_t sample)
+{
+    // first sample is taken as is, concurrent updates may be lost
+    auto const current = estimate.load();
+    auto const updated = 0 == current ? sample
+        : current - (current >> EstimateWeightShift) + (sample >> EstimateWeightShift);
+    estimate = updated > 0 ? updated : 1;
+}
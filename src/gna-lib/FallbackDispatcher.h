@@ -0,0 +1,98 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace GNA
+{
+
+// Recent latencies of single model on each scoring path
+struct ModelLatency
+{
+    // Device processing time of single request in microseconds, excluding time spent in device queue
+    std::atomic<uint64_t> Hardware{ 0 };
+
+    // Software scoring time of single request in microseconds
+    std::atomic<uint64_t> Software{ 0 };
+};
+
+// Routes requests of Gna2AccelerationModeHardwareWithSoftwareFallback mode of single device
+// to device or software, whichever is expected to complete request first
+//
+// Device queue depth is number of requests of this device being processed by device,
+// expected device completion time is model processing time multiplied by queue depth + 1.
+// Request is scored in software when expected software time is shorter
+// and number of requests being scored in software does not exceed software budget.
+// Unknown software latency is measured by routing request to software when device is busy.
+class FallbackDispatcher
+{
+public:
+    // Request being processed by device, tracked in device queue depth
+    class QueueEntry
+    {
+    public:
+        QueueEntry(FallbackDispatcher & dispatcherIn, ModelLatency & latencyIn);
+        QueueEntry(const QueueEntry&) = delete;
+        QueueEntry& operator=(const QueueEntry&) = delete;
+        ~QueueEntry();
+
+        // Updates model latency estimate with processing time of completed request
+        void Complete();
+
+    private:
+        FallbackDispatcher & dispatcher;
+        ModelLatency & latency;
+        uint32_t const depthAtSubmission;
+        uint64_t const start;
+    };
+
+    // Request being scored in software, occupies software budget
+    class SoftwareEntry
+    {
+    public:
+        SoftwareEntry(FallbackDispatcher & dispatcherIn, ModelLatency & latencyIn);
+        SoftwareEntry(const SoftwareEntry&) = delete;
+        SoftwareEntry& operator=(const SoftwareEntry&) = delete;
+        ~SoftwareEntry();
+
+        // Updates model latency estimate with scoring time of completed request
+        void Complete();
+
+    private:
+        FallbackDispatcher & dispatcher;
+        ModelLatency & latency;
+        uint64_t const start;
+    };
+
+    // Sets maximum number of requests scored in software concurrently, 0 disables dispatching
+    void SetSoftwareBudget(uint32_t budget);
+
+    uint32_t GetSoftwareBudget() const;
+
+    // Reserves software budget when request is expected to complete in software first,
+    // reservation is released by SoftwareEntry
+    bool ShouldScoreInSoftware(ModelLatency const & latency);
+
+    uint32_t GetQueueDepth() const;
+
+private:
+    static uint64_t getTime();
+
+    static void updateEstimate(std::atomic<uint64_t> & estimate, uint64_t sample);
+
+    // weight of new sample in estimate is 1 / (1 << EstimateWeightShift)
+    static constexpr uint32_t EstimateWeightShift = 3;
+
+    std::atomic<uint32_t> softwareBudget{ 0 };
+
+    std::atomic<uint32_t> queueDepth{ 0 };
+
+    std::atomic<uint32_t> softwareRequestCount{ 0 };
+};
+
+}
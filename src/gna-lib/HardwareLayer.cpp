@@ -590,6 +590,11 @@ HwUarchParams HardwareLayerCnn2D::CalculateUArchConfig() const
 
 uint32_t HardwareLayerCnn2D::GetKernelMemorySize(FiltersTensor const * filter)
 {
+    // 4-bit filters are packed separately, thus odd element count takes extra half byte per filter
+    if (Gna2DataTypeInt4 == filter->Mode.Type || Gna2DataTypeUint4 == filter->Mode.Type)
+    {
+        return RoundUp((filter->Component::Count / filter->Count + 1) / 2, 16u);
+    }
     return RoundUp(filter->Size / filter->Count, 16u);
 }
 
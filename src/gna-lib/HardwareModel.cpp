@@ -159,7 +159,14 @@ void HardwareModel::prepareAllocationsAndModel()
 
     prepareBaseDescriptor();
 
-    allocations.Append(model.GetAllocations());
+    for (auto const & memory : model.GetAllocations())
+    {
+        // read-only registered memory is not mapped to device, operations using it are scored in software
+        if (!memory.get().IsReadOnlyMapped())
+        {
+            allocations.Emplace(memory);
+        }
+    }
 
 
     auto const modelSize = allocations.GetMemorySizeAlignedToPage();
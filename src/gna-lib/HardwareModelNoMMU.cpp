@@ -243,10 +243,17 @@ void HardwareModelNoMMU::ExportComponent(void *& exportData, uint32_t & exportDa
 
 void HardwareModelNoMMU::ExportLd(void *& exportData, uint32_t & exportDataSize)
 {
-    Build();
+    if (!isBuilt)
+    {
+        // layers of failed build are dropped, thus build can be retried
+        hardwareLayers.clear();
+        Build();
+        isBuilt = true;
+    }
 
-    exportData = ldMemory->GetBuffer();
     exportDataSize = ldMemory->GetSize();
+    exportData = customAllocSafe(exportDataSize);
+    memcpy(exportData, ldMemory->GetBuffer(), exportDataSize);
 }
 
 MemoryContainer const& HardwareModelNoMMU::GetComponent(Gna2ModelExportComponent component) const
@@ -285,8 +292,3 @@ Gna2MemoryTag HardwareModelNoMMU::GetComponentTag(Gna2DeviceVersion target, Gna2
         throw GnaException(Gna2StatusDeviceVersionInvalid);
     }
 }
-
-std::unique_ptr<Memory> HardwareModelNoMMU::allocLD(uint32_t ldMemorySize, uint32_t ldSize)
-{
-    return std::make_unique<Memory>(customAllocSafe(ldMemorySize), ldMemorySize, ldSize);
-}
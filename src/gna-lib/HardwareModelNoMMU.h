@@ -38,6 +38,8 @@ public:
     // Adds BAR index at low 2 bits
     virtual LdaOffset GetBufferOffset(const BaseAddress& address) const override;
 
+    // Exports component into buffer allocated with custom allocator,
+    // model is built once, thus all components of model may be exported from single instance
     void ExportComponent(void *& exportData, uint32_t & exportDataSize, Gna2ModelExportComponent component);
 
     static constexpr uint32_t GnaDescriptorSize = 32;
@@ -57,8 +59,6 @@ protected:
     void PrepareExportAllocations();
     void GuessIOAllocations();
 
-    std::unique_ptr<Memory> allocLD(uint32_t ldMemorySize, uint32_t ldSize = Memory::GNA_BUFFER_ALIGNMENT) override;
-
 private:
     void ExportLd(void *& exportData, uint32_t & exportDataSize);
     static const HardwareCapabilities& GetHwCaps(Gna2DeviceVersion targetDevice);
@@ -77,6 +77,8 @@ private:
 
     std::unique_ptr<Memory> guessedInput;
     std::unique_ptr<Memory> guessedOutput;
+
+    bool isBuilt = false;
 };
 
 }
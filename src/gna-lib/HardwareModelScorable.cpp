@@ -15,7 +15,11 @@
 #include "MemoryContainer.h"
 #include "RequestConfiguration.h"
 #include "SoftwareModel.h"
+#include "ThreadPool.h"
+#include "Tracer.h"
 
+#include <chrono>
+#include <mutex>
 #include <utility>
 
 using namespace GNA;
@@ -96,11 +100,33 @@ void HardwareModelScorable::Score(ScoreContext & context)
             hwRequest = hardwareRequests.at(configId).get();
         }
     }
-    hwRequest->Update(context.layerIndex, context.layerCount, operationMode);
-
-    context.profiler.Measure(Gna2InstrumentationPointLibExecution);
+    RequestResult result = {};
+    auto const submit = [&]()
+    {
+        // requests of the same configuration share hardware request, thus are submitted one by one
+        std::lock_guard<std::mutex> submitGuard(hwRequest->SubmitLock);
+        hwRequest->Update(context.layerIndex, context.layerCount, operationMode);
+
+        context.profiler.Measure(Gna2InstrumentationPointLibExecution);
+
+        // submitted request is completed by device, canceled request is not submitted at all
+        context.ExpectNotCanceled();
+        GNA_TRACE(TraceEventType::DriverSubmit, context.layerIndex, context.layerCount);
+        auto const submitTime = std::chrono::steady_clock::now();
+        result = driverInterface.Submit(*hwRequest, context.profiler);
+        context.driverTime += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - submitTime).count());
+        GNA_TRACE(TraceEventType::DriverComplete, static_cast<uint32_t>(result.status));
+    };
+    if (context.isDeviceWaitShared)
+    {
+        ThreadPool::WaitForDevice(context.buffers, submit);
+    }
+    else
+    {
+        submit();
+    }
 
-    auto const result = driverInterface.Submit(*hwRequest, context.profiler);
     context.profiler.AddResults(Gna2InstrumentationPointDrvPreprocessing, result.driverPerf.Preprocessing);
     context.profiler.AddResults(Gna2InstrumentationPointDrvProcessing, result.driverPerf.Processing);
     context.profiler.AddResults(Gna2InstrumentationPointDrvDeviceRequestCompleted, result.driverPerf.DeviceRequestCompleted);
@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include "HardwareModel.h"
 
@@ -72,6 +73,9 @@ public:
     /* Hardware request ready for driver submition indicator */
     bool SubmitReady = false;
 
+    /* Held while request is updated and processed by driver */
+    std::mutex SubmitLock;
+
     ProfilerConfiguration* GetProfilerConfiguration() const
     {
         return requestConfiguration.GetProfilerConfiguration();
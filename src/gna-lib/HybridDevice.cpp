@@ -8,6 +8,7 @@
 #include "DriverInterface.h"
 #include "HybridModel.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 
@@ -28,7 +29,7 @@ HybridDevice::HybridDevice(std::unique_ptr<DriverInterface> && driverInterfaceIn
 
 void HybridDevice::MapMemory(Memory & memoryObject)
 {
-    if (hardwareCapabilities->IsHardwareSupported())
+    if (hardwareCapabilities->IsHardwareSupported() && !memoryObject.IsReadOnlyMapped())
     {
         memoryObject.Map(*driverInterface);
     }
@@ -45,7 +46,11 @@ bool HybridDevice::UnMapMemory(Memory & memoryObject)
 
 uint32_t HybridDevice::LoadModel(const ApiModel& model)
 {
-    auto compiledModel = std::make_unique<HybridModel>(model, accelerationDetector, *hardwareCapabilities, *driverInterface);
+    auto compiledModel = std::make_unique<HybridModel>(model, accelerationDetector, *hardwareCapabilities,
+        partitionCostModel, *driverInterface, fallbackDispatcher);
+    requestHandler.ReserveScratchPad((std::max)(
+        compiledModel->GetMaximumOperandSize(SoftwareScratchpadOperandIndex),
+        compiledModel->GetBatchScratchSize(requestHandler.GetBatchSizeMax())));
 
     return StoreModel(std::move(compiledModel));
 }
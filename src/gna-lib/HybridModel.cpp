@@ -14,15 +14,25 @@
 #include "Layer.h"
 #include "Logger.h"
 #include "Memory.h"
+#include "PartitionCostModel.h"
 #include "RequestConfiguration.h"
 #include "SubModel.h"
+#include "Tracer.h"
 
 using namespace GNA;
 
 HybridModel::HybridModel(const ApiModel& model, const AccelerationDetector& detectorIn,
-    const HardwareCapabilities& hwCapabilitiesIn, DriverInterface& ddi) :
-    CompiledModel{ model, detectorIn, hwCapabilitiesIn, Gna2DeviceVersionSoftwareEmulation }
+    const HardwareCapabilities& hwCapabilitiesIn, const PartitionCostModel& costModelIn, DriverInterface& ddi,
+    FallbackDispatcher & dispatcherIn) :
+    CompiledModel{ model, detectorIn, hwCapabilitiesIn, costModelIn, Gna2DeviceVersionSoftwareEmulation,
+        hwCapabilitiesIn.IsHardwareSupported() },
+    dispatcher{ dispatcherIn }
 {
+    if (!tryBuildPresentDeviceModel())
+    {
+        buildSoftwareModel();
+    }
+
     // try build hw model but do not throw on error, store error instead to allow sw scoring when no HW is present or model is not compatible
     try
     {
@@ -55,6 +65,35 @@ bool HybridModel::verifyFullyHardwareCompatible()
         [](auto && subModel) {return subModel->Type == Software; });
 }
 
+// Builds software model for present device directly, if all operations pass device limitations,
+// so the model is not built second time with software emulation limitations.
+// Operations not supported by the device are scored in software by this model as well,
+// as device limitations are stricter than software emulation ones.
+bool HybridModel::tryBuildPresentDeviceModel()
+{
+    if (!hwCapabilities.IsHardwareSupported())
+    {
+        return false;
+    }
+
+    try
+    {
+        softwareModelForPresentDevice = std::make_unique<SoftwareModel>(apiModel,
+            makeValidator(hwCapabilities.GetDeviceGeneration()),
+            detector.GetSupportedCpuAccelerations());
+    }
+    catch (GnaException& exception)
+    {
+        if (Gna2StatusResourceAllocationError == exception.GetStatus())
+        {
+            throw;
+        }
+        // model errors are reported by the software emulation model build
+        return false;
+    }
+    return true;
+}
+
 void HybridModel::BuildHardwareModel(DriverInterface &ddi)
 {
     if (!hwCapabilities.IsHardwareSupported())
@@ -71,12 +110,17 @@ void HybridModel::BuildHardwareModel(DriverInterface &ddi)
         throw GnaModelErrorException(error);
     }
 
-    softwareModelForPresentDevice = std::make_unique<SoftwareModel>(apiModel,
-        makeValidator(HardwareCapabilities::GetDeviceGeneration(Gna2DeviceVersionSoftwareEmulation)),
-        makeValidator(hwCapabilities.GetDeviceGeneration()),
-        detector.GetSupportedCpuAccelerations(),
-        subModels.at(hwCapabilities.GetDeviceVersion()));
-    Expect::NotNull(softwareModelForPresentDevice, Gna2StatusResourceAllocationError);
+    if (!softwareModelForPresentDevice)
+    {
+        softwareModelForPresentDevice = std::make_unique<SoftwareModel>(apiModel,
+            makeSoftwareModelValidator(),
+            makeValidator(hwCapabilities.GetDeviceGeneration()),
+            detector.GetSupportedCpuAccelerations(),
+            subModels.at(hwCapabilities.GetDeviceVersion()));
+        Expect::NotNull(softwareModelForPresentDevice, Gna2StatusResourceAllocationError);
+        // all software paths use model for present device from now on
+        softwareModel.reset();
+    }
 
     hardwareModel = std::make_unique<HardwareModelScorable>(*this, ddi, hwCapabilities, deviceSubModels);
     Expect::NotNull(hardwareModel, Gna2StatusResourceAllocationError);
@@ -95,19 +139,52 @@ void HybridModel::score(ScoreContext& context)
         }
         else
         {
-            softwareModel.Score(context);
+            softwareModel->Score(context);
         }
     }
+    else if (context.requestConfiguration.Acceleration.IsSoftwareFallbackEnabled()
+        && dispatcher.ShouldScoreInSoftware(latency))
+    {
+        FallbackDispatcher::SoftwareEntry entry{ dispatcher, latency };
+        GNA_TRACE(TraceEventType::Fallback, dispatcher.GetQueueDepth());
+        context.isFallback = true;
+        ScoreSubModelsInSoftware(context);
+        entry.Complete();
+    }
     else
     {
+        FallbackDispatcher::QueueEntry entry{ dispatcher, latency };
+        // while dispatching is enabled, further requests are started when this one is processed by device,
+        // so they may be dispatched to software
+        context.isDeviceWaitShared = context.requestConfiguration.Acceleration.IsSoftwareFallbackEnabled()
+            && 0 != dispatcher.GetSoftwareBudget();
         for (const auto& subModel : getSubModels())
         {
             context.Update(subModel.get());
             ScoreSubModel(context);
         }
+        entry.Complete();
     }
 }
 
+bool HybridModel::isBatchable(RequestConfiguration const & config) const
+{
+    return shouldUseSoftwareMode(config) && GetSoftwareModel().IsBatchable();
+}
+
+bool HybridModel::scoreBatch(std::vector<ScoreContext> & contexts)
+{
+    for (auto & context : contexts)
+    {
+        if (!shouldUseSoftwareMode(context.requestConfiguration))
+        {
+            return false;
+        }
+        context.requestConfiguration.UpdateConsistency(getSoftwareConsistencyDeviceVersion());
+    }
+    return GetSoftwareModel().ScoreBatch(contexts);
+}
+
 void HybridModel::ScoreSubModel(ScoreContext & context)
 {
     switch (context.subModelType)
@@ -118,6 +195,9 @@ void HybridModel::ScoreSubModel(ScoreContext & context)
     case Software:
         context.requestConfiguration.UpdateConsistency(Gna2DeviceVersionSoftwareEmulation);
         return softwareModelForPresentDevice->Score(context);
+    case HardwareInSoftware:
+        context.requestConfiguration.UpdateConsistency(hwCapabilities.GetDeviceVersion());
+        return softwareModelForPresentDevice->Score(context);
     }
 }
 
@@ -132,6 +212,8 @@ void HybridModel::ScoreHwSubModel(ScoreContext & context)
         if (context.requestConfiguration.Acceleration.IsSoftwareFallbackEnabled() && e.GetStatus() == Gna2StatusDeviceQueueError)
         {
             // fallback to Software mode with HW compatible model
+            GNA_TRACE(TraceEventType::Fallback, dispatcher.GetQueueDepth());
+            context.isFallback = true;
             context.requestConfiguration.UpdateConsistency(hwCapabilities.GetDeviceVersion());
             softwareModelForPresentDevice->Score(context);
         }
@@ -142,6 +224,17 @@ void HybridModel::ScoreHwSubModel(ScoreContext & context)
     }
 }
 
+void HybridModel::ScoreSubModelsInSoftware(ScoreContext & context)
+{
+    for (const auto& subModel : getSubModels())
+    {
+        context.Update(subModel.get());
+        context.requestConfiguration.UpdateConsistency(Software == subModel->Type ?
+            Gna2DeviceVersionSoftwareEmulation : hwCapabilities.GetDeviceVersion());
+        softwareModelForPresentDevice->Score(context);
+    }
+}
+
 const std::vector<std::unique_ptr<SubModel>>& HybridModel::getSubModels()
 {
     if (subModels.find(hwCapabilities.GetDeviceVersion()) == subModels.end())
@@ -165,6 +258,14 @@ SubModelType HybridModel::getSubModelType(
         return Software;
     }
 
+    auto const isHardwareLayer = hwCaps.IsOperationSupported(layer.Operation)
+        || (INTEL_GMM == layer.Operation && hwCaps.HasFeature(LegacyGMM));
+    // read-only registered memory is not mapped to device
+    if (isHardwareLayer && isUsingReadOnlyMemory(layerIndex))
+    {
+        return HardwareInSoftware;
+    }
+
     if (hwCaps.IsOperationSupported(layer.Operation))
     {
         return Hardware;
@@ -208,6 +309,123 @@ void HybridModel::createSubModels(const HardwareCapabilities& hwCaps)
             currentSubModel->AddLayer();
         }
     }
+
+    mergeHardwareIslands(deviceSubModels);
+}
+
+void HybridModel::mergeHardwareIslands(std::vector<std::unique_ptr<SubModel>> & deviceSubModels) const
+{
+    auto const hasSoftwareSubModel = std::any_of(deviceSubModels.begin(), deviceSubModels.end(),
+        [](auto && subModel) { return Software == subModel->Type; });
+    if (!hasSoftwareSubModel)
+    {
+        return;
+    }
+
+    std::vector<std::unique_ptr<SubModel>> merged;
+    auto island = deviceSubModels.begin();
+    while (deviceSubModels.end() != island)
+    {
+        if ((*island)->IsSoftware())
+        {
+            merged.emplace_back(std::move(*island++));
+            continue;
+        }
+        auto const islandEnd = std::find_if(island, deviceSubModels.end(),
+            [](auto && subModel) { return subModel->IsSoftware(); });
+
+        uint64_t hardwareCost = 0;
+        for (auto subModel = island; subModel != islandEnd; ++subModel)
+        {
+            hardwareCost += getSubModelCost(**subModel,
+                deviceSubModels.begin() != island && island == subModel,
+                deviceSubModels.end() != islandEnd && islandEnd == subModel + 1);
+        }
+        auto const firstLayer = (*island)->LayerIndex;
+        auto const lastLayer = (*(islandEnd - 1))->LayerIndex + (*(islandEnd - 1))->GetLayerCount();
+        uint64_t softwareCost = 0;
+        for (auto i = firstLayer; i < lastLayer; i++)
+        {
+            softwareCost += costModel.GetSoftwareCost(GetLayer(i));
+        }
+
+        if (softwareCost < hardwareCost)
+        {
+            merged.emplace_back(std::make_unique<SubModel>(HardwareInSoftware, firstLayer));
+            for (auto i = firstLayer + 1; i < lastLayer; i++)
+            {
+                merged.back()->AddLayer();
+            }
+            island = islandEnd;
+        }
+        else
+        {
+            for (; island != islandEnd; ++island)
+            {
+                merged.emplace_back(std::move(*island));
+            }
+        }
+    }
+    deviceSubModels = std::move(merged);
+}
+
+uint64_t HybridModel::getSubModelCost(SubModel const & subModel, bool isAfterSoftware, bool isBeforeSoftware) const
+{
+    auto const lastLayer = subModel.LayerIndex + subModel.GetLayerCount();
+    uint64_t cost = 0;
+    if (subModel.IsSoftware())
+    {
+        for (auto i = subModel.LayerIndex; i < lastLayer; i++)
+        {
+            cost += costModel.GetSoftwareCost(GetLayer(i));
+        }
+        return cost;
+    }
+
+    cost = costModel.GetSubmissionCost();
+    for (auto i = subModel.LayerIndex; i < lastLayer; i++)
+    {
+        cost += costModel.GetHardwareCost(GetLayer(i));
+    }
+    // data produced by software is read by device and vice versa
+    if (isAfterSoftware)
+    {
+        cost += costModel.GetTransferCost(GetLayer(subModel.LayerIndex).Input.Size);
+    }
+    if (isBeforeSoftware)
+    {
+        cost += costModel.GetTransferCost(GetLayer(lastLayer - 1).Output.Size);
+    }
+    return cost;
+}
+
+std::vector<Gna2ModelPartition> HybridModel::getPartitions()
+{
+    if (!hardwareModel)
+    {
+        return getSoftwarePartitions();
+    }
+
+    auto const & deviceSubModels = getSubModels();
+    std::vector<Gna2ModelPartition> partitions;
+    for (size_t i = 0; i < deviceSubModels.size(); i++)
+    {
+        auto const & subModel = *deviceSubModels[i];
+        auto target = Gna2PartitionTargetHardware;
+        if (Software == subModel.Type)
+        {
+            target = Gna2PartitionTargetSoftware;
+        }
+        else if (HardwareInSoftware == subModel.Type)
+        {
+            target = Gna2PartitionTargetSoftwareForHardware;
+        }
+        auto const cost = getSubModelCost(subModel,
+            i > 0 && deviceSubModels[i - 1]->IsSoftware(),
+            i + 1 < deviceSubModels.size() && deviceSubModels[i + 1]->IsSoftware());
+        partitions.push_back({ subModel.LayerIndex, subModel.GetLayerCount(), target, cost });
+    }
+    return partitions;
 }
 
 bool HybridModel::shouldSplit(SubModel& currentSubModel, SubModelType nextSubModelType, const HardwareCapabilities& hwCaps)
@@ -249,7 +467,7 @@ bool HybridModel::isFullyHardwareCompatible()
     return fullyHardwareCompatible;
 }
 
-bool HybridModel::shouldUseSoftwareMode(RequestConfiguration& config) const
+bool HybridModel::shouldUseSoftwareMode(RequestConfiguration const & config) const
 {
     const auto isSoftwareEffective = config.Acceleration.IsSoftwareEnforced() ||
         (config.Acceleration.GetMode() == Gna2AccelerationModeAuto && !hardwareModel);
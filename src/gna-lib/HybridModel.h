@@ -6,6 +6,7 @@
 #pragma once
 
 #include "CompiledModel.h"
+#include "FallbackDispatcher.h"
 #include "HardwareModelScorable.h"
 #include "MemoryContainer.h"
 #include "SoftwareModel.h"
@@ -40,7 +41,9 @@ public:
         const ApiModel & model,
         const AccelerationDetector& detectorIn,
         const HardwareCapabilities& hwCapabilitiesIn,
-        DriverInterface &ddi);
+        const PartitionCostModel& costModelIn,
+        DriverInterface &ddi,
+        FallbackDispatcher & dispatcherIn);
 
     virtual ~HybridModel() = default;
 
@@ -56,7 +59,7 @@ private:
         {
             return *softwareModelForPresentDevice;
         }
-        return softwareModel;
+        return *softwareModel;
     }
 
     SoftwareModel const & GetSoftwareModel() const override
@@ -65,19 +68,26 @@ private:
         {
             return *softwareModelForPresentDevice;
         }
-        return softwareModel;
+        return *softwareModel;
     }
 
     // software model for present hardware device to maintain consistency
     // used only for building hardware model
+    // when built, replaces software model with software emulation limitations
     std::unique_ptr<SoftwareModel> softwareModelForPresentDevice = {};
 
     std::unique_ptr<HardwareModelScorable> hardwareModel;
 
     bool fullyHardwareCompatible = false;
 
+    FallbackDispatcher & dispatcher;
+
+    ModelLatency latency;
+
     bool verifyFullyHardwareCompatible();
 
+    bool tryBuildPresentDeviceModel();
+
     void BuildHardwareModel(DriverInterface &ddi);
 
     const std::vector<std::unique_ptr<SubModel>>& getSubModels();
@@ -91,10 +101,17 @@ private:
 
     void score(ScoreContext & context) override;
 
+    bool isBatchable(RequestConfiguration const & config) const override;
+
+    bool scoreBatch(std::vector<ScoreContext> & contexts) override;
+
     void ScoreSubModel(ScoreContext & context);
 
     void ScoreHwSubModel(ScoreContext & context);
 
+    // Scores hardware sub-models in software with present device consistency
+    void ScoreSubModelsInSoftware(ScoreContext & context);
+
     std::map<DeviceVersion,
         std::vector<std::unique_ptr<SubModel>>> subModels = {};
 
@@ -104,7 +121,15 @@ private:
 
     bool isFullyHardwareCompatible() override;
 
-    bool shouldUseSoftwareMode(RequestConfiguration& config) const;
+    std::vector<Gna2ModelPartition> getPartitions() override;
+
+    // Moves hardware sub-models surrounded by software sub-models to software
+    // when estimated cheaper than their submissions and data transfers
+    void mergeHardwareIslands(std::vector<std::unique_ptr<SubModel>> & deviceSubModels) const;
+
+    uint64_t getSubModelCost(SubModel const & subModel, bool isAfterSoftware, bool isBeforeSoftware) const;
+
+    bool shouldUseSoftwareMode(RequestConfiguration const & config) const;
 
     DeviceVersion getSoftwareConsistencyDeviceVersion() const;
 };
@@ -6,8 +6,11 @@
 #pragma once
 
 #include "DriverInterface.h"
+#include "GnaException.h"
 #include "SubModel.h"
 
+#include <atomic>
+
 namespace GNA
 {
 
@@ -22,14 +25,19 @@ class RequestProfiler;
 struct ScoreContext
 {
     ScoreContext(uint32_t layerIndexIn, uint32_t layerCountIn,
-        RequestConfiguration& requestConfigurationIn, RequestProfiler &profilerIn, KernelBuffers *buffersIn) :
+        RequestConfiguration& requestConfigurationIn, RequestProfiler &profilerIn, KernelBuffers *buffersIn,
+        std::atomic<bool> const * cancellationIn = nullptr) :
         subModelType{ Software },
         layerIndex{ layerIndexIn },
         layerCount{ layerCountIn },
         requestConfiguration{ requestConfigurationIn },
         profiler{ profilerIn },
         buffers{ buffersIn },
-        saturationCount{ 0 }
+        saturationCount{ 0 },
+        driverTime{ 0 },
+        isFallback{ false },
+        isDeviceWaitShared{ false },
+        cancellation{ cancellationIn }
     {}
 
     SubModelType subModelType;
@@ -40,6 +48,27 @@ struct ScoreContext
     KernelBuffers *buffers;
     uint32_t saturationCount;
 
+    // Time of device processing in microseconds, including driver overhead
+    uint64_t driverTime;
+
+    // Set when request of hardware with software fallback mode is scored in software
+    bool isFallback;
+
+    // Set when other requests may be scored while device processes this request
+    bool isDeviceWaitShared;
+
+    // Set when request is canceled while being scored, nullptr when request cannot be canceled
+    std::atomic<bool> const * cancellation;
+
+    // Stops scoring of canceled request, checked before each operation and hardware submission
+    void ExpectNotCanceled() const
+    {
+        if (nullptr != cancellation && cancellation->load(std::memory_order_relaxed))
+        {
+            throw GnaException(Gna2StatusRequestCanceled);
+        }
+    }
+
     void Update(SubModel const * const subModel)
     {
         subModelType = subModel->Type;
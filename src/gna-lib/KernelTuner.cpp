@@ -0,0 +1,181 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "KernelTuner.h"
+
+#include "ActivationFunction.h"
+#include "ConvolutionalFunctions.h"
+#include "ConvolutionalFunctions2D.h"
+#include "ConvolutionalLayer.h"
+#include "Layer.h"
+#include "Logger.h"
+#include "PoolingFunctions.h"
+#include "PoolingFunctions2D.h"
+#include "RecurrentFunction.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+using namespace GNA;
+
+KernelTuner::KernelTuner(std::string cpuNameIn, std::vector<Gna2AccelerationMode> const & supportedCpuAccelerationsIn) :
+    cpuName{ std::move(cpuNameIn) },
+    supportedCpuAccelerations{ supportedCpuAccelerationsIn }
+{
+}
+
+void KernelTuner::Enable(std::string const & cacheFilePath)
+{
+    std::lock_guard<std::mutex> lockGuard(lock);
+    isEnabled = true;
+    filePath = cacheFilePath;
+    kernels.clear();
+    load();
+}
+
+bool KernelTuner::IsEnabled() const
+{
+    return isEnabled;
+}
+
+TunedKernel KernelTuner::Get(std::string const & signature)
+{
+    std::lock_guard<std::mutex> lockGuard(lock);
+    auto const found = kernels.find(signature);
+    if (kernels.end() == found)
+    {
+        return {};
+    }
+    return found->second;
+}
+
+void KernelTuner::Store(std::string const & signature, TunedKernel const & kernel)
+{
+    std::lock_guard<std::mutex> lockGuard(lock);
+    auto const inserted = kernels.emplace(signature, kernel);
+    if (!inserted.second || filePath.empty())
+    {
+        return;
+    }
+    std::ofstream file{ filePath, std::ios::app };
+    file << cpuName << '\t' << signature << '\t' << static_cast<int32_t>(kernel.Mode)
+        << '\t' << static_cast<int32_t>(kernel.IsPwlLookup) << '\n';
+    if (!file)
+    {
+        Log->Warning("Kernel tuning cache file %s cannot be written.\n", filePath.c_str());
+    }
+}
+
+static void appendDimensions(std::ostringstream & signature, Shape const & dimensions)
+{
+    for (auto const & dimension : dimensions)
+    {
+        signature << ' ' << dimension.first << ':' << dimension.second;
+    }
+}
+
+std::string KernelTuner::GetSignature(Layer const & layer)
+{
+    std::ostringstream signature;
+    signature << layer.Operation;
+    for (auto const operandIndex : { InputOperandIndex, OutputOperandIndex, WeightOperandIndex,
+        BiasOperandIndex, PwlOperandIndex, WeightScaleFactorOperandIndex })
+    {
+        signature << '/';
+        auto const * const operand = layer.TryGetOperand(operandIndex);
+        if (nullptr != operand)
+        {
+            signature << operand->Mode.Type;
+            appendDimensions(signature, operand->Dimensions);
+        }
+    }
+
+    // parameters not reflected in operand shapes
+    if (INTEL_CONVOLUTIONAL == layer.Operation)
+    {
+        auto const & cnn = *layer.Get<const CnnLayer>();
+        signature << "/stride";
+        appendDimensions(signature, cnn.Convolution->Stride->Dimensions);
+        if (cnn.Pooling)
+        {
+            signature << "/pooling " << cnn.Pooling->Mode;
+            appendDimensions(signature, cnn.Pooling->Window.Dimensions);
+            appendDimensions(signature, cnn.Pooling->Stride.Dimensions);
+        }
+    }
+    auto const * const convolution = layer.Transforms.GetOptional<ConvolutionFunction2D>(ConvolutionalTransform2D);
+    if (nullptr != convolution)
+    {
+        signature << "/stride";
+        appendDimensions(signature, convolution->Stride->Dimensions);
+        signature << "/padding";
+        appendDimensions(signature, convolution->Padding->Dimensions);
+    }
+    auto const * const pooling = layer.Transforms.GetOptional<PoolingFunction2D>(PoolingTransform2D);
+    if (nullptr != pooling)
+    {
+        signature << "/pooling " << pooling->Mode;
+        appendDimensions(signature, pooling->Window->Dimensions);
+        appendDimensions(signature, pooling->Stride->Dimensions);
+    }
+
+    // PWL algorithm is tuned only when lookup table is applicable
+    auto const * const pwl = GetPwl(layer);
+    if (nullptr != pwl && pwl->IsLookupApplicable())
+    {
+        signature << "/lookup";
+    }
+    return signature.str();
+}
+
+PwlCached const * KernelTuner::GetPwl(Layer const & layer)
+{
+    ActivationFunction const * activation = nullptr;
+    if (INTEL_CONVOLUTIONAL == layer.Operation)
+    {
+        activation = layer.Get<const CnnLayer>()->Activation.get();
+    }
+    else if (INTEL_RECURRENT == layer.Operation)
+    {
+        activation = &layer.Transforms.Get<RecurrentFunction>(RecurrentTransform).GetActivationFunction();
+    }
+    else
+    {
+        activation = layer.Transforms.GetOptional<ActivationFunction>(ActivationTransform);
+    }
+    return nullptr != activation ? activation->Pwl.get() : nullptr;
+}
+
+void KernelTuner::load()
+{
+    if (filePath.empty())
+    {
+        return;
+    }
+    std::ifstream file{ filePath };
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::istringstream entry{ line };
+        std::string entryCpuName;
+        std::string signature;
+        int32_t mode = 0;
+        int32_t isPwlLookup = 0;
+        if (!std::getline(entry, entryCpuName, '\t') || !std::getline(entry, signature, '\t')
+            || !(entry >> mode) || !(entry >> isPwlLookup) || !(entry >> std::ws).eof()
+            || (0 != isPwlLookup && 1 != isPwlLookup) || entryCpuName != cpuName)
+        {
+            continue;
+        }
+        auto const accelerationMode = static_cast<Gna2AccelerationMode>(mode);
+        if (std::find(supportedCpuAccelerations.begin(), supportedCpuAccelerations.end(), accelerationMode)
+            != supportedCpuAccelerations.end())
+        {
+            kernels[signature] = TunedKernel{ accelerationMode, 0 != isPwlLookup };
+        }
+    }
+}
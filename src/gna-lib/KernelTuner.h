@@ -0,0 +1,75 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "gna2-inference-api.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GNA
+{
+
+class Layer;
+struct PwlCached;
+
+// Kernels tuned for operation
+struct TunedKernel
+{
+    // Gna2AccelerationModeAuto when operation is not tuned yet
+    Gna2AccelerationMode Mode = Gna2AccelerationModeAuto;
+
+    // Whether PWL lookup table or binary search is used, when lookup is applicable
+    bool IsPwlLookup = true;
+};
+
+// Cache of software kernels tuned for operations on current CPU
+//
+// Operations are identified by signature of their type, parameters, data types and shapes,
+// so operations of the same signature share tuned kernels, also among models.
+// Cache file holds single entry per line: CPU name, signature, mode and PWL lookup flag separated by tabs,
+// entries of other CPUs are kept intact in the file, but not used.
+// Malformed entries, e.g. of former versions without PWL lookup flag, are ignored, so operations are tuned again.
+class KernelTuner
+{
+public:
+    KernelTuner(std::string cpuNameIn, std::vector<Gna2AccelerationMode> const & supportedCpuAccelerationsIn);
+    KernelTuner(const KernelTuner&) = delete;
+    KernelTuner& operator=(const KernelTuner&) = delete;
+
+    // Enables tuning of models loaded afterwards, empty cacheFilePath disables persistence
+    void Enable(std::string const & cacheFilePath);
+
+    bool IsEnabled() const;
+
+    TunedKernel Get(std::string const & signature);
+
+    void Store(std::string const & signature, TunedKernel const & kernel);
+
+    static std::string GetSignature(Layer const & layer);
+
+    // PWL of operation activation, nullptr when operation has no activation
+    static PwlCached const * GetPwl(Layer const & layer);
+
+private:
+    void load();
+
+    std::string const cpuName;
+
+    std::vector<Gna2AccelerationMode> const & supportedCpuAccelerations;
+
+    bool isEnabled = false;
+
+    std::string filePath;
+
+    std::map<std::string, TunedKernel> kernels;
+
+    std::mutex lock;
+};
+
+}
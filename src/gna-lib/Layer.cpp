@@ -18,6 +18,7 @@
 #include "ModelError.h"
 #include "ModelWrapper.h"
 #include "RecurrentLayer.h"
+#include "Request.h"
 #include "TransposeLayer.h"
 
 #include <map>
@@ -25,6 +26,115 @@
 
 using namespace GNA;
 
+namespace
+{
+
+Gna2InstrumentationStage getInstrumentationStage(TransformOperation operation)
+{
+    switch (operation)
+    {
+    case AffineTransform:
+    case AffineMultibiasTransform:
+        return Gna2InstrumentationStageAffine;
+    case AffineDiagonalTransform:
+        return Gna2InstrumentationStageElementWiseAffine;
+    case RecurrentTransform:
+        return Gna2InstrumentationStageRecurrent;
+    case ConvolutionalTransform1D:
+    case ConvolutionalTransform2D:
+        return Gna2InstrumentationStageConvolution;
+    case PoolingTransform1D:
+    case PoolingTransform2D:
+        return Gna2InstrumentationStagePooling;
+    case ActivationTransform:
+        return Gna2InstrumentationStageActivation;
+    case CopyTransform:
+        return Gna2InstrumentationStageCopy;
+    case TransposeTransform:
+        return Gna2InstrumentationStageTransposition;
+    case GmmTransform:
+        return Gna2InstrumentationStageGmm;
+    default:
+        throw GnaException(Gna2StatusXnnErrorLyrOperation);
+    }
+}
+
+uint64_t tryGetTransformOperandSize(BaseTransform const & transform, uint32_t operandIndex)
+{
+    try
+    {
+        return transform.GetOperand(operandIndex).Size;
+    }
+    catch (const GnaException&)
+    {
+        return 0;
+    }
+}
+
+uint64_t getMultiplyAccumulateCount(BaseTransform const & transform)
+{
+    switch (transform.Operation)
+    {
+    case AffineTransform:
+    case AffineMultibiasTransform:
+    case RecurrentTransform:
+    {
+        // weights [outputs x inputs], each output vector element takes whole weight row
+        auto const & weights = transform.GetOperand(WeightOperandIndex);
+        return uint64_t{ weights.Count } * transform.Output->Count / weights.at(GNA_DIM_H);
+    }
+    case AffineDiagonalTransform:
+        return transform.Output->Count;
+    case ConvolutionalTransform2D:
+    {
+        auto const & filters = transform.GetOperand(FilterOperandIndex);
+        return uint64_t{ filters.Count } * transform.Output->Count / filters.at(GNA_DIM_N);
+    }
+    case GmmTransform:
+        return uint64_t{ transform.GetOperand(GmmMeanOperandIndex).Count } * transform.Input->at(GNA_DIM_H);
+    default:
+        return 0;
+    }
+}
+
+// Input, output and parameters, parameter operand indices of transforms are the same as of operations
+uint64_t getTransformOperandsSize(BaseTransform const & transform)
+{
+    uint64_t size = 0;
+    if (nullptr != transform.Input)
+    {
+        size += transform.Input->Size;
+    }
+    if (transform.Output)
+    {
+        size += transform.Output->Size;
+    }
+    switch (transform.Operation)
+    {
+    case AffineTransform:
+    case AffineDiagonalTransform:
+    case RecurrentTransform:
+    case ConvolutionalTransform2D:
+        return size + tryGetTransformOperandSize(transform, WeightOperandIndex)
+            + tryGetTransformOperandSize(transform, BiasOperandIndex);
+    case AffineMultibiasTransform:
+        return size + tryGetTransformOperandSize(transform, WeightOperandIndex)
+            + tryGetTransformOperandSize(transform, BiasOperandIndex)
+            + tryGetTransformOperandSize(transform, WeightScaleFactorOperandIndex);
+    case ActivationTransform:
+        // activation transform keeps segments under first parameter index
+        return size + tryGetTransformOperandSize(transform, WeightOperandIndex);
+    case GmmTransform:
+        return size + tryGetTransformOperandSize(transform, GmmMeanOperandIndex)
+            + tryGetTransformOperandSize(transform, GmmInverseCovarianceOperandIndex)
+            + tryGetTransformOperandSize(transform, GmmGaussianConstantOperandIndex);
+    default:
+        return size;
+    }
+}
+
+}
+
 std::unique_ptr<Layer> Layer::Create(const Gna2Operation & operation, const BaseValidator & validatorIn)
 {
     ModelWrapper::ExpectOperationValid(operation);
@@ -246,15 +356,50 @@ void Layer::initComputeFunctions()
 void Layer::compute(const LayerConfiguration* layerConfiguration, AccelerationMode accel,
     ExecutionConfig const& execution) const
 {
+    auto * const profiler = execution.Profiler;
     for (const auto& transform : Transforms)
     {
         if (transform)
         {
+            if (nullptr == profiler)
+            {
+                transform->Compute(accel, layerConfiguration, execution);
+                continue;
+            }
+            auto const saturationCount = *execution.SaturationCount;
+            auto const startTime = profiler->GetTime();
             transform->Compute(accel, layerConfiguration, execution);
+            profiler->AddOperationResult(getInstrumentationStage(transform->Operation), startTime,
+                *execution.SaturationCount - saturationCount,
+                getMultiplyAccumulateCount(*transform), getTransformOperandsSize(*transform));
         }
     }
 }
 
+uint64_t Layer::GetMultiplyAccumulateCount() const
+{
+    uint64_t count = 0;
+    for (const auto& transform : Transforms)
+    {
+        if (transform)
+        {
+            count += getMultiplyAccumulateCount(*transform);
+        }
+    }
+    return count;
+}
+
+uint64_t Layer::GetOperandsSize() const
+{
+    uint64_t size = 0;
+    for (auto const operandIndex : { InputOperandIndex, OutputOperandIndex, WeightOperandIndex,
+        BiasOperandIndex, PwlOperandIndex, WeightScaleFactorOperandIndex })
+    {
+        size += TryGetOperandSize(operandIndex);
+    }
+    return size;
+}
+
 nn_operation AbstractOperation::toLegacy(
     const Gna2Operation& operation, const BaseValidator& validator)
 {
@@ -83,6 +83,12 @@ public:
 
     uint32_t TryGetOperandSize(uint32_t operandIndex) const;
 
+    // Estimated number of multiply-accumulates of single request, reported by software operation profiling
+    virtual uint64_t GetMultiplyAccumulateCount() const;
+
+    // Total size of operation operands, reported by software operation profiling
+    uint64_t GetOperandsSize() const;
+
     bool Is1BInputAnd2BWeight() const
     {
         return has1BInputAnd2BWeight;
@@ -70,6 +70,7 @@ const DataModeLimits& LayerCapabilities::GetCommonModes(uint32_t operandIndex, G
 
 constexpr StaticCaps LayerCapabilities::Input;
 constexpr StaticCaps LayerCapabilities::InputGroupMax;
+constexpr StaticCaps LayerCapabilities::InputGroupMaxLargeBatch;
 constexpr RangeLimits<uint32_t> LayerCapabilities::LegacyInputs;
 constexpr StaticCaps LayerCapabilities::InputEqual1;
 constexpr StaticCaps LayerCapabilities::Input1D;
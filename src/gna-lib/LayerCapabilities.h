@@ -40,6 +40,8 @@ struct LayerCapabilities
 
     static constexpr auto InputGroupMax = StaticCaps{ 1u, BatchSizeMax, 1u };
 
+    static constexpr auto InputGroupMaxLargeBatch = StaticCaps{ 1u, LargeBatchSizeMax, 1u };
+
     static constexpr RangeLimits<uint32_t> LegacyInputs = RangeLimits<uint32_t>
     {
         InputElementCountMultiplier,
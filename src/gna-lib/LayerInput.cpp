@@ -48,7 +48,8 @@ LayerInput::LayerInput(const Gna2Operation& operation, const LayerValidator& val
 try :
     Tensor{ Shape::Create(GetShape(operation), capabilities.GetOrder(validatorIn)),
        GetDataMode(*operation.Operands[InputOperandIndex]), operation.Operands[InputOperandIndex]->Data,
-       Validator{ validatorIn, capabilities, true }, InputOperandIndex },
+       Validator{ validatorIn, AffineLayerCapabilities::GetBatchOperands(validatorIn, capabilities, InputOperandIndex), true },
+       InputOperandIndex },
     Grouping{ getGrouping(operation, validatorIn) },
     ElementCount{ getElementCount(operation, validatorIn) }
 {
@@ -63,8 +63,9 @@ LayerOutput::LayerOutput(const Gna2Operation &operation, const LayerValidator& v
 try :
     Tensor{ Shape::Create(GetShape(operation), capabilities.GetOrder(validatorIn)),
         GetDataMode(*operation.Operands[OutputOperandIndex]), operation.Operands[OutputOperandIndex]->Data,
-        Validator{ validatorIn, capabilities, true }, OutputOperandIndex },
-    ScratchPad{ Dimensions, {Gna2DataTypeInt32, Gna2TensorModeDefault}, getScratchpadForOperation(validatorIn.Operation), ScratchpadOperandIndex },
+        Validator{ validatorIn, AffineLayerCapabilities::GetBatchOperands(validatorIn, capabilities, OutputOperandIndex), true },
+        OutputOperandIndex },
+    ScratchPad{ Dimensions, {Gna2DataTypeInt32, Gna2TensorModeDefault}, getScratchpadForOperation(operation, validatorIn), ScratchpadOperandIndex },
     Grouping{ getGrouping(operation, validatorIn) },
     ElementCount{ getElementCount(operation, validatorIn) }
 {
@@ -74,8 +75,9 @@ catch (GnaException&)
     GnaModelErrorException::DispatchAndFill(OutputOperandIndex);
 }
 
-void* LayerOutput::getScratchpadForOperation(const nn_operation& operation)
+void* LayerOutput::getScratchpadForOperation(const Gna2Operation &apiOperation, const LayerValidator& validatorIn)
 {
+    auto const operation = validatorIn.Operation;
     if (operation == INTEL_DEINTERLEAVE ||
         operation == INTEL_INTERLEAVE ||
         operation == INTEL_COPY ||
@@ -86,6 +88,12 @@ void* LayerOutput::getScratchpadForOperation(const nn_operation& operation)
         return nullptr;
     }
 
+    // large batch intermediate results may exceed global scratchpad, software scratchpad is used instead
+    if (AffineBaseLayer::IsLargeBatch(apiOperation, validatorIn))
+    {
+        return nullptr;
+    }
+
     return AffineBaseLayer::GetGlobal2MBScratchpad();
 }
 
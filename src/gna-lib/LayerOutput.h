@@ -21,7 +21,7 @@ struct LayerOutput : public Tensor
     const uint32_t Grouping;
     const uint32_t ElementCount;
 
-    static void * getScratchpadForOperation(const nn_operation &operation);
+    static void * getScratchpadForOperation(const Gna2Operation &apiOperation, const LayerValidator& validatorIn);
 
 protected:
     static const FullCapabilitiesMap capabilities;
@@ -402,8 +402,10 @@ void* LinuxDriverInterface::gemAlloc(uint32_t &size)
     return buffer;
 }
 
-Memory LinuxDriverInterface::MemoryCreate(uint32_t size, uint32_t ldSize)
+Memory LinuxDriverInterface::MemoryCreate(uint32_t size, uint32_t ldSize, bool zeroFill)
 {
+    // GEM objects are always zeroed by the kernel
+    UNREFERENCED_PARAMETER(zeroFill);
     Expect::InRange(size, 1u, Memory::GNA_MAX_MEMORY_FOR_SINGLE_ALLOC, Gna2StatusMemorySizeInvalid);
     auto gemObj = gemAlloc(size);
     Expect::NotNull(gemObj, Gna2StatusResourceAllocationError);
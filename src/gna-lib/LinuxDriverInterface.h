@@ -28,7 +28,7 @@ public:
 
     bool OpenDevice(uint32_t deviceIndex) override;
 
-    Memory MemoryCreate(uint32_t size, uint32_t ldSize = Memory::GNA_BUFFER_ALIGNMENT) override;
+    Memory MemoryCreate(uint32_t size, uint32_t ldSize = Memory::GNA_BUFFER_ALIGNMENT, bool zeroFill = true) override;
 
     uint64_t MemoryMap(void *memory, uint32_t memorySize) override;
     bool MemoryUnmap(uint64_t memoryId) override;
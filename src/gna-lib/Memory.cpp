@@ -12,6 +12,8 @@
 #include "gna2-memory-impl.h"
 #include "KernelArguments.h"
 
+#include <atomic>
+
 using namespace GNA;
 
 // just makes object from arguments
@@ -22,14 +24,41 @@ Memory::Memory(void* bufferIn, uint32_t userSize, uint32_t alignment) :
 {
 }
 
-// allocates and zeros memory
-Memory::Memory(const uint32_t userSize, uint32_t alignment) :
+// allocates and zeros memory, zeroing is skipped when zeroFill is false
+Memory::Memory(const uint32_t userSize, uint32_t alignment, bool zeroFill) :
     size{ RoundUp(userSize, alignment) }
 {
     Expect::InRange(size, 1u, GNA_MAX_MEMORY_FOR_SINGLE_ALLOC, Gna2StatusMemorySizeInvalid);
     buffer = _gna_malloc(size);
     Expect::ValidBuffer(buffer);
-    memset(buffer, 0, size); // this is costly and probably not needed
+    if (zeroFill)
+    {
+        memset(buffer, 0, size); // this is costly, callers overwriting whole buffer should skip it
+    }
+}
+
+Memory::Memory(Memory&& other) noexcept :
+    Address{ other.buffer },
+    id{ other.id },
+    size{ other.size },
+    tag{ other.tag },
+    mapped{ other.mapped },
+    allocationOwner{ other.allocationOwner },
+    readOnlyMapped{ other.readOnlyMapped }
+{
+    other.mapped = false;
+    other.allocationOwner = false;
+}
+
+std::unique_ptr<Memory> Memory::CreateReadOnlyMapped(void * bufferIn, uint32_t userSize)
+{
+    Expect::ValidBuffer(bufferIn);
+    Expect::InRange(userSize, 1u, GNA_MAX_MEMORY_FOR_SINGLE_ALLOC, Gna2StatusMemorySizeInvalid);
+    // size is not rounded up as region past user size may be not backed by the file
+    auto memory = std::make_unique<Memory>(bufferIn, userSize, 1);
+    memory->readOnlyMapped = true;
+    memory->SetTag(Gna2MemoryTagReadOnlyMapped);
+    return memory;
 }
 
 Memory::~Memory()
@@ -89,9 +118,17 @@ uint64_t Memory::GetId() const
     return id;
 }
 
+static std::atomic<uint32_t> tagVersion{ 0 };
+
 void Memory::SetTag(uint32_t newTag)
 {
     tag = newTag;
+    ++tagVersion;
+}
+
+uint32_t Memory::GetTagVersion()
+{
+    return tagVersion.load();
 }
 
 Gna2MemoryTag Memory::GetMemoryTag() const
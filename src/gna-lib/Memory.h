@@ -12,6 +12,7 @@
 #include <mm_malloc.h>
 #endif
 #include <cstdint>
+#include <memory>
 
 namespace GNA
 {
@@ -33,11 +34,15 @@ public:
     // just makes object from arguments
     Memory(void * bufferIn, uint32_t userSize, uint32_t alignment = GNA_BUFFER_ALIGNMENT);
 
-    // allocates and zeros memory
-    Memory(const uint32_t userSize, uint32_t alignment = GNA_BUFFER_ALIGNMENT);
+    // allocates and zeros memory, zeroing is skipped when zeroFill is false
+    Memory(const uint32_t userSize, uint32_t alignment = GNA_BUFFER_ALIGNMENT, bool zeroFill = true);
+
+    // registers user provided read-only region (e.g., mmap'ed file), never mapped to device
+    static std::unique_ptr<Memory> CreateReadOnlyMapped(void * bufferIn, uint32_t userSize);
 
     Memory(const Memory&) = delete;
-    Memory(Memory&&) = default;
+    // moved from object does not own buffer any more
+    Memory(Memory&& other) noexcept;
     Memory& operator=(const Memory&) = delete;
     Memory& operator=(Memory&&) = delete;
 
@@ -61,8 +66,16 @@ public:
 
     void SetTag(uint32_t newTag);
 
+    bool IsReadOnlyMapped() const
+    {
+        return readOnlyMapped;
+    }
+
     Gna2MemoryTag GetMemoryTag() const;
 
+    // Changed by each tag change, so tag checks cached for requests can be revalidated
+    static uint32_t GetTagVersion();
+
     static const uint32_t GNA_BUFFER_ALIGNMENT = 64;
     static constexpr uint32_t GNA_MAX_MEMORY_FOR_SINGLE_ALLOC = 1 << 28;
 
@@ -76,6 +89,8 @@ protected:
     bool mapped = false;
 
     bool allocationOwner = true;
+
+    bool readOnlyMapped = false;
 };
 
 }
@@ -5,8 +5,11 @@
 
 #include "ModelExportConfig.h"
 
+#include "CompiledModel.h"
 #include "DeviceManager.h"
 #include "GnaException.h"
+#include "HardwareModelNoMMU.h"
+#include "Memory.h"
 
 #include "gna2-model-export-impl.h"
 #include "gna2-model-suecreek-header.h"
@@ -21,7 +24,11 @@ ModelExportConfig::ModelExportConfig(Gna2UserAllocator userAllocatorIn) :
     Expect::NotNull(userAllocator);
 }
 
-void ModelExportConfig::Export(Gna2ModelExportComponent componentType, void ** exportBuffer, uint32_t * exportBufferSize) const
+ModelExportConfig::ModelExportConfig(ModelExportConfig&&) noexcept = default;
+
+ModelExportConfig::~ModelExportConfig() = default;
+
+void ModelExportConfig::Export(Gna2ModelExportComponent componentType, void ** exportBuffer, uint32_t * exportBufferSize)
 {
     Expect::NotNull(exportBufferSize);
     Expect::NotNull(exportBuffer);
@@ -55,7 +62,7 @@ void ModelExportConfig::Export(Gna2ModelExportComponent componentType, void ** e
 
     if (targetDeviceVersion == Gna2DeviceVersionEmbedded3_1)
     {
-        DumpComponentNoMMu(model, userAllocator, *exportBuffer, *exportBufferSize, componentType, targetDeviceVersion);
+        getHardwareModel(model).ExportComponent(*exportBuffer, *exportBufferSize, componentType);
         return;
     }
 
@@ -69,6 +76,7 @@ void ModelExportConfig::SetSource(uint32_t deviceId, uint32_t modelId)
     sourceDeviceId = deviceId;
     sourceModelId = modelId;
     targetDeviceVersion = device.GetVersion();
+    hardwareModel.reset();
 }
 
 void ModelExportConfig::SetTarget(Gna2DeviceVersion version) const
@@ -90,6 +98,31 @@ void ModelExportConfig::ValidateState() const
     Expect::True(is1x0Embedded || is3x0Embedded, Gna2StatusAccelerationModeNotSupported);
 }
 
+HardwareModelNoMMU & ModelExportConfig::getHardwareModel(CompiledModel const & model)
+{
+    // memory tags may be changed between exports, e.g., with Gna2MemorySetTag()
+    auto allocations = getAllocationSignature(model);
+    if (!hardwareModel || &model != hardwareModelSource || allocations != hardwareModelAllocations)
+    {
+        hardwareModel.reset();
+        hardwareModel = std::make_unique<HardwareModelNoMMU>(model, userAllocator, targetDeviceVersion);
+        hardwareModelSource = &model;
+        hardwareModelAllocations = std::move(allocations);
+    }
+    return *hardwareModel;
+}
+
+ModelExportConfig::AllocationSignature ModelExportConfig::getAllocationSignature(CompiledModel const & model)
+{
+    AllocationSignature signature;
+    for (auto && buffer : model.GetAllocations())
+    {
+        auto const & memory = buffer.get();
+        signature.emplace_back(memory.GetBuffer(), memory.GetSize(), memory.GetMemoryTag());
+    }
+    return signature;
+}
+
 inline void * ModelExportConfig::privateAllocator(uint32_t size)
 {
     return _mm_malloc(size, 4096);
@@ -11,18 +11,27 @@
 #include "gna2-common-impl.h"
 
 #include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
 
 namespace GNA
 {
+class CompiledModel;
+class HardwareModelNoMMU;
+
 class ModelExportConfig
 {
 public:
     explicit ModelExportConfig(Gna2UserAllocator userAllocatorIn);
+    ModelExportConfig(ModelExportConfig&&) noexcept;
+    ~ModelExportConfig();
+
     void SetSource(uint32_t deviceId, uint32_t modelId);
     void SetTarget(Gna2DeviceVersion version) const;
     void Export(enum Gna2ModelExportComponent componentType,
         void ** exportBuffer,
-        uint32_t * exportBufferSize) const;
+        uint32_t * exportBufferSize);
 
 protected:
     void ValidateState() const;
@@ -33,6 +42,18 @@ private:
     uint32_t sourceModelId = Gna2DisabledU32;
     Gna2DeviceVersion targetDeviceVersion = Gna2DeviceVersionSoftwareEmulation;
 
+    HardwareModelNoMMU & getHardwareModel(CompiledModel const & model);
+
+    // Buffer, size and tag of each model allocation, as export allocations are prepared from them
+    using AllocationSignature = std::vector<std::tuple<void const *, uint32_t, Gna2MemoryTag>>;
+
+    static AllocationSignature getAllocationSignature(CompiledModel const & model);
+
+    // Hardware model of source model, shared by all components until source model or its allocations change
+    std::unique_ptr<HardwareModelNoMMU> hardwareModel;
+    CompiledModel const * hardwareModelSource = nullptr;
+    AllocationSignature hardwareModelAllocations;
+
     static void* privateAllocator(uint32_t size);
     static void privateDeAllocator(void * ptr);
 };
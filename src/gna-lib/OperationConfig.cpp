@@ -177,8 +177,9 @@ void OperationConfig::InitMultibias(const Gna2Operation& operation)
 
     auto wsfIndex = ModelWrapper::GetOperationInfo(operation.Type, OperandIndexWeightScaleFactors);
 
-    // GNA 2.0 backward compatibility only
-    if (Gna2DataTypeInt8 == WeightsTensor.Type
+    // GNA 2.0 backward compatibility, and 4-bit weights of software only models
+    if ((Gna2DataTypeInt8 == WeightsTensor.Type || Gna2DataTypeInt4 == WeightsTensor.Type
+            || Gna2DataTypeUint4 == WeightsTensor.Type)
         && Gna2DataTypeInt16 == operation.Operands[InputOperandIndex]->Type)
     {
         WeightScalesTensor = ModelWrapper::GetEnabledOperand(operation, wsfIndex);
@@ -0,0 +1,50 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "PartitionCostModel.h"
+
+#include "Expect.h"
+#include "Layer.h"
+
+#include <algorithm>
+
+using namespace GNA;
+
+PartitionCostModel::PartitionCostModel(Gna2PartitionCosts const & costsIn) :
+    costs{ costsIn }
+{
+    for (auto const throughput : { costs.SoftwareMacsPerMicrosecond, costs.SoftwareBytesPerMicrosecond,
+        costs.HardwareMacsPerMicrosecond, costs.HardwareBytesPerMicrosecond, costs.TransferBytesPerMicrosecond })
+    {
+        Expect::GtZero(throughput, Gna2StatusDeviceParameterOutOfRange);
+    }
+}
+
+uint64_t PartitionCostModel::GetSoftwareCost(Layer const & layer) const
+{
+    return getCost(layer, costs.SoftwareMacsPerMicrosecond, costs.SoftwareBytesPerMicrosecond);
+}
+
+uint64_t PartitionCostModel::GetHardwareCost(Layer const & layer) const
+{
+    return getCost(layer, costs.HardwareMacsPerMicrosecond, costs.HardwareBytesPerMicrosecond);
+}
+
+uint64_t PartitionCostModel::GetTransferCost(uint64_t size) const
+{
+    return size * 1000 / costs.TransferBytesPerMicrosecond;
+}
+
+uint64_t PartitionCostModel::GetSubmissionCost() const
+{
+    return costs.SubmissionTime;
+}
+
+uint64_t PartitionCostModel::getCost(Layer const & layer, uint64_t macsPerMicrosecond, uint64_t bytesPerMicrosecond)
+{
+    auto const computeCost = layer.GetMultiplyAccumulateCount() * 1000 / macsPerMicrosecond;
+    auto const memoryCost = layer.GetOperandsSize() * 1000 / bytesPerMicrosecond;
+    return (std::max)(computeCost, memoryCost);
+}
@@ -0,0 +1,47 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "gna2-device-api.h"
+
+#include <cstdint>
+
+namespace GNA
+{
+
+class Layer;
+
+// Coarse estimates in nanoseconds of processing single request, used to partition hybrid models
+//
+// Operation time is bound by either multiply-accumulates or operand memory traffic.
+// Each device sub-model adds cost of driver submission,
+// data crossing boundary between software and device sub-models adds cost of memory synchronization.
+// Defaults are documented with Gna2PartitionCosts and may be changed per device.
+class PartitionCostModel
+{
+public:
+    PartitionCostModel() = default;
+
+    // Throws when any of throughputs is zero
+    explicit PartitionCostModel(Gna2PartitionCosts const & costsIn);
+
+    uint64_t GetSoftwareCost(Layer const & layer) const;
+
+    uint64_t GetHardwareCost(Layer const & layer) const;
+
+    // Cost of passing data of given size between software and device
+    uint64_t GetTransferCost(uint64_t size) const;
+
+    // Cost of driver submission and completion of single device sub-model
+    uint64_t GetSubmissionCost() const;
+
+private:
+    static uint64_t getCost(Layer const & layer, uint64_t macsPerMicrosecond, uint64_t bytesPerMicrosecond);
+
+    Gna2PartitionCosts costs = { 50000, 4000, 16000, 12800, 8000, 4000 };
+};
+
+}
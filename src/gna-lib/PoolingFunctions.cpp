@@ -110,5 +110,5 @@ void PoolingFunction::Compute(const ConvolutionConfig * convolutionConfig, Accel
     const PwlCached * pwl) const
 {
     auto poolConfig = PoolingConfig{ hiddenConfig.get(), poolScratchPad };
-    kernels.at(accel)(convolutionConfig, &poolConfig, pwl);
+    kernels.Get(accel)(convolutionConfig, &poolConfig, pwl);
 }
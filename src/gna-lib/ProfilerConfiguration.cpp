@@ -8,6 +8,7 @@
 #include "Expect.h"
 #include "Request.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <utility>
 
@@ -118,6 +119,36 @@ void ProfilerConfiguration::SetResult(uint32_t const index, uint64_t const value
     Results[index] = value;
 }
 
+void ProfilerConfiguration::SetOperationResults(uint32_t const numberOfResults,
+    Gna2InstrumentationOperationResult* const results)
+{
+    if (nullptr != results)
+    {
+        Expect::GtZero(numberOfResults, Gna2StatusDeviceParameterOutOfRange);
+    }
+    OperationResults = results;
+    OperationResultsCapacity = (nullptr != results) ? numberOfResults : 0;
+    NumberOfOperationResults = 0;
+}
+
+uint32_t ProfilerConfiguration::GetOperationResultsCapacity() const
+{
+    return OperationResultsCapacity;
+}
+
+void ProfilerConfiguration::SaveOperationResults(
+    const std::vector<Gna2InstrumentationOperationResult>& results, uint32_t const count) const
+{
+    auto const saved = std::min(static_cast<uint32_t>(results.size()), OperationResultsCapacity);
+    std::copy_n(results.cbegin(), saved, OperationResults);
+    NumberOfOperationResults = count;
+}
+
+uint32_t ProfilerConfiguration::GetNumberOfOperationResults() const
+{
+    return NumberOfOperationResults;
+}
+
 uint32_t ProfilerConfigurationManager::CreateConfiguration(
     std::vector<Gna2InstrumentationPoint>&& selectedInstrumentationPoints,
     uint64_t* results)
@@ -46,9 +46,22 @@ public:
 
     void SetResult(uint32_t index, uint64_t value) const;
 
+    void SetOperationResults(uint32_t numberOfResults, Gna2InstrumentationOperationResult* results);
+
+    uint32_t GetOperationResultsCapacity() const;
+
+    // Saves results that fit buffer, count includes dropped results
+    void SaveOperationResults(const std::vector<Gna2InstrumentationOperationResult>& results, uint32_t count) const;
+
+    uint32_t GetNumberOfOperationResults() const;
+
 private:
     uint64_t* Results = nullptr;
 
+    Gna2InstrumentationOperationResult* OperationResults = nullptr;
+    uint32_t OperationResultsCapacity = 0;
+    mutable uint32_t NumberOfOperationResults = 0;
+
     Gna2InstrumentationMode HwPerfEncoding = Gna2InstrumentationModeTotalStall;
     Gna2InstrumentationUnit Unit = Gna2InstrumentationUnitMicroseconds;
 };
@@ -49,6 +49,11 @@ public:
 
     const ActivationFunction& GetActivationFunction() const;
 
+    uint32_t GetFeedbackDelay() const
+    {
+        return FeedbackDelay;
+    }
+
     virtual Tensor const & GetOperand(uint32_t operandIndex) const override;
 
     std::unique_ptr<const WeightTensor> Weights;
@@ -4,9 +4,11 @@
 */
 
 #include "CompiledModel.h"
+#include "IScorable.h"
 #include "profiler.h"
 #include "Request.h"
 #include "RequestConfiguration.h"
+#include "Session.h"
 
 #include <algorithm>
 #include <memory>
@@ -15,17 +17,130 @@ struct KernelBuffers;
 
 using namespace GNA;
 
-Request::Request(RequestConfiguration& config, std::unique_ptr<RequestProfiler> profiler) :
+Request::Request(RequestConfiguration& config, std::unique_ptr<RequestProfiler> profiler, Session * sessionIn) :
     Configuration(config),
-    Profiler{std::move(profiler)}
+    Profiler{std::move(profiler)},
+    Cancellation{ std::make_shared<std::atomic<bool>>(false) },
+    session{ sessionIn }
 {
     Expect::NotNull(Profiler);
-    auto callback = [&](KernelBuffers *buffers, RequestProfiler & profilerPtr)
+    future = result.get_future();
+    if (Configuration.GetDeadline() > 0)
     {
-        return Configuration.Model.Score(Configuration, profilerPtr, buffers);
-    };
-    scoreTask = std::packaged_task<Gna2Status(KernelBuffers *buffers, RequestProfiler &profilerIn)>(callback);
-    future = scoreTask.get_future();
+        Deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(Configuration.GetDeadline());
+    }
+    if (nullptr != session)
+    {
+        session->AddPendingRequest();
+    }
+}
+
+Request::~Request()
+{
+    if (nullptr != session)
+    {
+        session->RemovePendingRequest();
+    }
+}
+
+void Request::operator()(KernelBuffers *buffers)
+{
+    start();
+    if (nullptr != session)
+    {
+        result.set_value(session->Score(*Profiler, buffers, Cancellation.get()));
+        return;
+    }
+    result.set_value(Configuration.Model.Score(Configuration, *Profiler, buffers, Cancellation.get()));
+}
+
+bool Request::TryDrop()
+{
+    if (*Cancellation)
+    {
+        drop(Gna2StatusRequestCanceled);
+        return true;
+    }
+    if (std::chrono::steady_clock::time_point::max() != Deadline && std::chrono::steady_clock::now() > Deadline)
+    {
+        drop(Gna2StatusRequestDeadlineExceeded);
+        return true;
+    }
+    return false;
+}
+
+void Request::start()
+{
+    if (isStarted)
+    {
+        return;
+    }
+    isStarted = true;
+    auto const queueWait = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - enqueueTime).count());
+    Configuration.Model.GetStatistics().AddQueueWait(queueWait);
+    Configuration.Statistics.AddQueueWait(queueWait);
+}
+
+void Request::drop(Gna2Status status)
+{
+    Configuration.Model.GetStatistics().AddDropped(status);
+    Configuration.Statistics.AddDropped(status);
+    result.set_value(status);
+}
+
+bool Request::IsBatchable() const
+{
+    return nullptr == session && !Profiler->IsOperationProfilingEnabled()
+        && Configuration.Model.IsBatchable(Configuration);
+}
+
+bool Request::IsBatchableWith(Request const & first) const
+{
+    return &Configuration.Model == &first.Configuration.Model && IsBatchable();
+}
+
+void Request::ScoreBatch(std::vector<Request *> const & requests, KernelBuffers *buffers)
+{
+    std::vector<Request *> batch;
+    for (auto * const request : requests)
+    {
+        if (!request->TryDrop())
+        {
+            batch.push_back(request);
+        }
+    }
+    if (batch.size() < 2)
+    {
+        for (auto * const request : batch)
+        {
+            (*request)(buffers);
+        }
+        return;
+    }
+
+    auto & model = batch.front()->Configuration.Model;
+    std::vector<ScoreContext> contexts;
+    for (auto * const request : batch)
+    {
+        request->start();
+        contexts.emplace_back(0, model.LayerCount, request->Configuration, *request->Profiler, buffers);
+    }
+
+    if (!model.ScoreBatch(contexts))
+    {
+        for (auto * const request : batch)
+        {
+            (*request)(buffers);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+        batch[i]->result.set_value(contexts[i].saturationCount > 0 ?
+            Gna2StatusWarningArithmeticSaturation : Gna2StatusSuccess);
+    }
 }
 
 Gna2Status Request::WaitFor(uint64_t milliseconds)
@@ -60,12 +175,22 @@ void RequestProfiler::AddResults(Gna2InstrumentationPoint point, uint64_t result
 
 void MillisecondProfiler::Measure(Gna2InstrumentationPoint pointType)
 {
-    Points.at(pointType) = static_cast<uint64_t>(std::chrono::duration_cast<chronoMs>(chronoClock::now().time_since_epoch()).count());
+    Points.at(pointType) = GetTime();
+}
+
+uint64_t MillisecondProfiler::GetTime() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<chronoMs>(chronoClock::now().time_since_epoch()).count());
 }
 
 void MicrosecondProfiler::Measure(Gna2InstrumentationPoint pointType)
 {
-    Points.at(pointType) = static_cast<uint64_t>(std::chrono::duration_cast<chronoUs>(chronoClock::now().time_since_epoch()).count());
+    Points.at(pointType) = GetTime();
+}
+
+uint64_t MicrosecondProfiler::GetTime() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<chronoUs>(chronoClock::now().time_since_epoch()).count());
 }
 
 void CycleProfiler::Measure(Gna2InstrumentationPoint pointType)
@@ -73,6 +198,13 @@ void CycleProfiler::Measure(Gna2InstrumentationPoint pointType)
     getTsc(&Points.at(pointType));
 }
 
+uint64_t CycleProfiler::GetTime() const
+{
+    uint64_t cycles = 0;
+    getTsc(&cycles);
+    return cycles;
+}
+
 void RequestProfiler::SaveResults(ProfilerConfiguration* config)
 {
     uint32_t i = 0;
@@ -80,6 +212,25 @@ void RequestProfiler::SaveResults(ProfilerConfiguration* config)
     {
         config->SetResult(i++, Points.at(selectedPoint));
     }
+    config->SaveOperationResults(OperationResults, NumberOfOperationResults);
+}
+
+void RequestProfiler::SetOperation(uint32_t const operationIndex, Gna2AccelerationMode const accelerationMode)
+{
+    OperationIndex = operationIndex;
+    AccelerationMode = accelerationMode;
+}
+
+void RequestProfiler::AddOperationResult(Gna2InstrumentationStage const stage, uint64_t const startTime,
+    uint32_t const saturationCount, uint64_t const multiplyAccumulateCount, uint64_t const byteCount)
+{
+    auto const stopTime = GetTime();
+    NumberOfOperationResults++;
+    if (OperationResults.size() < OperationResultsCapacity)
+    {
+        OperationResults.push_back({ OperationIndex, stage, AccelerationMode, saturationCount,
+            stopTime - startTime, multiplyAccumulateCount, byteCount });
+    }
 }
 
 std::unique_ptr<RequestProfiler> RequestProfiler::Create(ProfilerConfiguration* config)
@@ -89,17 +240,24 @@ std::unique_ptr<RequestProfiler> RequestProfiler::Create(ProfilerConfiguration*
         return std::make_unique<DisabledProfiler>();
     }
 
+    std::unique_ptr<RequestProfiler> profiler;
     switch (config->GetUnit())
     {
     case Gna2InstrumentationUnitMicroseconds:
-        return std::make_unique<MicrosecondProfiler>();
+        profiler = std::make_unique<MicrosecondProfiler>();
+        break;
     case Gna2InstrumentationUnitMilliseconds:
-        return std::make_unique<MillisecondProfiler>();
+        profiler = std::make_unique<MillisecondProfiler>();
+        break;
     case Gna2InstrumentationUnitCycles:
-        return std::make_unique<CycleProfiler>();
+        profiler = std::make_unique<CycleProfiler>();
+        break;
     default:
         throw GnaException(Gna2StatusIdentifierInvalid);
     }
+    profiler->OperationResultsCapacity = config->GetOperationResultsCapacity();
+    profiler->OperationResults.reserve(profiler->OperationResultsCapacity);
+    return profiler;
 }
 
 uint64_t RequestProfiler::ConvertElapsedTime(uint64_t frequency, uint64_t multiplier,
@@ -124,3 +282,8 @@ void DisabledProfiler::SaveResults(ProfilerConfiguration* config)
 {
     UNREFERENCED_PARAMETER(config);
 }
+
+uint64_t DisabledProfiler::GetTime() const
+{
+    return 0;
+}
@@ -8,6 +8,8 @@
 #include "gna2-common-api.h"
 #include "gna2-instrumentation-api.h"
 
+#include <atomic>
+#include <chrono>
 #include <future>
 #include <memory>
 #include <vector>
@@ -19,6 +21,7 @@ namespace GNA
     class ProfilerConfiguration;
     class RequestConfiguration;
     class RequestProfiler;
+    class Session;
 
 /**
  * Library level request processing profiler
@@ -41,11 +44,40 @@ public:
 
     virtual void SaveResults(ProfilerConfiguration* config);
 
+    // Current time in units of profiler
+    virtual uint64_t GetTime() const = 0;
+
+    /**
+     * Software operation profiling is enabled when profiler configuration has operation results buffer.
+     * Results are collected to buffer preallocated on profiler creation.
+     */
+    bool IsOperationProfilingEnabled() const
+    {
+        return OperationResultsCapacity > 0;
+    }
+
+    // Sets operation that subsequent operation results are reported for
+    void SetOperation(uint32_t operationIndex, Gna2AccelerationMode accelerationMode);
+
+    void AddOperationResult(Gna2InstrumentationStage stage, uint64_t startTime, uint32_t saturationCount,
+        uint64_t multiplyAccumulateCount, uint64_t byteCount);
+
     static uint64_t ConvertElapsedTime(uint64_t frequency, uint64_t multiplier,
         uint64_t start, uint64_t stop);
 protected:
 
     std::vector<uint64_t> Points;
+
+    std::vector<Gna2InstrumentationOperationResult> OperationResults;
+
+    uint32_t OperationResultsCapacity = 0;
+
+    // Includes results dropped when buffer is full
+    uint32_t NumberOfOperationResults = 0;
+
+    uint32_t OperationIndex = 0;
+
+    Gna2AccelerationMode AccelerationMode = Gna2AccelerationModeGeneric;
 }; // Library level request processing profiler
 
 class DisabledProfiler : public RequestProfiler
@@ -59,24 +91,28 @@ public:
     void Measure(Gna2InstrumentationPoint point) override;
     void AddResults(Gna2InstrumentationPoint point, uint64_t result) override;
     void SaveResults(ProfilerConfiguration* config) override;
+    uint64_t GetTime() const override;
 };
 
 class MicrosecondProfiler : public RequestProfiler
 {
 public:
     void Measure(Gna2InstrumentationPoint point) override;
+    uint64_t GetTime() const override;
 };
 
 class MillisecondProfiler : public RequestProfiler
 {
 public:
     void Measure(Gna2InstrumentationPoint point) override;
+    uint64_t GetTime() const override;
 };
 
 class CycleProfiler : public RequestProfiler
 {
 public:
     void Measure(Gna2InstrumentationPoint point) override;
+    uint64_t GetTime() const override;
 };
 
 /**
@@ -85,17 +121,37 @@ public:
 class Request
 {
 public:
-    Request(RequestConfiguration& config, std::unique_ptr<RequestProfiler> profiler);
-    ~Request() = default;
+    Request(RequestConfiguration& config, std::unique_ptr<RequestProfiler> profiler, Session * sessionIn = nullptr);
+    ~Request();
     Request() = delete;
     Request(const Request &) = delete;
     Request& operator=(const Request&) = delete;
 
     Gna2Status WaitFor(uint64_t milliseconds);
 
-    void operator()(KernelBuffers *buffers)
+    void operator()(KernelBuffers *buffers);
+
+    // Whether request may be scored coalesced with other requests, see ScoreBatch()
+    bool IsBatchable() const;
+
+    // Whether request may be scored coalesced with batch started by first request
+    bool IsBatchableWith(Request const & first) const;
+
+    /**
+     * Scores requests for the same model coalesced into single grouped execution,
+     * requests are scored one by one when batch is not applicable for their configurations.
+     * Outputs and statuses are the same as if requests were scored one by one in order.
+     */
+    static void ScoreBatch(std::vector<Request *> const & requests, KernelBuffers *buffers);
+
+    // Completes request without processing when it was canceled or its deadline expired,
+    // returns whether request was completed
+    bool TryDrop();
+
+    // Whether both requests were enqueued with the same session
+    bool IsOfSameSession(Request const & other) const
     {
-        scoreTask(buffers, *Profiler);
+        return nullptr != session && session == other.session;
     }
 
     // External id (0-GNA_REQUEST_WAIT_ANY)
@@ -104,8 +160,27 @@ public:
 
     std::unique_ptr<RequestProfiler> Profiler;
 
+    // Time by which processing has to start, requests without deadline have maximum time
+    std::chrono::steady_clock::time_point Deadline = std::chrono::steady_clock::time_point::max();
+
+    // Set to cancel request, shared so request being scored can be canceled without accessing request
+    std::shared_ptr<std::atomic<bool>> const Cancellation;
+
 private:
-    std::packaged_task<Gna2Status(KernelBuffers *buffers, RequestProfiler &profiler)> scoreTask;
+    // Records time request waited in queue when its processing starts
+    void start();
+
+    // Completes request without processing and records it in statistics
+    void drop(Gna2Status status);
+
+    // Session advanced by request, nullptr for requests enqueued without session
+    Session * session;
+
+    std::chrono::steady_clock::time_point const enqueueTime = std::chrono::steady_clock::now();
+
+    bool isStarted = false;
+
+    std::promise<Gna2Status> result;
 
     std::future<Gna2Status> future;
 };
@@ -33,8 +33,32 @@ void RequestBuilder::CreateConfiguration(CompiledModel& model, uint32_t *configI
     configurations.emplace(*configId, std::make_unique<RequestConfiguration>(model, *configId, hardwareCapabilities));
 }
 
+uint32_t RequestBuilder::assignSessionId()
+{
+    static uint32_t sessionIdSequence = 0;
+    return sessionIdSequence++;
+}
+
 void RequestBuilder::ReleaseConfiguration(uint32_t configId)
 {
+    for (auto const & session : sessions)
+    {
+        if (configId == session.second->Configuration.Id && session.second->HasPendingRequests())
+        {
+            throw GnaException(Gna2StatusWarningDeviceBusy);
+        }
+    }
+    for (auto session = sessions.begin(); session != sessions.end();)
+    {
+        if (configId == session->second->Configuration.Id)
+        {
+            session = sessions.erase(session);
+        }
+        else
+        {
+            ++session;
+        }
+    }
     configurations.erase(configId);
 }
 
@@ -78,6 +102,55 @@ std::unique_ptr<Request> RequestBuilder::CreateRequest(uint32_t configId)
     return std::make_unique<Request>(configuration, std::move(profiler));
 }
 
+void RequestBuilder::CreateSession(uint32_t configId, uint32_t *sessionId)
+{
+    Expect::NotNull(sessionId);
+    auto& configuration = GetConfiguration(configId);
+    auto const id = assignSessionId();
+    sessions.emplace(id, std::make_unique<Session>(configuration, id));
+    *sessionId = id;
+}
+
+void RequestBuilder::ReleaseSession(uint32_t sessionId)
+{
+    auto const & session = GetSession(sessionId);
+    if (session.HasPendingRequests())
+    {
+        throw GnaException(Gna2StatusWarningDeviceBusy);
+    }
+    sessions.erase(sessionId);
+}
+
+Session& RequestBuilder::GetSession(uint32_t sessionId)
+{
+    try
+    {
+        return *sessions.at(sessionId);
+    }
+    catch (const std::out_of_range&)
+    {
+        throw GnaException(Gna2StatusIdentifierInvalid);
+    }
+}
+
+std::unique_ptr<Request> RequestBuilder::CreateSessionRequest(uint32_t sessionId)
+{
+    auto& session = GetSession(sessionId);
+    auto& configuration = session.Configuration;
+    configuration.Validate();
+
+    auto profiler = RequestProfiler::Create(configuration.GetProfilerConfiguration());
+    Expect::NotNull(profiler);
+    profiler->Measure(Gna2InstrumentationPointLibPreprocessing);
+
+    return std::make_unique<Request>(configuration, std::move(profiler), &session);
+}
+
+bool RequestBuilder::HasSession(uint32_t sessionId) const
+{
+    return sessions.count(sessionId) > 0;
+}
+
 bool RequestBuilder::HasConfiguration(uint32_t configId) const
 {
     return configurations.count(configId) > 0;
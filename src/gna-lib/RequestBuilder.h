@@ -7,6 +7,7 @@
 
 #include "ProfilerConfiguration.h"
 #include "RequestConfiguration.h"
+#include "Session.h"
 
 #include "gna2-instrumentation-api.h"
 
@@ -40,9 +41,23 @@ public:
 
     bool HasConfiguration(uint32_t configId) const;
 
+    void CreateSession(uint32_t configId, uint32_t *sessionId);
+
+    // Releases session, sessions of configuration are released with configuration
+    void ReleaseSession(uint32_t sessionId);
+
+    Session& GetSession(uint32_t sessionId);
+
+    // Creates request for configuration of session, advancing session state
+    std::unique_ptr<Request> CreateSessionRequest(uint32_t sessionId);
+
+    bool HasSession(uint32_t sessionId) const;
+
 private:
     std::unordered_map<uint32_t, std::unique_ptr<RequestConfiguration>> configurations;
+    std::unordered_map<uint32_t, std::unique_ptr<Session>> sessions;
     static uint32_t assignConfigId();
+    static uint32_t assignSessionId();
 };
 
 }
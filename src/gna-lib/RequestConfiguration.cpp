@@ -7,6 +7,7 @@
 
 #include "ActiveList.h"
 #include "CompiledModel.h"
+#include "DeviceManager.h"
 #include "Expect.h"
 #include "HardwareCapabilities.h"
 #include "Layer.h"
@@ -30,6 +31,9 @@ RequestConfiguration::RequestConfiguration(CompiledModel& model, uint32_t config
 void RequestConfiguration::AddBuffer(uint32_t operandIndex, uint32_t layerIndex, void *address)
 {
     auto context = AddBufferContext(Model, operandIndex, layerIndex, address);
+    // outputs are written by GNA
+    Expect::False(OutputOperandIndex == operandIndex && DeviceManager::Get().IsReadOnlyMemory(address),
+        Gna2StatusMemoryBufferInvalid);
     storeAllocationIfNew(context.Address, context.Size);
 
     if (ScratchpadOperandIndex == layerIndex)
@@ -150,6 +154,16 @@ void RequestConfiguration::EnforceAcceleration(Gna2AccelerationMode acceleration
     Acceleration.SetMode(accelerationMode);
 }
 
+void RequestConfiguration::EnableHardwareConsistency()
+{
+    Acceleration.SetRelaxed(false);
+}
+
+void RequestConfiguration::DisableHardwareConsistency()
+{
+    Acceleration.SetRelaxed(true);
+}
+
 DeviceVersion RequestConfiguration::GetConsistentDevice() const
 {
     return hardwareCapabilities.GetDeviceVersion();
@@ -188,7 +202,8 @@ void RequestConfiguration::storeAllocationIfNew(void const *buffer, uint32_t buf
 {
     // add buffer memory if is not already included in model memory
     auto const memory = Model.GetMemoryIfNotPartOfModel(buffer, bufferSize);
-    if (nullptr != memory)
+    // read-only registered memory is not mapped to device, thus not submitted with hardware request
+    if (nullptr != memory && !memory->IsReadOnlyMapped())
     {
         Model.ValidateBuffer(allocations, *memory);
         allocations.Emplace(*memory);
@@ -9,6 +9,7 @@
 #include "LayerConfiguration.h"
 #include "MemoryContainer.h"
 #include "ProfilerConfiguration.h"
+#include "RequestStatistics.h"
 #include "Tensor.h"
 
 #include "gna2-common-impl.h"
@@ -18,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <cstdint>
+#include <vector>
 
 namespace GNA
 {
@@ -46,6 +48,21 @@ public:
 
     void EnforceAcceleration(Gna2AccelerationMode accelerationMode);
 
+    void EnableHardwareConsistency();
+
+    void DisableHardwareConsistency();
+
+    // Sets time in microseconds from enqueuing, by which processing of requests has to start, 0 disables
+    void SetDeadline(uint32_t deadlineIn)
+    {
+        deadline = deadlineIn;
+    }
+
+    uint32_t GetDeadline() const
+    {
+        return deadline;
+    }
+
     DeviceVersion GetConsistentDevice() const;
 
     void AssignProfilerConfig(ProfilerConfiguration* config);
@@ -83,6 +100,21 @@ public:
 
     AccelerationMode Acceleration = Gna2AccelerationModeAuto;
 
+    // Statistics of requests enqueued with this configuration
+    RequestStatistics Statistics;
+
+    // Layers of software model, which elided outputs are in scratch memory,
+    // checked by SoftwareModelOptimizer once per memory tag version
+    struct ScratchCache
+    {
+        std::vector<bool> IsScratch;
+        uint32_t TagVersion = 0;
+        bool IsValid = false;
+    };
+
+    // Requests of single configuration are not scored concurrently
+    mutable ScratchCache OptimizerScratch;
+
 private:
     struct AddBufferContext
     {
@@ -110,6 +142,8 @@ private:
 
     ProfilerConfiguration* profilerConfiguration = nullptr;
 
+    uint32_t deadline = 0;
+
     MemoryContainer allocations;
 
     const HardwareCapabilities & hardwareCapabilities;
@@ -9,6 +9,7 @@
 #include "Request.h"
 #include "RequestHandler.h"
 #include "RequestConfiguration.h"
+#include "Tracer.h"
 
 #include <chrono>
 #include <future>
@@ -39,6 +40,22 @@ void RequestHandler::ChangeNumberOfThreads(uint32_t threadCount)
     threadPool.SetNumberOfThreads(threadCount);
 }
 
+void RequestHandler::ReserveScratchPad(uint32_t size)
+{
+    threadPool.ReserveCnnScratchPad(size);
+}
+
+void RequestHandler::SetBatching(uint32_t batchSizeMax, uint32_t waitTimeMax)
+{
+    Expect::InRange(batchSizeMax, 1U, QueueLengthMax, Gna2StatusDeviceQueueError);
+    threadPool.SetBatching(batchSizeMax, waitTimeMax);
+}
+
+uint32_t RequestHandler::GetBatchSizeMax() const
+{
+    return threadPool.GetBatchSizeMax();
+}
+
 void RequestHandler::Enqueue(
     uint32_t *requestId,
     std::unique_ptr<Request> request)
@@ -58,6 +75,7 @@ void RequestHandler::Enqueue(
         addRequest(std::move(request));
     }
     r->Profiler->Measure(Gna2InstrumentationPointLibSubmission);
+    GNA_TRACE_REQUEST(TraceEventType::RequestEnqueue, r->Id);
 
     threadPool.Enqueue(r);
 }
@@ -83,6 +101,11 @@ Gna2Status RequestHandler::WaitFor(const uint32_t requestId, const uint32_t mill
     return status;
 }
 
+bool RequestHandler::Cancel(uint32_t requestId)
+{
+    return threadPool.Cancel(requestId);
+}
+
 void RequestHandler::StopRequests()
 {
     threadPool.StopAndJoin();
@@ -30,12 +30,21 @@ public:
 
     void ChangeNumberOfThreads(uint32_t threadCount);
 
+    void ReserveScratchPad(uint32_t size);
+
+    void SetBatching(uint32_t batchSizeMax, uint32_t waitTimeMax);
+
+    uint32_t GetBatchSizeMax() const;
+
     void Enqueue(
         uint32_t *requestId,
         std::unique_ptr<Request> request);
 
     Gna2Status WaitFor(const uint32_t requestId, const uint32_t milliseconds);
 
+    // Cancels request not retrieved yet, returns false if request is not pending
+    bool Cancel(uint32_t requestId);
+
     void StopRequests();
 
     bool HasRequest(uint32_t requestId) const;
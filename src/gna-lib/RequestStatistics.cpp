@@ -0,0 +1,161 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "RequestStatistics.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace GNA;
+
+LatencyHistogram::LatencyHistogram() :
+    minimum{ (std::numeric_limits<uint64_t>::max)() }
+{
+    for (auto & bucket : buckets)
+    {
+        bucket = 0;
+    }
+}
+
+void LatencyHistogram::Add(uint64_t latency)
+{
+    latency = (std::min)(latency, uint64_t{ UINT32_MAX });
+    buckets[getBucketIndex(latency)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(latency, std::memory_order_relaxed);
+    auto current = minimum.load(std::memory_order_relaxed);
+    while (latency < current && !minimum.compare_exchange_weak(current, latency, std::memory_order_relaxed))
+    {
+    }
+    current = maximum.load(std::memory_order_relaxed);
+    while (latency > current && !maximum.compare_exchange_weak(current, latency, std::memory_order_relaxed))
+    {
+    }
+}
+
+Gna2LatencyStatistics LatencyHistogram::GetSnapshot(bool reset)
+{
+    auto snapshot = Gna2LatencyStatistics{};
+    snapshot.NumberOfSamples = read(count, reset);
+    snapshot.Total = read(total, reset);
+    snapshot.Minimum = read(minimum, reset, (std::numeric_limits<uint64_t>::max)());
+    snapshot.Maximum = read(maximum, reset);
+
+    std::array<uint64_t, BucketCount> counts;
+    uint64_t bucketTotal = 0;
+    for (uint32_t i = 0; i < BucketCount; i++)
+    {
+        counts[i] = read(buckets[i], reset);
+        bucketTotal += counts[i];
+    }
+    if (0 == bucketTotal)
+    {
+        snapshot.Minimum = 0;
+        return snapshot;
+    }
+    snapshot.Minimum = (std::min)(snapshot.Minimum, snapshot.Maximum);
+
+    uint64_t * const percentiles[] = { &snapshot.Percentile50, &snapshot.Percentile90,
+        &snapshot.Percentile99, &snapshot.Percentile999 };
+    uint32_t const ranks[] = { 500, 900, 990, 999 };
+    uint64_t cumulative = 0;
+    uint32_t bucket = 0;
+    for (uint32_t p = 0; p < 4; p++)
+    {
+        // smallest latency not exceeded by given permille of samples
+        auto const rank = (std::max)(uint64_t{ 1 }, (bucketTotal * ranks[p] + 999) / 1000);
+        while (cumulative + counts[bucket] < rank)
+        {
+            cumulative += counts[bucket++];
+        }
+        *percentiles[p] = (std::min)(getBucketLimit(bucket), snapshot.Maximum);
+    }
+    return snapshot;
+}
+
+uint32_t LatencyHistogram::getBucketIndex(uint64_t latency)
+{
+    if (latency < SubBucketCount)
+    {
+        return static_cast<uint32_t>(latency);
+    }
+    auto exponent = SubBucketBits;
+    while (0 != (latency >> (exponent + 1)))
+    {
+        exponent++;
+    }
+    auto const subBucket = static_cast<uint32_t>(latency >> (exponent - SubBucketBits)) - SubBucketCount;
+    return (exponent - SubBucketBits + 1) * SubBucketCount + subBucket;
+}
+
+uint64_t LatencyHistogram::getBucketLimit(uint32_t bucketIndex)
+{
+    if (bucketIndex < SubBucketCount)
+    {
+        return bucketIndex;
+    }
+    auto const shift = bucketIndex / SubBucketCount - 1;
+    auto const subBucket = uint64_t{ bucketIndex % SubBucketCount } + SubBucketCount;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+uint64_t LatencyHistogram::read(std::atomic<uint64_t> & value, bool reset, uint64_t resetValue)
+{
+    return reset ? value.exchange(resetValue, std::memory_order_relaxed) : value.load(std::memory_order_relaxed);
+}
+
+void RequestStatistics::AddScored(Gna2Status status, uint64_t executionTime, uint64_t driverTime, bool isFallback)
+{
+    addStatus(status);
+    execution.Add(executionTime);
+    if (driverTime > 0)
+    {
+        driver.Add(driverTime);
+    }
+    if (isFallback)
+    {
+        fallbackCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void RequestStatistics::AddDropped(Gna2Status status)
+{
+    addStatus(status);
+}
+
+void RequestStatistics::AddQueueWait(uint64_t queueWaitTime)
+{
+    queueWait.Add(queueWaitTime);
+}
+
+Gna2RequestStatistics RequestStatistics::GetSnapshot(bool reset)
+{
+    auto const read = [reset](std::atomic<uint64_t> & value)
+    {
+        return reset ? value.exchange(0, std::memory_order_relaxed) : value.load(std::memory_order_relaxed);
+    };
+    auto snapshot = Gna2RequestStatistics{};
+    snapshot.NumberOfRequests = read(requestCount);
+    snapshot.NumberOfSaturatedRequests = read(saturatedRequestCount);
+    snapshot.NumberOfFallbacks = read(fallbackCount);
+    snapshot.NumberOfFailedRequests = read(failedRequestCount);
+    snapshot.QueueWait = queueWait.GetSnapshot(reset);
+    snapshot.Execution = execution.GetSnapshot(reset);
+    snapshot.Driver = driver.GetSnapshot(reset);
+    return snapshot;
+}
+
+void RequestStatistics::addStatus(Gna2Status status)
+{
+    requestCount.fetch_add(1, std::memory_order_relaxed);
+    if (Gna2StatusWarningArithmeticSaturation == status)
+    {
+        saturatedRequestCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (!Gna2StatusIsSuccessful(status))
+    {
+        failedRequestCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
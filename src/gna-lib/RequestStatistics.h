@@ -0,0 +1,92 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "gna2-common-api.h"
+#include "gna2-instrumentation-api.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace GNA
+{
+
+// Histogram of latencies in microseconds with bounded relative error
+//
+// Latencies below 16 us are counted exactly, larger ones in 16 linear buckets per power of 2,
+// thus bucket width is below 6.25% of latency. Latencies are limited to UINT32_MAX us.
+// Samples are added without locking, snapshot taken while samples are added may be inconsistent by these samples.
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    void Add(uint64_t latency);
+
+    // Gets statistics and resets histogram when reset is set, samples added meanwhile are kept for next snapshot
+    Gna2LatencyStatistics GetSnapshot(bool reset);
+
+private:
+    static constexpr uint32_t SubBucketBits = 4;
+
+    static constexpr uint32_t SubBucketCount = 1 << SubBucketBits;
+
+    static constexpr uint32_t BucketCount = (32 - SubBucketBits + 1) * SubBucketCount;
+
+    static uint32_t getBucketIndex(uint64_t latency);
+
+    // Highest latency counted in bucket
+    static uint64_t getBucketLimit(uint32_t bucketIndex);
+
+    static uint64_t read(std::atomic<uint64_t> & value, bool reset, uint64_t resetValue = 0);
+
+    std::array<std::atomic<uint64_t>, BucketCount> buckets;
+
+    std::atomic<uint64_t> count{ 0 };
+
+    std::atomic<uint64_t> total{ 0 };
+
+    std::atomic<uint64_t> minimum;
+
+    std::atomic<uint64_t> maximum{ 0 };
+};
+
+// Aggregated statistics of requests of single model or request configuration
+class RequestStatistics
+{
+public:
+    // Records request completed after being scored,
+    // driverTime is sum of device processing times in microseconds including driver overhead
+    void AddScored(Gna2Status status, uint64_t executionTime, uint64_t driverTime, bool isFallback);
+
+    // Records request completed without being scored, e.g., canceled one
+    void AddDropped(Gna2Status status);
+
+    // Records time from enqueuing request until its processing starts
+    void AddQueueWait(uint64_t queueWaitTime);
+
+    Gna2RequestStatistics GetSnapshot(bool reset);
+
+private:
+    void addStatus(Gna2Status status);
+
+    std::atomic<uint64_t> requestCount{ 0 };
+
+    std::atomic<uint64_t> saturatedRequestCount{ 0 };
+
+    std::atomic<uint64_t> fallbackCount{ 0 };
+
+    std::atomic<uint64_t> failedRequestCount{ 0 };
+
+    LatencyHistogram queueWait;
+
+    LatencyHistogram execution;
+
+    LatencyHistogram driver;
+};
+
+}
@@ -0,0 +1,135 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "Session.h"
+
+#include "CompiledModel.h"
+#include "Expect.h"
+#include "GnaException.h"
+#include "Layer.h"
+#include "LayerConfiguration.h"
+#include "RecurrentFunction.h"
+#include "Request.h"
+#include "RequestConfiguration.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace GNA;
+
+Session::Session(RequestConfiguration & configuration, uint32_t sessionId) :
+    Configuration{ configuration },
+    Id{ sessionId }
+{
+    auto const & layers = Configuration.Model.GetLayers();
+    uint32_t stateSize = 0;
+    for (uint32_t i = 0; i < layers.size(); i++)
+    {
+        if (INTEL_RECURRENT != layers[i]->Operation)
+        {
+            continue;
+        }
+        auto const & function = layers[i]->GetInputTransform<RecurrentFunction>();
+        auto const & output = *function.Output;
+        auto const vectorSize = output.Dimensions.at('W') * output.Mode.Size;
+        auto const size = function.GetFeedbackDelay() * vectorSize;
+        delayLines.push_back({ i, &function, stateSize, size, output.Dimensions.at('H') * vectorSize });
+        stateSize += size;
+    }
+    state.resize(stateSize);
+}
+
+Gna2Status Session::Score(RequestProfiler & profiler, KernelBuffers * buffers,
+    std::atomic<bool> const * cancellation)
+{
+    auto status = Gna2StatusSuccess;
+    try
+    {
+        for (auto const & delayLine : delayLines)
+        {
+            memcpy(getDelayLineBuffer(delayLine), state.data() + delayLine.StateOffset, delayLine.Size);
+        }
+
+        status = Configuration.Model.Score(Configuration, profiler, buffers, cancellation);
+
+        if (Gna2StatusIsSuccessful(status))
+        {
+            // last outputs are feedback of the next request
+            for (auto const & delayLine : delayLines)
+            {
+                auto const * const outputs = getDelayLineBuffer(delayLine) + delayLine.Size;
+                memcpy(state.data() + delayLine.StateOffset, outputs + delayLine.OutputSize - delayLine.Size,
+                    delayLine.Size);
+            }
+        }
+    }
+    catch (const GnaException& e)
+    {
+        status = e.GetStatus();
+    }
+    return status;
+}
+
+void Session::AddPendingRequest()
+{
+    pendingRequestCount++;
+}
+
+void Session::RemovePendingRequest()
+{
+    pendingRequestCount--;
+}
+
+bool Session::HasPendingRequests() const
+{
+    return pendingRequestCount > 0;
+}
+
+void Session::Reset()
+{
+    expectIdle();
+    std::fill(state.begin(), state.end(), int8_t{ 0 });
+}
+
+uint32_t Session::GetStateSize() const
+{
+    return static_cast<uint32_t>(state.size());
+}
+
+void Session::SaveState(void * stateOut, uint32_t stateSize) const
+{
+    Expect::NotNull(stateOut);
+    Expect::Equal(stateSize, GetStateSize(), Gna2StatusMemorySizeInvalid);
+    expectIdle();
+    memcpy(stateOut, state.data(), state.size());
+}
+
+void Session::RestoreState(void const * stateIn, uint32_t stateSize)
+{
+    Expect::NotNull(stateIn);
+    Expect::Equal(stateSize, GetStateSize(), Gna2StatusMemorySizeInvalid);
+    expectIdle();
+    memcpy(state.data(), stateIn, state.size());
+}
+
+int8_t * Session::getDelayLineBuffer(DelayLine const & delayLine) const
+{
+    auto const found = Configuration.LayerConfigurations.find(delayLine.LayerIndex);
+    auto const * const layerConfiguration = Configuration.LayerConfigurations.end() == found ? nullptr : found->second.get();
+    auto * const buffer = delayLine.Function->GetKernelConfig(layerConfiguration).Transform.feedbackBuffer;
+    if (nullptr == buffer)
+    {
+        throw GnaException(Gna2StatusXnnErrorNoFeedback);
+    }
+    return reinterpret_cast<int8_t *>(buffer);
+}
+
+void Session::expectIdle() const
+{
+    if (HasPendingRequests())
+    {
+        throw GnaException(Gna2StatusWarningDeviceBusy);
+    }
+}
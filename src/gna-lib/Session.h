@@ -0,0 +1,87 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "gna2-common-api.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+struct KernelBuffers;
+
+namespace GNA
+{
+
+class RecurrentFunction;
+class RequestConfiguration;
+class RequestProfiler;
+
+// Streaming session of request configuration, holding recurrent state of single stream
+//
+// State of each recurrent operation is its last FeedbackDelay output vectors,
+// i.e. delay line read as feedback by first vectors of the next request.
+// State is kept in library memory, loaded to delay line preceding operation output buffer
+// before each request of session is scored and advanced from its output afterwards,
+// so caller does not have to rebind output buffers between consecutive frames.
+class Session
+{
+public:
+    Session(RequestConfiguration & configuration, uint32_t sessionId);
+    Session(const Session &) = delete;
+    Session& operator=(const Session&) = delete;
+
+    // Scores request of session, state is advanced only when scoring succeeds
+    Gna2Status Score(RequestProfiler & profiler, KernelBuffers * buffers, std::atomic<bool> const * cancellation);
+
+    // Registers request of session, until it is retrieved or dropped state cannot be accessed
+    void AddPendingRequest();
+
+    void RemovePendingRequest();
+
+    bool HasPendingRequests() const;
+
+    // Sets state of all recurrent operations to zero, as at session creation
+    void Reset();
+
+    // Size in bytes of state of all recurrent operations
+    uint32_t GetStateSize() const;
+
+    void SaveState(void * state, uint32_t stateSize) const;
+
+    void RestoreState(void const * state, uint32_t stateSize);
+
+    RequestConfiguration & Configuration;
+
+    const uint32_t Id;
+
+private:
+    struct DelayLine
+    {
+        uint32_t LayerIndex;
+        RecurrentFunction const * Function;
+
+        // Offset of delay line state in session state
+        uint32_t StateOffset;
+        uint32_t Size;
+
+        // Size of all outputs of single request
+        uint32_t OutputSize;
+    };
+
+    // Address of delay line preceding operation output buffer used by request configuration
+    int8_t * getDelayLineBuffer(DelayLine const & delayLine) const;
+
+    void expectIdle() const;
+
+    std::vector<DelayLine> delayLines;
+
+    std::vector<int8_t> state;
+
+    std::atomic<uint32_t> pendingRequestCount{ 0 };
+};
+
+}
@@ -0,0 +1,349 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "SoftwareBatchScorer.h"
+
+#include "AccelerationDetector.h"
+#include "ActivationFunction.h"
+#include "AffineFunctions.h"
+#include "GnaException.h"
+#include "Layer.h"
+#include "LayerConfiguration.h"
+#include "Memory.h"
+#include "ModelError.h"
+#include "RequestConfiguration.h"
+#include "SoftwareModel.h"
+
+#include "gna2-model-impl.h"
+
+#include <algorithm>
+#include <map>
+
+using namespace GNA;
+
+namespace
+{
+
+template<typename T>
+void copyStrided(void const * source, uint32_t sourceStride, void * target, uint32_t targetStride,
+    uint32_t count)
+{
+    auto const * const from = static_cast<T const *>(source);
+    auto * const to = static_cast<T *>(target);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        to[i * targetStride] = from[i * sourceStride];
+    }
+}
+
+// Copies count elements between vector and column of interleaved matrix
+void copyElements(void const * source, uint32_t sourceStride, void * target, uint32_t targetStride,
+    uint32_t count, uint32_t elementSize)
+{
+    switch (elementSize)
+    {
+    case 1:
+        return copyStrided<int8_t>(source, sourceStride, target, targetStride, count);
+    case 2:
+        return copyStrided<int16_t>(source, sourceStride, target, targetStride, count);
+    case 4:
+        return copyStrided<int32_t>(source, sourceStride, target, targetStride, count);
+    default:
+        throw GnaException(Gna2StatusDataModeInvalid);
+    }
+}
+
+uint32_t alignScratch(uint32_t size)
+{
+    return Gna2RoundUp(size, Memory::GNA_BUFFER_ALIGNMENT);
+}
+
+// Position of write in order of scoring, by request and operation
+struct WriteOrder
+{
+    uint32_t Request;
+    uint32_t Operation;
+
+    bool operator==(WriteOrder const & other) const
+    {
+        return Request == other.Request && Operation == other.Operation;
+    }
+};
+
+// Output buffer written by batch, with last writes when scored one by one and in batch
+struct OutputRegion
+{
+    uint8_t const * End;
+    WriteOrder LastInSequence;
+    WriteOrder LastInBatch;
+};
+
+}
+
+std::unique_ptr<SoftwareBatchScorer> SoftwareBatchScorer::Create(std::vector<std::unique_ptr<Layer>> const & layers)
+{
+    if (layers.empty())
+    {
+        return nullptr;
+    }
+    for (auto const & layer : layers)
+    {
+        if (INTEL_AFFINE != layer->Operation || 1 != layer->Input.Dimensions.at('W')
+            || nullptr == dynamic_cast<AffineFunctionSingle const *>(&layer->GetInputTransform()))
+        {
+            return nullptr;
+        }
+    }
+    return std::make_unique<SoftwareBatchScorer>(layers);
+}
+
+SoftwareBatchScorer::SoftwareBatchScorer(std::vector<std::unique_ptr<Layer>> const & layersIn)
+{
+    for (auto const & layer : layersIn)
+    {
+        auto const & affine = layer->GetInputTransform<AffineFunction>();
+        auto const * const activation = layer->Transforms.GetOptional<ActivationFunction>(ActivationTransform);
+
+        KernelMap<AffineKernel> const * largeBatchKernels = nullptr;
+        try
+        {
+            largeBatchKernels = &AccelerationDetector::GetKernelMap<AffineKernel>(KERNEL_AFFINE_LARGE_BATCH,
+                KernelMode{ layer->Input.Mode, affine.Weights->Mode, affine.Biases->Mode });
+        }
+        catch (GnaModelErrorException const &)
+        {
+            // batch is limited to hardware grouping
+        }
+
+        auto parameters = std::vector<MemoryRange>{ MemoryRange{ *affine.Weights }, MemoryRange{ *affine.Biases } };
+        if (nullptr != activation && activation->Segments)
+        {
+            parameters.emplace_back(*activation->Segments);
+        }
+
+        layers.push_back({ layer.get(), &affine, activation, largeBatchKernels,
+            layer->Input.Dimensions.at('H'), layer->Output.Dimensions.at('H'),
+            layer->Input.Mode.Size, layer->Output.Mode.Size, std::move(parameters) });
+
+        auto const & added = layers.back();
+        vectorSize = (std::max)({ vectorSize, added.InputElementCount * added.InputElementSize,
+            added.OutputElementCount * added.OutputElementSize });
+        if (nullptr != activation)
+        {
+            sumSize = (std::max)(sumSize, added.OutputElementCount * static_cast<uint32_t>(sizeof(int32_t)));
+        }
+    }
+}
+
+uint32_t SoftwareBatchScorer::GetScratchSize(uint32_t batchSize) const
+{
+    return 2 * alignScratch(vectorSize * batchSize) + alignScratch(sumSize * batchSize);
+}
+
+bool SoftwareBatchScorer::TryScore(std::vector<ScoreContext> & contexts, AccelerationMode accel,
+    InferenceConfig const & config) const
+{
+    auto const batchSize = static_cast<uint32_t>(contexts.size());
+    auto * const buffers = contexts.front().buffers;
+    auto const scratchSize = GetScratchSize(batchSize);
+    if (buffers->cnnFusedBufferSize < scratchSize)
+    {
+        return false;
+    }
+    for (auto const & layer : layers)
+    {
+        if ((batchSize > BatchSizeMax && nullptr == layer.LargeBatchKernels)
+            || !isConsistent(layer, batchSize, accel, config.GetEffective(*layer.Source)))
+        {
+            return false;
+        }
+    }
+
+    auto operations = std::vector<std::vector<RequestOperation>>{};
+    if (!tryPlan(contexts, operations))
+    {
+        return false;
+    }
+
+    for (auto & context : contexts)
+    {
+        context.profiler.Measure(Gna2InstrumentationPointLibExecution);
+    }
+
+    // outputs of operation are inputs of the next one, sums are outputs before activation
+    auto const vectorsSize = alignScratch(vectorSize * batchSize);
+    int8_t * const vectors[] = { buffers->cnnFusedBuffer, buffers->cnnFusedBuffer + vectorsSize };
+    auto * const sums = vectors[1] + vectorsSize;
+    auto requests = std::vector<RequestOperation const *>(batchSize);
+    for (uint32_t i = 0; i < layers.size(); i++)
+    {
+        for (uint32_t r = 0; r < batchSize; r++)
+        {
+            requests[r] = &operations[r][i];
+        }
+        computeLayer(layers[i], requests, vectors[i % 2], vectors[(i + 1) % 2], sums,
+            accel, config.GetEffective(*layers[i].Source));
+    }
+    return 0 == config.SaturationCount;
+}
+
+bool SoftwareBatchScorer::tryPlan(std::vector<ScoreContext> const & contexts,
+    std::vector<std::vector<RequestOperation>> & operations) const
+{
+    auto regions = std::map<uint8_t const *, OutputRegion>{};
+    for (uint32_t r = 0; r < contexts.size(); r++)
+    {
+        auto const & configurations = contexts[r].requestConfiguration.LayerConfigurations;
+        for (auto const & configuration : configurations)
+        {
+            auto const & buffers = configuration.second->Buffers;
+            if (configuration.second->ActList || std::any_of(buffers.cbegin(), buffers.cend(),
+                [](auto const & buffer) { return InputOperandIndex != buffer.first && OutputOperandIndex != buffer.first; }))
+            {
+                return false;
+            }
+        }
+
+        operations.emplace_back();
+        for (uint32_t i = 0; i < layers.size(); i++)
+        {
+            auto const & layer = layers[i];
+            auto const found = configurations.find(i);
+            auto const * const configuration = configurations.end() == found ? nullptr : found->second.get();
+            auto const & input = layer.Affine->GetKernelConfig(configuration).Inputs;
+            auto * const output = nullptr != layer.Activation ?
+                layer.Activation->GetKernelConfig(configuration).Outputs :
+                layer.Affine->GetKernelConfig(configuration).Outputs;
+            auto const operation = RequestOperation{
+                MemoryRange{ input, layer.InputElementCount * layer.InputElementSize },
+                MemoryRange{ output, layer.OutputElementCount * layer.OutputElementSize },
+                output, false };
+            if (operation.Input.IsEmpty() || operation.Output.IsEmpty())
+            {
+                return false;
+            }
+            operations.back().push_back(operation);
+
+            auto const order = WriteOrder{ r, i };
+            auto const emplaced = regions.emplace(operation.Output.Begin, OutputRegion{ operation.Output.End, order, order });
+            auto & region = emplaced.first->second;
+            if (region.End != operation.Output.End)
+            {
+                return false;
+            }
+            // requests are visited in order of scoring one by one
+            region.LastInSequence = order;
+            if (i >= region.LastInBatch.Operation)
+            {
+                region.LastInBatch = order;
+            }
+        }
+    }
+
+    // final content of each output has to be written by the same operation of the same request
+    auto const * previousEnd = static_cast<uint8_t const *>(nullptr);
+    for (auto const & region : regions)
+    {
+        if (region.first < previousEnd || !(region.second.LastInSequence == region.second.LastInBatch))
+        {
+            return false;
+        }
+        previousEnd = region.second.End;
+    }
+
+    auto const isWritten = [&regions](MemoryRange const & range)
+    {
+        auto const next = regions.lower_bound(range.End);
+        return regions.begin() != next && std::prev(next)->second.End > range.Begin;
+    };
+
+    for (auto & requestOperations : operations)
+    {
+        for (uint32_t i = 0; i < layers.size(); i++)
+        {
+            auto & operation = requestOperations[i];
+            operation.IsChained = i > 0 && operation.Input == requestOperations[i - 1].Output;
+            if (!operation.IsChained && isWritten(operation.Input))
+            {
+                return false;
+            }
+        }
+    }
+    for (auto const & layer : layers)
+    {
+        if (std::any_of(layer.Parameters.cbegin(), layer.Parameters.cend(), isWritten))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SoftwareBatchScorer::isConsistent(BatchLayer const & layer, uint32_t batchSize, AccelerationMode accel,
+    ExecutionConfig const & execution) const
+{
+    if (accel.IsRelaxed())
+    {
+        return true;
+    }
+    // hardware consistent kernels saturate partial sums of input parts sized by grouping,
+    // so grouping changes results unless whole input fits single part
+    uint32_t const groups[] = { (std::min)(batchSize, BatchSizeMax), batchSize > BatchSizeMax ? batchSize % BatchSizeMax : 0 };
+    for (auto const group : groups)
+    {
+        if (0 == group)
+        {
+            continue;
+        }
+        auto const * const count = execution.BufferElementCount;
+        auto const partSize = (std::min)(count[group - 1], count[group - 1 + XNN_N_GROUP_MAX]) / group;
+        if (layer.InputElementCount > partSize)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SoftwareBatchScorer::computeLayer(BatchLayer const & layer, std::vector<RequestOperation const *> const & requests,
+    int8_t * inputs, int8_t * outputs, int8_t * sums,
+    AccelerationMode accel, ExecutionConfig const & execution) const
+{
+    auto const batchSize = static_cast<uint32_t>(requests.size());
+    for (uint32_t r = 0; r < batchSize; r++)
+    {
+        if (!requests[r]->IsChained)
+        {
+            copyElements(requests[r]->Input.Begin, 1, inputs + r * layer.InputElementSize, batchSize,
+                layer.InputElementCount, layer.InputElementSize);
+        }
+    }
+
+    auto * const affineOutputs = nullptr != layer.Activation ? sums : outputs;
+    auto const & affine = layer.Affine->GetKernelConfig(nullptr).Transform;
+    auto const affineConfig = KernelConfig<AffineConfig>{
+        AffineConfig{ layer.OutputElementCount, batchSize, layer.InputElementCount,
+            reinterpret_cast<int16_t const *>(inputs), reinterpret_cast<int32_t *>(affineOutputs),
+            affine.weights1B, affine.biasesCompound, nullptr, 0, affine.bytesPerBias },
+        BaseConfig{ inputs, affineOutputs } };
+    layer.Affine->ComputePart(accel, affineConfig, execution,
+        batchSize > BatchSizeMax ? layer.LargeBatchKernels : nullptr);
+
+    if (nullptr != layer.Activation)
+    {
+        auto const & activation = layer.Activation->GetKernelConfig(nullptr).Transform;
+        auto const activationConfig = KernelConfig<ActivationConfig>{
+            ActivationConfig{ layer.OutputElementCount * batchSize, activation.Kernel },
+            BaseConfig{ sums, outputs } };
+        layer.Activation->ComputePart(accel, activationConfig, execution);
+    }
+
+    // outputs are written in order of requests, as when scored one by one
+    for (uint32_t r = 0; r < batchSize; r++)
+    {
+        copyElements(outputs + r * layer.OutputElementSize, batchSize, requests[r]->OutputBuffer, 1,
+            layer.OutputElementCount, layer.OutputElementSize);
+    }
+}
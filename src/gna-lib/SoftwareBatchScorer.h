@@ -0,0 +1,99 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "IScorable.h"
+#include "KernelArguments.h"
+#include "SoftwareModelOptimizer.h"
+#include "XnnKernel.h"
+
+#include "gna2-inference-impl.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace GNA
+{
+
+class ActivationFunction;
+class Layer;
+struct AffineFunction;
+struct InferenceConfig;
+
+// Scoring of requests for the same software model coalesced into single grouped execution
+//
+// Applicable to models of fully connected affine operations of single input vector.
+// Each operation is computed once for input vectors of all requests of batch,
+// so weights are read once per batch instead of once per request.
+// Inputs are gathered from and outputs scattered to buffers of each request.
+// Batch is scored only when outputs are bit-exact with scoring requests one by one in order,
+// i.e. requests override only input and output buffers, read only their own outputs of preceding operations
+// or buffers not written by batch, and hardware consistent saturation does not depend on grouping.
+class SoftwareBatchScorer
+{
+public:
+    // Returns nullptr when model is not batchable
+    static std::unique_ptr<SoftwareBatchScorer> Create(std::vector<std::unique_ptr<Layer>> const & layers);
+
+    explicit SoftwareBatchScorer(std::vector<std::unique_ptr<Layer>> const & layers);
+
+    // Size in bytes of scratch holding gathered inputs and outputs of batch
+    uint32_t GetScratchSize(uint32_t batchSize) const;
+
+    // Scores requests of contexts in single batch,
+    // returns false when requests have to be scored one by one,
+    // i.e. batch is not applicable or saturates, as saturation is reported per request
+    bool TryScore(std::vector<ScoreContext> & contexts, AccelerationMode accel, InferenceConfig const & config) const;
+
+private:
+    struct BatchLayer
+    {
+        Layer * Source;
+        AffineFunction const * Affine;
+        ActivationFunction const * Activation;
+
+        // Kernels for batches exceeding hardware grouping, nullptr when not available for data mode
+        KernelMap<AffineKernel> const * LargeBatchKernels;
+
+        uint32_t InputElementCount;
+        uint32_t OutputElementCount;
+        uint32_t InputElementSize;
+        uint32_t OutputElementSize;
+
+        // Weights, biases and activation segments
+        std::vector<MemoryRange> Parameters;
+    };
+
+    // Input and output buffers of single request operation
+    struct RequestOperation
+    {
+        MemoryRange Input;
+        MemoryRange Output;
+        int8_t * OutputBuffer;
+
+        // Input is output of preceding operation of the same request, taken from batch scratch
+        bool IsChained;
+    };
+
+    bool tryPlan(std::vector<ScoreContext> const & contexts,
+        std::vector<std::vector<RequestOperation>> & operations) const;
+
+    bool isConsistent(BatchLayer const & layer, uint32_t batchSize, AccelerationMode accel,
+        ExecutionConfig const & execution) const;
+
+    void computeLayer(BatchLayer const & layer, std::vector<RequestOperation const *> const & requests,
+        int8_t * inputs, int8_t * outputs, int8_t * sums,
+        AccelerationMode accel, ExecutionConfig const & execution) const;
+
+    std::vector<BatchLayer> layers;
+
+    // Maximum size in bytes of single request operation input or output and of outputs before activation
+    uint32_t vectorSize = 0;
+    uint32_t sumSize = 0;
+};
+
+}
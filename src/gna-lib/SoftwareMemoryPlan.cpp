@@ -0,0 +1,66 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "SoftwareMemoryPlan.h"
+
+#include "Layer.h"
+#include "Memory.h"
+
+#include "gna2-common-api.h"
+#include "gna2-model-impl.h"
+
+#include <algorithm>
+#include <iterator>
+
+using namespace GNA;
+
+SoftwareMemoryPlan::SoftwareMemoryPlan(std::vector<std::unique_ptr<Layer>> const & layers)
+{
+    for (auto i = uint32_t{ 0 }; i < layers.size(); i++)
+    {
+        // intermediate between transforms of single layer lives only while the layer is computed
+        auto const size = layers[i]->TryGetOperandSize(SoftwareScratchpadOperandIndex);
+        if (0 != size)
+        {
+            intermediates.push_back({ i, i, Gna2RoundUp(size, Memory::GNA_BUFFER_ALIGNMENT), 0 });
+        }
+    }
+    place();
+}
+
+void SoftwareMemoryPlan::place()
+{
+    std::vector<Intermediate *> bySize;
+    for (auto & intermediate : intermediates)
+    {
+        bySize.push_back(&intermediate);
+    }
+    std::stable_sort(bySize.begin(), bySize.end(),
+        [](Intermediate const * left, Intermediate const * right) { return left->Size > right->Size; });
+
+    // first-fit of largest intermediates first among already placed ones alive at the same time
+    std::vector<Intermediate const *> placed;
+    for (auto * const current : bySize)
+    {
+        std::vector<Intermediate const *> alive;
+        std::copy_if(placed.cbegin(), placed.cend(), std::back_inserter(alive),
+            [current](Intermediate const * other) { return current->IsAliveWith(*other); });
+        std::sort(alive.begin(), alive.end(),
+            [](Intermediate const * left, Intermediate const * right) { return left->Offset < right->Offset; });
+
+        auto offset = uint32_t{ 0 };
+        for (auto const * const other : alive)
+        {
+            if (offset + current->Size <= other->Offset)
+            {
+                break;
+            }
+            offset = (std::max)(offset, other->Offset + other->Size);
+        }
+        current->Offset = offset;
+        arenaSize = (std::max)(arenaSize, offset + current->Size);
+        placed.push_back(current);
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace GNA
+{
+
+class Layer;
+
+// Placement of library owned intermediate tensors of software model in single scratch arena
+//
+// Lifetimes of intermediates are computed for whole model at load time,
+// intermediates with disjoint lifetimes share arena offsets.
+// Arena is reserved for all scoring threads when model is loaded,
+// thus no allocation takes place while scoring.
+class SoftwareMemoryPlan
+{
+public:
+    explicit SoftwareMemoryPlan(std::vector<std::unique_ptr<Layer>> const & layers);
+
+    // Size in bytes of arena holding all intermediates
+    uint32_t GetArenaSize() const
+    {
+        return arenaSize;
+    }
+
+private:
+    struct Intermediate
+    {
+        // First and last layer accessing intermediate
+        uint32_t FirstUse;
+        uint32_t LastUse;
+
+        uint32_t Size;
+        uint32_t Offset;
+
+        bool IsAliveWith(Intermediate const & other) const
+        {
+            return FirstUse <= other.LastUse && other.FirstUse <= LastUse;
+        }
+    };
+
+    void place();
+
+    std::vector<Intermediate> intermediates;
+
+    uint32_t arenaSize = 0;
+};
+
+}
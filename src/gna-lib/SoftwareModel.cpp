@@ -9,14 +9,21 @@
 #include "HardwareCapabilities.h"
 #include "KernelArguments.h"
 #include "Layer.h"
+#include "LayerConfiguration.h"
 #include "Macros.h"
 #include "ModelError.h"
+#include "Request.h"
 #include "RequestConfiguration.h"
+#include "Tracer.h"
 #include "Validator.h"
+#include "pwl.h"
 
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <map>
 #include <utility>
 
@@ -101,7 +108,7 @@ void SoftwareModel::build(const Gna2Operation* const operations, const BaseValid
         try
         {
             auto * validator = &softwareOnlyValidator;
-            if (hasHwValidator && !SubModel::IsSoftwareLayer(i, subModels))
+            if (hasHwValidator && !SubModel::IsSoftwareOnlyLayer(i, subModels))
             {
                 validator = &hwConsistentValidator;
             }
@@ -113,6 +120,12 @@ void SoftwareModel::build(const Gna2Operation* const operations, const BaseValid
             GnaModelErrorException::DispatchAndSetLayer(i);
         }
     }
+
+    optimizer = std::make_unique<SoftwareModelOptimizer>(layers);
+    batchScorer = SoftwareBatchScorer::Create(layers);
+
+    auto const memoryPlan = SoftwareMemoryPlan{ layers };
+    maximumOperandSizes.at(SoftwareScratchpadOperandIndex) = memoryPlan.GetArenaSize();
 }
 
 void SoftwareModel::Score(ScoreContext & context)
@@ -121,26 +134,79 @@ void SoftwareModel::Score(ScoreContext & context)
 
     LogAcceleration(accel);
 
-    context.buffers->ReallocateCnnScratchPad(maximumOperandSizes.at(SoftwareScratchpadOperandIndex));
-    auto config = InferenceConfig{ context.buffers, context.requestConfiguration };
+    // scratch pad is reserved for all threads when model is loaded
+    Expect::True(context.buffers->cnnFusedBufferSize >= maximumOperandSizes.at(SoftwareScratchpadOperandIndex),
+        Gna2StatusResourceAllocationError);
+    auto * const profiler = context.profiler.IsOperationProfilingEnabled() ? &context.profiler : nullptr;
+    auto config = InferenceConfig{ context.buffers, context.requestConfiguration, profiler };
     auto layerIter = layers.cbegin() + context.layerIndex;
     auto const layerEnd = layerIter + context.layerCount;
+    auto const firstLayer = context.layerIndex;
+    auto const lastLayer = context.layerIndex + context.layerCount - 1;
+    auto const isOptimized = SoftwareModelOptimizer::IsApplicable(context.requestConfiguration);
+    // acceleration selected by library may be tuned, explicitly requested one is kept,
+    // relaxed kernels are not tuned, as their results may differ between accelerations
+    auto const isTuned = nullptr != tuner && nullptr == profiler && !accel.IsRelaxed()
+        && context.requestConfiguration.Acceleration.GetMode() != accel.GetMode();
 
     context.profiler.Measure(Gna2InstrumentationPointLibExecution);
 
     for (; layerIter < layerEnd; ++layerIter)
     {
+        context.ExpectNotCanceled();
         auto const & layer = *layerIter;
+        uint64_t startTime = 0;
+        auto const saturationCount = config.SaturationCount;
+        if (nullptr != profiler)
+        {
+            profiler->SetOperation(context.layerIndex, accel.GetMode());
+            startTime = profiler->GetTime();
+        }
+
         auto const found = context.requestConfiguration.LayerConfigurations.find(context.layerIndex);
-        if (found == context.requestConfiguration.LayerConfigurations.end())
+        auto const compute = [&](AccelerationMode const & layerAccel)
         {
+            if (found == context.requestConfiguration.LayerConfigurations.end())
+            {
+                if (!isOptimized || !optimizer->TryCompute(*layer, context.layerIndex, firstLayer, lastLayer,
+                    context.requestConfiguration, layerAccel, config.GetEffective(*layer)))
+                {
+                    layer->ComputeHidden(layerAccel, config.GetEffective(*layer));
+                }
+            }
+            else
+            {
+                auto const layerConfiguration = found->second.get();
+                layer->Compute(*layerConfiguration, layerAccel, config.GetEffective(*layer));
+            }
+        };
 
-            layer->ComputeHidden(accel, config.GetEffective(*layer));
+        auto layerAccel = accel;
+        if (isTuned)
+        {
+            auto mode = tunedModes[context.layerIndex].load();
+            if (Gna2AccelerationModeAuto == mode && isTunable(context.layerIndex,
+                found == context.requestConfiguration.LayerConfigurations.end() ? nullptr : found->second.get(),
+                isOptimized))
+            {
+                mode = tuneLayer(context.layerIndex, compute);
+                // benchmark runs are not counted
+                config.SaturationCount = saturationCount;
+            }
+            if (Gna2AccelerationModeAuto != mode)
+            {
+                layerAccel = AccelerationMode{ mode, false };
+            }
         }
-        else
+        GNA_TRACE(TraceEventType::OperationBegin, context.layerIndex, layerAccel.GetMode());
+        compute(layerAccel);
+        GNA_TRACE(TraceEventType::OperationEnd, context.layerIndex, layerAccel.GetMode());
+
+        if (nullptr != profiler)
         {
-            auto const layerConfiguration = found->second.get();
-            layer->Compute(*layerConfiguration, accel, config.GetEffective(*layer));
+            profiler->AddOperationResult(Gna2InstrumentationStageOperation, startTime,
+                config.SaturationCount - saturationCount,
+                layer->GetMultiplyAccumulateCount(), layer->GetOperandsSize());
         }
 
         ++context.layerIndex;
@@ -149,6 +215,140 @@ void SoftwareModel::Score(ScoreContext & context)
     context.saturationCount += config.SaturationCount;
 }
 
+bool SoftwareModel::ScoreBatch(std::vector<ScoreContext> & contexts)
+{
+    if (!batchScorer)
+    {
+        return false;
+    }
+    auto const & first = contexts.front().requestConfiguration;
+    const auto accel = first.Acceleration.GetEffectiveSoftwareAccelerationMode(supportedCpuAccelerations);
+    for (auto const & context : contexts)
+    {
+        auto const & configuration = context.requestConfiguration;
+        const auto requestAccel = configuration.Acceleration.GetEffectiveSoftwareAccelerationMode(supportedCpuAccelerations);
+        if (requestAccel.GetMode() != accel.GetMode() || requestAccel.IsRelaxed() != accel.IsRelaxed()
+            || configuration.BufferElementCount != first.BufferElementCount
+            || configuration.BufferElementCountFor3_0 != first.BufferElementCountFor3_0)
+        {
+            return false;
+        }
+    }
+
+    LogAcceleration(accel);
+
+    auto config = InferenceConfig{ contexts.front().buffers, first };
+    return batchScorer->TryScore(contexts, accel, config);
+}
+
+uint32_t SoftwareModel::GetBatchScratchSize(uint32_t batchSize) const
+{
+    return batchScorer ? batchScorer->GetScratchSize(batchSize) : 0;
+}
+
+void SoftwareModel::EnableKernelTuning(KernelTuner & tunerIn)
+{
+    tunedModes = std::make_unique<std::atomic<Gna2AccelerationMode>[]>(layerCount);
+    layerSignatures.clear();
+    for (uint32_t i = 0; i < layerCount; i++)
+    {
+        auto const & layer = *layers.at(i);
+        layerSignatures.push_back(KernelTuner::GetSignature(layer));
+        auto const tuned = tunerIn.Get(layerSignatures.back());
+        tunedModes[i] = tuned.Mode;
+        auto const * const pwl = KernelTuner::GetPwl(layer);
+        if (Gna2AccelerationModeAuto != tuned.Mode && nullptr != pwl)
+        {
+            pwl->SelectLookup(tuned.IsPwlLookup);
+        }
+    }
+    tuner = &tunerIn;
+}
+
+bool SoftwareModel::isTunable(uint32_t layerIndex, LayerConfiguration const * layerConfiguration,
+    bool isOptimized) const
+{
+    if (isOptimized && optimizer->IsRewritten(layerIndex))
+    {
+        return false;
+    }
+    auto const & layer = *layers.at(layerIndex);
+    auto const getRange = [&](uint32_t operandIndex)
+    {
+        auto const * const operand = layer.TryGetOperand(operandIndex);
+        if (nullptr == operand)
+        {
+            return MemoryRange{};
+        }
+        if (nullptr != layerConfiguration)
+        {
+            auto const buffer = layerConfiguration->Buffers.find(operandIndex);
+            if (layerConfiguration->Buffers.end() != buffer)
+            {
+                return MemoryRange{ buffer->second.Get(), operand->Size };
+            }
+        }
+        return MemoryRange{ *operand };
+    };
+    // recurrent feedback is not checked, as it is written by the same run before being read
+    auto const output = getRange(OutputOperandIndex);
+    for (auto const operandIndex : { InputOperandIndex, WeightOperandIndex, BiasOperandIndex, PwlOperandIndex,
+        WeightScaleFactorOperandIndex })
+    {
+        if (getRange(operandIndex).Overlaps(output))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+Gna2AccelerationMode SoftwareModel::tuneLayer(uint32_t layerIndex, LayerCompute const & compute)
+{
+    auto const * const pwl = KernelTuner::GetPwl(*layers.at(layerIndex));
+    auto const isPwlTuned = nullptr != pwl && pwl->IsLookupApplicable();
+    auto fastest = TunedKernel{ supportedCpuAccelerations.back(), true };
+    auto fastestTime = (std::numeric_limits<int64_t>::max)();
+    for (auto const mode : supportedCpuAccelerations)
+    {
+        for (auto const isPwlLookup : { true, false })
+        {
+            if (!isPwlLookup && !isPwlTuned)
+            {
+                continue;
+            }
+            if (isPwlTuned)
+            {
+                pwl->SelectLookup(isPwlLookup);
+            }
+            auto const candidate = AccelerationMode{ mode, false };
+            // warm-up run
+            compute(candidate);
+            auto time = (std::numeric_limits<int64_t>::max)();
+            for (uint32_t i = 0; i < TuningRunCount; i++)
+            {
+                auto const start = std::chrono::steady_clock::now();
+                compute(candidate);
+                auto const elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+                time = (std::min)(time, static_cast<int64_t>(elapsed));
+            }
+            if (time < fastestTime)
+            {
+                fastest = TunedKernel{ mode, isPwlLookup };
+                fastestTime = time;
+            }
+        }
+    }
+    if (isPwlTuned)
+    {
+        pwl->SelectLookup(fastest.IsPwlLookup);
+    }
+    tunedModes[layerIndex] = fastest.Mode;
+    tuner->Store(layerSignatures.at(layerIndex), fastest);
+    return fastest.Mode;
+}
+
 uint32_t SoftwareModel::GetMaximumOperandSize(uint32_t operandIndex)
 {
     auto const & found = maximumOperandSizes.find(operandIndex);
@@ -176,16 +376,18 @@ Layer const& SoftwareModel::GetLayer(uint32_t layerIndex) const
 }
 
 InferenceConfig::InferenceConfig(KernelBuffers* fvBuffers,
-    RequestConfiguration const& requestConfiguration) :
+    RequestConfiguration const& requestConfiguration, RequestProfiler * profiler) :
     SaturationCount{ 0 }
 {
     executionConfig = std::make_unique<ExecutionConfig>(fvBuffers,
         &SaturationCount, requestConfiguration.BufferElementCount);
+    executionConfig->Profiler = profiler;
     has3_0Consistency = HardwareCapabilities::Is3_0Device(requestConfiguration.GetConsistentDevice());
     if (has3_0Consistency)
     {
         executionConfig3_0 = std::make_unique<ExecutionConfig>(fvBuffers,
             &SaturationCount, requestConfiguration.BufferElementCountFor3_0);
+        executionConfig3_0->Profiler = profiler;
         getEffective = &InferenceConfig::getFor3_0Fix;
     }
     else
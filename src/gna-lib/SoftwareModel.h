@@ -7,13 +7,20 @@
 
 #include "HardwareRequest.h"
 #include "IScorable.h"
+#include "KernelTuner.h"
 #include "Layer.h"
 #include "Logger.h"
 #include "ModelError.h"
+#include "SoftwareBatchScorer.h"
+#include "SoftwareMemoryPlan.h"
+#include "SoftwareModelOptimizer.h"
 
 
+#include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace GNA
@@ -59,6 +66,21 @@ public:
 
     void Score(ScoreContext & context) override;
 
+    // Whether requests may be scored coalesced in batches, see SoftwareBatchScorer
+    bool IsBatchable() const
+    {
+        return static_cast<bool>(batchScorer);
+    }
+
+    // Scores requests in single batch, returns false when requests have to be scored one by one
+    bool ScoreBatch(std::vector<ScoreContext> & contexts);
+
+    uint32_t GetBatchScratchSize(uint32_t batchSize) const;
+
+    // Operations scored with library selected acceleration use acceleration mode
+    // tuned for each operation on first scoring or read from tuner cache
+    void EnableKernelTuning(KernelTuner & tunerIn);
+
     uint32_t GetMaximumOperandSize(uint32_t operandIndex);
 
     Layer const& GetLayer(uint32_t layerIndex) const;
@@ -89,14 +111,37 @@ private:
     static void FindMaximumOperandSizeForSingleLayer(Layer const & layer, uint32_t operandIndex,
         uint32_t & maxSize);
 
+    using LayerCompute = std::function<void(AccelerationMode const & accel)>;
+
+    // Whether operation may be computed repeatedly for benchmark with the same results,
+    // i.e. layer is not rewritten by optimizer and does not read memory it writes
+    bool isTunable(uint32_t layerIndex, LayerConfiguration const * layerConfiguration, bool isOptimized) const;
+
+    // Benchmarks operation with each supported acceleration and PWL algorithm, returns the fastest acceleration
+    Gna2AccelerationMode tuneLayer(uint32_t layerIndex, LayerCompute const & compute);
+
+    // number of timed runs of each acceleration mode, the shortest is taken
+    static constexpr uint32_t TuningRunCount = 3;
+
     std::vector<std::unique_ptr<Layer>> layers;
 
+    std::unique_ptr<SoftwareModelOptimizer> optimizer;
+
+    std::unique_ptr<SoftwareBatchScorer> batchScorer;
+
     uint32_t const layerCount;
 
     const std::vector<Gna2AccelerationMode>& supportedCpuAccelerations;
 
     std::map<uint32_t /* operandIndex */, uint32_t> maximumOperandSizes;
 
+    KernelTuner * tuner = nullptr;
+
+    // tuned acceleration mode of each layer, Gna2AccelerationModeAuto when not tuned yet
+    std::unique_ptr<std::atomic<Gna2AccelerationMode>[]> tunedModes;
+
+    std::vector<std::string> layerSignatures;
+
     BufferConfigValidator bufferConfigValidator;
 };
 
@@ -104,7 +149,8 @@ struct InferenceConfig
 {
     typedef ExecutionConfig& (InferenceConfig::*GetEffectiveMethod)(Layer const & layer) const;
 
-    InferenceConfig(KernelBuffers *fvBuffers, RequestConfiguration const &requestConfiguration);
+    InferenceConfig(KernelBuffers *fvBuffers, RequestConfiguration const &requestConfiguration,
+        RequestProfiler * profiler = nullptr);
 
     ExecutionConfig& GetEffective(Layer& layer) const
     {
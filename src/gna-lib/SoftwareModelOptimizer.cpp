@@ -0,0 +1,385 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "SoftwareModelOptimizer.h"
+
+#include "AccelerationDetector.h"
+#include "CompiledModel.h"
+#include "CopyLayer.h"
+#include "GnaException.h"
+#include "Layer.h"
+#include "LayerConfiguration.h"
+#include "Memory.h"
+#include "MemoryContainer.h"
+#include "RecurrentFunction.h"
+#include "RequestConfiguration.h"
+#include "Tensor.h"
+
+#include "gna2-model-impl.h"
+
+#include <algorithm>
+
+using namespace GNA;
+
+MemoryRange::MemoryRange(void const * buffer, uint32_t size)
+{
+    if (nullptr != buffer && 0 != size)
+    {
+        Begin = static_cast<uint8_t const *>(buffer);
+        End = Begin + size;
+    }
+}
+
+MemoryRange::MemoryRange(Tensor const & operand) :
+    MemoryRange{ operand.Buffer.Get(), operand.Size }
+{
+}
+
+bool MemoryRange::Overlaps(MemoryRange const & other) const
+{
+    return !IsEmpty() && !other.IsEmpty() && Begin < other.End && other.Begin < End;
+}
+
+bool MemoryRange::Contains(MemoryRange const & other) const
+{
+    return !IsEmpty() && !other.IsEmpty() && Begin <= other.Begin && other.End <= End;
+}
+
+static bool overlapsAny(std::vector<MemoryRange> const & ranges, MemoryRange const & range)
+{
+    return std::any_of(ranges.cbegin(), ranges.cend(),
+        [&range](MemoryRange const & item) { return item.Overlaps(range); });
+}
+
+bool LayerLiveness::Reads(MemoryRange const & range) const
+{
+    return Input.Overlaps(range) || overlapsAny(Parameters, range);
+}
+
+bool LayerLiveness::Writes(MemoryRange const & range) const
+{
+    return overlapsAny(Outputs, range);
+}
+
+SoftwareModelOptimizer::SoftwareModelOptimizer(std::vector<std::unique_ptr<Layer>> const & layers) :
+    rewrites(layers.size())
+{
+    computeLiveness(layers);
+
+    for (auto i = uint32_t{ 0 }; i < layers.size(); i++)
+    {
+        if (NotOptimized != rewrites[i].Type)
+        {
+            continue;
+        }
+        switch (layers[i]->OperationNew)
+        {
+        case Gna2OperationTypeCopy:
+            tryElideCopy(layers, i);
+            break;
+        case Gna2OperationTypeTransposition:
+            tryFuseTransposes(layers, i);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+SoftwareModelOptimizer::~SoftwareModelOptimizer() = default;
+
+void SoftwareModelOptimizer::computeLiveness(std::vector<std::unique_ptr<Layer>> const & layers)
+{
+    liveness.resize(layers.size());
+    for (auto i = uint32_t{ 0 }; i < layers.size(); i++)
+    {
+        auto const & layer = *layers[i];
+        auto & current = liveness[i];
+        current.Input = MemoryRange{ layer.Input };
+        current.Outputs.emplace_back(layer.Output);
+        current.Outputs.emplace_back(layer.Output.ScratchPad);
+        current.LastRead = i;
+        for (auto const operandIndex : { WeightOperandIndex, BiasOperandIndex, PwlOperandIndex,
+            WeightScaleFactorOperandIndex })
+        {
+            auto const operand = layer.TryGetOperand(operandIndex);
+            if (nullptr != operand)
+            {
+                current.Parameters.emplace_back(*operand);
+            }
+        }
+        // recurrent layer reads feedback preceding its output as well
+        if (Gna2OperationTypeRecurrent == layer.OperationNew)
+        {
+            auto const & recurrent = layer.Transforms.Get<RecurrentFunction>(RecurrentTransform);
+            auto const feedback = recurrent.CalculateFeedbackBuffer(layer.Output.Buffer);
+            auto const output = MemoryRange{ layer.Output };
+            current.Parameters.emplace_back(feedback.Get(), static_cast<uint32_t>(output.End - feedback.Get()));
+        }
+    }
+
+    for (auto i = uint32_t{ 0 }; i < liveness.size(); i++)
+    {
+        auto & current = liveness[i];
+        auto const & output = current.Outputs.front();
+        for (auto j = uint32_t{ 0 }; j < liveness.size(); j++)
+        {
+            if (i == j || !liveness[j].Reads(output))
+            {
+                continue;
+            }
+            if (j < i)
+            {
+                current.IsReadBeforeWritten = true;
+                continue;
+            }
+            current.Readers.push_back(j);
+            current.LastRead = j;
+        }
+    }
+}
+
+void SoftwareModelOptimizer::tryElideCopy(std::vector<std::unique_ptr<Layer>> const & layers,
+    uint32_t copyIndex)
+{
+    auto const & copy = *layers[copyIndex]->Get<const CopyLayer>();
+    auto const elementSize = copy.Input.Mode.Size;
+
+    // only whole rows in matching layouts form contiguous region that can be aliased
+    if (elementSize != copy.Output.Mode.Size
+        || copy.ColumnCount != copy.Input.Dimensions.at('W')
+        || copy.ColumnCount != copy.Output.Dimensions.at('W'))
+    {
+        return;
+    }
+
+    auto const size = copy.RowCount * copy.ColumnCount * elementSize;
+    auto const input = MemoryRange{ copy.Input.Buffer.Get(), size };
+    auto const output = MemoryRange{ copy.Output.Buffer.Get(), size };
+    if (input.IsEmpty() || output.IsEmpty() || input.Overlaps(output))
+    {
+        return;
+    }
+
+    std::vector<uint32_t> consumers;
+    for (auto i = uint32_t{ 0 }; i < liveness.size(); i++)
+    {
+        auto const & current = liveness[i];
+        if (i == copyIndex || !current.Accesses(output))
+        {
+            continue;
+        }
+        if (i < copyIndex
+            || NotOptimized != rewrites[i].Type
+            || !output.Contains(current.Input)
+            || current.Writes(output)
+            || overlapsAny(current.Parameters, output))
+        {
+            return;
+        }
+        consumers.push_back(i);
+    }
+
+    // copy output not consumed within model is model output and has to be written
+    if (consumers.empty() || isWrittenBetween(input, copyIndex + 1, consumers.back()))
+    {
+        return;
+    }
+
+    std::vector<std::unique_ptr<LayerConfiguration>> configurations;
+    for (auto const consumerIndex : consumers)
+    {
+        auto const & consumer = *layers[consumerIndex];
+        auto const alias = copy.Input.Buffer
+            + static_cast<uint32_t>(liveness[consumerIndex].Input.Begin - output.Begin);
+        try
+        {
+            consumer.Input.ValidateBuffer(alias);
+            auto configuration = std::make_unique<LayerConfiguration>();
+            configuration->EmplaceBuffer(InputOperandIndex, alias.Get());
+            consumer.UpdateKernelConfigs(*configuration);
+            configurations.push_back(std::move(configuration));
+        }
+        catch (const GnaException&)
+        {
+            return;
+        }
+    }
+
+    auto group = std::vector<uint32_t>{ copyIndex };
+    group.insert(group.end(), consumers.cbegin(), consumers.cend());
+
+    rewrites[copyIndex].Type = Elided;
+    rewrites[copyIndex].Group = group;
+    rewrites[copyIndex].Skipped = output;
+    for (auto i = size_t{ 0 }; i < consumers.size(); i++)
+    {
+        auto & rewrite = rewrites[consumers[i]];
+        rewrite.Type = Redirected;
+        rewrite.Group = group;
+        rewrite.Configuration = std::move(configurations[i]);
+    }
+}
+
+void SoftwareModelOptimizer::tryFuseTransposes(std::vector<std::unique_ptr<Layer>> const & layers,
+    uint32_t firstIndex)
+{
+    auto const & first = liveness[firstIndex];
+    auto const & intermediate = first.Outputs.front();
+    if (first.Input.IsEmpty() || intermediate.IsEmpty() || first.Readers.size() != 1)
+    {
+        return;
+    }
+
+    auto const secondIndex = first.Readers.front();
+    auto const & second = liveness[secondIndex];
+    if (first.IsReadBeforeWritten
+        || NotOptimized != rewrites[secondIndex].Type
+        || Gna2OperationTypeTransposition != layers[secondIndex]->OperationNew
+        || !(second.Input == intermediate)
+        || second.Writes(intermediate)
+        || overlapsAny(second.Parameters, intermediate))
+    {
+        return;
+    }
+
+    // intermediate has to be accessed solely by the pair
+    for (auto i = uint32_t{ 0 }; i < liveness.size(); i++)
+    {
+        if (i != firstIndex && i != secondIndex && liveness[i].Accesses(intermediate))
+        {
+            return;
+        }
+    }
+
+    auto const & source = layers[firstIndex]->Input;
+    auto const & destination = layers[secondIndex]->Output;
+    auto const output = MemoryRange{ destination };
+    if (source.Mode.Type != destination.Mode.Type
+        || source.Dimensions.at('H') != destination.Dimensions.at('H')
+        || source.Dimensions.at('W') != destination.Dimensions.at('W')
+        || source.Size != destination.Size
+        || output.Overlaps(first.Input)
+        || isWrittenBetween(first.Input, firstIndex + 1, secondIndex - 1))
+    {
+        return;
+    }
+
+    auto & rewrite = rewrites[secondIndex];
+    try
+    {
+        rewrite.CopyKernels = &AccelerationDetector::GetKernelMap<CopyKernel>(
+            KERNEL_COPY, KernelMode{ destination.Mode });
+    }
+    catch (const GnaException&)
+    {
+        return;
+    }
+
+    auto const elementCount = source.Dimensions.at('H') * source.Dimensions.at('W');
+    rewrite.Copy = std::make_unique<CopyConfig>(1, elementCount, elementCount, elementCount,
+        source.Buffer, destination.Buffer);
+    rewrite.Type = FusedCopy;
+    rewrite.Group = { firstIndex, secondIndex };
+    rewrites[firstIndex].Type = Elided;
+    rewrites[firstIndex].Group = rewrite.Group;
+    rewrites[firstIndex].Skipped = intermediate;
+}
+
+bool SoftwareModelOptimizer::isWrittenBetween(MemoryRange const & range, uint32_t first, uint32_t last) const
+{
+    for (auto i = first; i <= last && i < liveness.size(); i++)
+    {
+        if (liveness[i].Writes(range))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SoftwareModelOptimizer::IsApplicable(RequestConfiguration const & requestConfiguration)
+{
+    return std::none_of(requestConfiguration.LayerConfigurations.cbegin(),
+        requestConfiguration.LayerConfigurations.cend(),
+        [](auto const & layerConfiguration) { return !layerConfiguration.second->Buffers.empty(); });
+}
+
+// Tag may be changed after model is created, so it is checked again after any tag change
+static bool isScratch(MemoryRange const & range, MemoryContainer const & allocations)
+{
+    auto const found = allocations.FindByAddress(BaseAddress{ range.Begin });
+    if (allocations.cend() == found)
+    {
+        return false;
+    }
+    auto const & memory = found->get();
+    return Gna2MemoryTagScratch == memory.GetMemoryTag()
+        && MemoryRange{ memory.GetBuffer(), memory.GetSize() }.Contains(range);
+}
+
+std::vector<bool> const & SoftwareModelOptimizer::getScratch(RequestConfiguration const & requestConfiguration) const
+{
+    auto & cache = requestConfiguration.OptimizerScratch;
+    auto const tagVersion = Memory::GetTagVersion();
+    if (cache.IsValid && tagVersion == cache.TagVersion)
+    {
+        return cache.IsScratch;
+    }
+    cache.IsScratch.assign(rewrites.size(), false);
+    for (uint32_t i = 0; i < rewrites.size(); i++)
+    {
+        if (Elided == rewrites[i].Type)
+        {
+            cache.IsScratch[i] = isScratch(rewrites[i].Skipped, requestConfiguration.Model.GetAllocations());
+        }
+    }
+    cache.TagVersion = tagVersion;
+    cache.IsValid = true;
+    return cache.IsScratch;
+}
+
+bool SoftwareModelOptimizer::isGroupActive(LayerRewrite const & rewrite,
+    uint32_t firstScoredLayer, uint32_t lastScoredLayer,
+    RequestConfiguration const & requestConfiguration) const
+{
+    if (rewrite.Group.front() < firstScoredLayer || rewrite.Group.back() > lastScoredLayer)
+    {
+        return false;
+    }
+    if (!getScratch(requestConfiguration).at(rewrite.Group.front()))
+    {
+        return false;
+    }
+    auto const & configurations = requestConfiguration.LayerConfigurations;
+    return std::none_of(rewrite.Group.cbegin(), rewrite.Group.cend(),
+        [&configurations](uint32_t layerIndex) { return configurations.count(layerIndex) > 0; });
+}
+
+bool SoftwareModelOptimizer::TryCompute(Layer const & layer, uint32_t layerIndex,
+    uint32_t firstScoredLayer, uint32_t lastScoredLayer, RequestConfiguration const & requestConfiguration,
+    AccelerationMode accel, ExecutionConfig const & executionConfig) const
+{
+    auto const & rewrite = rewrites.at(layerIndex);
+    if (NotOptimized == rewrite.Type
+        || !isGroupActive(rewrite, firstScoredLayer, lastScoredLayer, requestConfiguration))
+    {
+        return false;
+    }
+
+    switch (rewrite.Type)
+    {
+    case Elided:
+        return true;
+    case Redirected:
+        layer.Compute(*rewrite.Configuration, accel, executionConfig);
+        return true;
+    case FusedCopy:
+        rewrite.CopyKernels->Get(accel)(rewrite.Copy.get());
+        return true;
+    default:
+        return false;
+    }
+}
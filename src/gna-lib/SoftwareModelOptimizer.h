@@ -0,0 +1,159 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "KernelArguments.h"
+#include "XnnKernel.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace GNA
+{
+
+class Layer;
+class MemoryContainer;
+class RequestConfiguration;
+struct LayerConfiguration;
+struct Tensor;
+
+// Contiguous range of memory accessed by layer operand
+struct MemoryRange
+{
+    MemoryRange() = default;
+
+    MemoryRange(void const * buffer, uint32_t size);
+
+    explicit MemoryRange(Tensor const & operand);
+
+    bool IsEmpty() const
+    {
+        return Begin == End;
+    }
+
+    bool Overlaps(MemoryRange const & other) const;
+
+    bool Contains(MemoryRange const & other) const;
+
+    bool operator==(MemoryRange const & other) const
+    {
+        return Begin == other.Begin && End == other.End;
+    }
+
+    uint8_t const * Begin = nullptr;
+    uint8_t const * End = nullptr;
+};
+
+// Memory accessed by single layer and lifetime of its output within model
+struct LayerLiveness
+{
+    MemoryRange Input;
+
+    // Output and scratch pad, output is read as well by recurrent layers
+    std::vector<MemoryRange> Outputs;
+
+    // Other operands read, e.g. weights, biases, activation segments and recurrent feedback
+    std::vector<MemoryRange> Parameters;
+
+    // Later layers reading output of this layer, before it is overwritten
+    std::vector<uint32_t> Readers;
+
+    // Index of the last layer reading output of this layer
+    uint32_t LastRead = 0;
+
+    // Output is read by this or any preceding layer, i.e. it holds state between requests
+    bool IsReadBeforeWritten = false;
+
+    bool Reads(MemoryRange const & range) const;
+
+    bool Writes(MemoryRange const & range) const;
+
+    bool Accesses(MemoryRange const & range) const
+    {
+        return Reads(range) || Writes(range);
+    }
+};
+
+// Model-compile optimizations of software model layer graph
+//
+// Copy operations whose whole output is consumed only by subsequent operations
+// are elided and their consumers read copy input directly,
+// pairs of transpositions restoring original layout are fused into single copy.
+// Optimizations are applied only when request does not override any operand buffers,
+// all affected layers are computed in single scoring pass
+// and output left unwritten is in memory tagged with Gna2MemoryTagScratch,
+// so all outputs visible to user stay bit-exact.
+class SoftwareModelOptimizer
+{
+public:
+    explicit SoftwareModelOptimizer(std::vector<std::unique_ptr<Layer>> const & layers);
+
+    SoftwareModelOptimizer(const SoftwareModelOptimizer &) = delete;
+    SoftwareModelOptimizer& operator=(const SoftwareModelOptimizer&) = delete;
+    ~SoftwareModelOptimizer();
+
+    static bool IsApplicable(RequestConfiguration const & requestConfiguration);
+
+    // Computes layer according to optimization plan
+    // returns false when layer is not optimized and has to be computed as usual
+    bool TryCompute(Layer const & layer, uint32_t layerIndex, uint32_t firstScoredLayer, uint32_t lastScoredLayer,
+        RequestConfiguration const & requestConfiguration,
+        AccelerationMode accel, ExecutionConfig const & executionConfig) const;
+
+    // Whether layer may be computed differently than its own operation, i.e. elided, redirected or fused
+    bool IsRewritten(uint32_t layerIndex) const
+    {
+        return NotOptimized != rewrites.at(layerIndex).Type;
+    }
+
+private:
+    enum RewriteType
+    {
+        NotOptimized,
+        Elided,
+        Redirected,
+        FusedCopy,
+    };
+
+    struct LayerRewrite
+    {
+        RewriteType Type = NotOptimized;
+
+        // Layers changed together, first one is elided
+        std::vector<uint32_t> Group;
+
+        // Output of elided layer, which is not written
+        MemoryRange Skipped;
+
+        // Redirected input for Redirected layer
+        std::unique_ptr<LayerConfiguration> Configuration;
+
+        // Copy replacing FusedCopy layer
+        std::unique_ptr<CopyConfig> Copy;
+        KernelMap<CopyKernel> const * CopyKernels = nullptr;
+    };
+
+    void computeLiveness(std::vector<std::unique_ptr<Layer>> const & layers);
+
+    void tryElideCopy(std::vector<std::unique_ptr<Layer>> const & layers, uint32_t copyIndex);
+
+    void tryFuseTransposes(std::vector<std::unique_ptr<Layer>> const & layers, uint32_t firstIndex);
+
+    bool isWrittenBetween(MemoryRange const & range, uint32_t first, uint32_t last) const;
+
+    // Whether elided output of each layer is in scratch memory, cached in request configuration
+    std::vector<bool> const & getScratch(RequestConfiguration const & requestConfiguration) const;
+
+    bool isGroupActive(LayerRewrite const & rewrite, uint32_t firstScoredLayer, uint32_t lastScoredLayer,
+        RequestConfiguration const & requestConfiguration) const;
+
+    std::vector<LayerLiveness> liveness;
+
+    std::vector<LayerRewrite> rewrites;
+};
+
+}
@@ -10,8 +10,8 @@
 using namespace GNA;
 
 SoftwareOnlyModel::SoftwareOnlyModel(const ApiModel& model, const AccelerationDetector& detectorIn,
-    const HardwareCapabilities& hwCapabilitiesIn) :
-    CompiledModel{ model, detectorIn, hwCapabilitiesIn, hwCapabilitiesIn.GetDeviceVersion() }
+    const HardwareCapabilities& hwCapabilitiesIn, const PartitionCostModel& costModelIn) :
+    CompiledModel{ model, detectorIn, hwCapabilitiesIn, costModelIn, hwCapabilitiesIn.GetDeviceVersion() }
 {
     BuildHardwareModelForExport();
 }
@@ -28,7 +28,18 @@ void SoftwareOnlyModel::BuildHardwareModelForExport()
 
 void SoftwareOnlyModel::score(ScoreContext& context)
 {
-    softwareModel.Score(context);
+    softwareModel->Score(context);
+}
+
+bool SoftwareOnlyModel::isBatchable(RequestConfiguration const & config) const
+{
+    UNREFERENCED_PARAMETER(config);
+    return softwareModel->IsBatchable();
+}
+
+bool SoftwareOnlyModel::scoreBatch(std::vector<ScoreContext> & contexts)
+{
+    return softwareModel->ScoreBatch(contexts);
 }
 
 void SoftwareOnlyModel::invalidateRequestConfig(uint32_t configId) const
@@ -46,3 +57,8 @@ bool SoftwareOnlyModel::isFullyHardwareCompatible()
 {
     return false;
 }
+
+std::vector<Gna2ModelPartition> SoftwareOnlyModel::getPartitions()
+{
+    return getSoftwarePartitions();
+}
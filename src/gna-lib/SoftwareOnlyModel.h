@@ -29,7 +29,8 @@ public:
     SoftwareOnlyModel(
         const ApiModel & model,
         const AccelerationDetector& detectorIn,
-        const HardwareCapabilities& hwCapabilitiesIn);
+        const HardwareCapabilities& hwCapabilitiesIn,
+        const PartitionCostModel& costModelIn);
 
     virtual ~SoftwareOnlyModel() = default;
 
@@ -44,11 +45,17 @@ protected:
 private:
     void score(ScoreContext & context) override;
 
+    bool isBatchable(RequestConfiguration const & config) const override;
+
+    bool scoreBatch(std::vector<ScoreContext> & contexts) override;
+
     void invalidateRequestConfig(uint32_t configId) const override;
 
     void validateBuffer(MemoryContainer const & requestAllocations, Memory const & memory) const override;
 
     bool isFullyHardwareCompatible() override;
+
+    std::vector<Gna2ModelPartition> getPartitions() override;
 };
 
 }
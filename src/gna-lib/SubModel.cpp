@@ -22,6 +22,16 @@ void SubModel::AddLayer()
 
 bool SubModel::IsSoftwareLayer(uint32_t layerIndex,
     const std::vector<std::unique_ptr<SubModel>>& subModels)
+{
+    return std::any_of(subModels.begin(), subModels.end(),
+        [layerIndex](auto && subModel)
+    {
+        return subModel->Contains(layerIndex) && subModel->IsSoftware();
+    });
+}
+
+bool SubModel::IsSoftwareOnlyLayer(uint32_t layerIndex,
+    const std::vector<std::unique_ptr<SubModel>>& subModels)
 {
     return std::any_of(subModels.begin(), subModels.end(),
         [layerIndex](auto && subModel)
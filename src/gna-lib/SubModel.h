@@ -16,7 +16,9 @@ enum SubModelType
 {
     Software,
     Hardware,
-    GMMHardware
+    GMMHardware,
+    // hardware compatible operations scored in software with present device consistency
+    HardwareInSoftware
 };
 
 class SubModel
@@ -36,9 +38,20 @@ public:
         return layerIndex >= LayerIndex && layerIndex < LayerIndex + GetLayerCount();
     }
 
+    // True for sub-models scored in software, also HardwareInSoftware ones
+    bool IsSoftware() const
+    {
+        return Software == Type || HardwareInSoftware == Type;
+    }
+
+    // True when layer is scored in software, thus has no hardware descriptor
     static bool IsSoftwareLayer(uint32_t layerIndex,
         const std::vector<std::unique_ptr<SubModel>>& subModels);
 
+    // True when layer is not supported by device, thus built with software emulation limitations
+    static bool IsSoftwareOnlyLayer(uint32_t layerIndex,
+        const std::vector<std::unique_ptr<SubModel>>& subModels);
+
     const SubModelType Type;
     const uint32_t LayerIndex;
 
@@ -116,7 +116,16 @@ void Tensor::validate() const
 
 uint32_t Tensor::getEffectiveSize(const DataMode& mode, uint32_t count)
 {
-    return (Gna2TensorModeConstantScalar == mode.Mode) ? mode.Size : count * mode.Size;
+    if (Gna2TensorModeConstantScalar == mode.Mode)
+    {
+        return mode.Size;
+    }
+    // 4-bit elements are packed in pairs
+    if (Gna2DataTypeInt4 == mode.Type || Gna2DataTypeUint4 == mode.Type)
+    {
+        return (count + 1) / 2;
+    }
+    return count * mode.Size;
 }
 
 std::pair<uint32_t, uint32_t> Tensor::getGroupingAndElements(
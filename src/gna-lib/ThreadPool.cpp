@@ -12,9 +12,13 @@
 #include "Memory.h"
 #include "Request.h"
 #include "KernelArguments.h"
+#include "Tracer.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <cstdint>
+#include <iterator>
 
 using namespace GNA;
 using CnnCaps = GNA::ConvolutionalLayer2DCapabilities;
@@ -56,9 +60,6 @@ KernelBuffers::KernelBuffers()
         throw GnaException(Gna2StatusResourceAllocationError);
     }
     clearMemoryInDebug(pool, poolSize);
-
-    auto const cnnScratchSize = 1 * 1024 * 1024;
-    ReallocateCnnScratchPad(cnnScratchSize);
 }
 
 KernelBuffers::~KernelBuffers()
@@ -137,6 +138,10 @@ void ThreadPool::SetNumberOfThreads(uint32_t threadCount)
     try
     {
         buffers.resize(threadCount);
+        for (auto & buffer : buffers)
+        {
+            buffer.ReallocateCnnScratchPad(cnnScratchSize);
+        }
     }
     catch (std::exception& e)
     {
@@ -150,11 +155,71 @@ void ThreadPool::SetNumberOfThreads(uint32_t threadCount)
 
 
 
+void ThreadPool::ReserveCnnScratchPad(uint32_t size)
+{
+    // buffers are not in use while no request is scored
+    std::unique_lock<std::mutex> lock(tpMutex);
+    condition.wait(lock, [&]() { return !isScoring; });
+    for (auto & buffer : buffers)
+    {
+        buffer.ReallocateCnnScratchPad(size);
+    }
+    cnnScratchSize = (std::max)(cnnScratchSize, size);
+}
+
+void ThreadPool::SetBatching(uint32_t batchSizeMaxIn, uint32_t waitTimeMax)
+{
+    std::lock_guard<std::mutex> lock(tpMutex);
+    batchSizeMax = batchSizeMaxIn;
+    batchWaitTime = waitTimeMax;
+}
+
+uint32_t ThreadPool::GetBatchSizeMax() const
+{
+    return batchSizeMax;
+}
+
 void ThreadPool::Enqueue(Request *request)
 {
     std::lock_guard<std::mutex> lock(tpMutex);
-    tasks.emplace_back(request);
-    condition.notify_one();
+    auto position = std::upper_bound(tasks.begin(), tasks.end(), request,
+        [](Request const * left, Request const * right) { return left->Deadline < right->Deadline; });
+    // requests of session are scored in order of enqueuing, even when deadline was shortened meanwhile
+    for (auto queued = position; queued != tasks.end(); ++queued)
+    {
+        if (request->IsOfSameSession(**queued))
+        {
+            position = std::next(queued);
+        }
+    }
+    tasks.insert(position, request);
+    // worker collecting batch has to be woken as well
+    condition.notify_all();
+}
+
+bool ThreadPool::Cancel(uint32_t requestId)
+{
+    std::lock_guard<std::mutex> lock(tpMutex);
+    auto const queued = std::find_if(tasks.begin(), tasks.end(),
+        [requestId](Request const * request) { return requestId == request->Id; });
+    if (tasks.end() != queued)
+    {
+        auto * const request = *queued;
+        tasks.erase(queued);
+        GNA_TRACE_REQUEST(TraceEventType::RequestDequeue, request->Id);
+        *request->Cancellation = true;
+        request->TryDrop();
+        return true;
+    }
+    for (auto const & request : scoring)
+    {
+        if (requestId == request.Id)
+        {
+            *request.Cancellation = true;
+            return true;
+        }
+    }
+    return false;
 }
 
 void ThreadPool::StopAndJoin()
@@ -173,27 +238,227 @@ void ThreadPool::StopAndJoin()
     workers.clear();
 }
 
+void ThreadPool::Parallelize(KernelBuffers * callerBuffers, uint32_t partCount, ParallelJob const & job)
+{
+    if (nullptr == callerBuffers->threadPool || callerBuffers->threadPool->numberOfThreads < 2 || partCount < 2)
+    {
+        for (uint32_t part = 0; part < partCount; part++)
+        {
+            job(part, callerBuffers);
+        }
+        return;
+    }
+    callerBuffers->threadPool->parallelize(callerBuffers, partCount, job);
+}
+
+void ThreadPool::parallelize(KernelBuffers * callerBuffers, uint32_t partCount, ParallelJob const & job)
+{
+    auto task = ParallelTask{ job, partCount, 0, 0, nullptr };
+    std::unique_lock<std::mutex> lock(tpMutex);
+    parallelTask = &task;
+    condition.notify_all();
+    while (hasPendingPart())
+    {
+        runPart(lock, callerBuffers);
+    }
+    condition.wait(lock, [&]() { return task.DonePartCount == task.PartCount; });
+    parallelTask = nullptr;
+    if (task.Error)
+    {
+        std::rethrow_exception(task.Error);
+    }
+}
+
+void ThreadPool::WaitForDevice(KernelBuffers * callerBuffers, DeviceJob const & job)
+{
+    if (nullptr == callerBuffers || nullptr == callerBuffers->threadPool || callerBuffers->threadPool->numberOfThreads < 2)
+    {
+        job();
+        return;
+    }
+    callerBuffers->threadPool->waitForDevice(job);
+}
+
+void ThreadPool::waitForDevice(DeviceJob const & job)
+{
+    {
+        std::lock_guard<std::mutex> lock(tpMutex);
+        isScoring = false;
+        condition.notify_all();
+    }
+    std::exception_ptr error;
+    try
+    {
+        job();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    std::unique_lock<std::mutex> lock(tpMutex);
+    resumingCount++;
+    condition.wait(lock, [&]() { return !isScoring; });
+    resumingCount--;
+    isScoring = true;
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+bool ThreadPool::hasPendingPart() const
+{
+    return nullptr != parallelTask && parallelTask->NextPart < parallelTask->PartCount;
+}
+
+void ThreadPool::runPart(std::unique_lock<std::mutex> & lock, KernelBuffers * partBuffers)
+{
+    auto & task = *parallelTask;
+    auto const part = task.NextPart++;
+    lock.unlock();
+    std::exception_ptr error;
+    try
+    {
+        task.Job(part, partBuffers);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    lock.lock();
+    if (error && !task.Error)
+    {
+        task.Error = error;
+    }
+    if (++task.DonePartCount == task.PartCount)
+    {
+        condition.notify_all();
+    }
+}
+
+void ThreadPool::addScoring(Request const & request, KernelBuffers const * worker)
+{
+    scoring.push_back({ request.Id, &request.Configuration, request.Cancellation, worker });
+}
+
+void ThreadPool::removeScoring(KernelBuffers const * worker)
+{
+    scoring.erase(std::remove_if(scoring.begin(), scoring.end(),
+        [worker](ScoredRequest const & request) { return worker == request.Worker; }), scoring.end());
+}
+
+bool ThreadPool::isStartable(Request const & request, KernelBuffers const * worker) const
+{
+    return std::none_of(scoring.begin(), scoring.end(), [&request, worker](ScoredRequest const & scored)
+        {
+            return worker != scored.Worker && &request.Configuration == scored.Configuration;
+        });
+}
+
+std::deque<Request *>::iterator ThreadPool::findStartable(KernelBuffers const * worker)
+{
+    return std::find_if(tasks.begin(), tasks.end(),
+        [this, worker](Request const * request) { return isStartable(*request, worker); });
+}
+
+void ThreadPool::collectBatch(std::unique_lock<std::mutex> & lock, std::vector<Request *> & batch,
+    KernelBuffers const * worker)
+{
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(batchWaitTime);
+    while (true)
+    {
+        // requests are taken in order, so scoring order is preserved
+        while (!tasks.empty() && batch.size() < batchSizeMax)
+        {
+            auto * const next = tasks.front();
+            if (next->TryDrop())
+            {
+                GNA_TRACE_REQUEST(TraceEventType::RequestDequeue, next->Id);
+                tasks.pop_front();
+                continue;
+            }
+            if (!next->IsBatchableWith(*batch.front()) || !isStartable(*next, worker))
+            {
+                break;
+            }
+            GNA_TRACE_REQUEST(TraceEventType::RequestDequeue, next->Id);
+            batch.push_back(next);
+            addScoring(*next, worker);
+            tasks.pop_front();
+        }
+        if (stopped || batch.size() >= batchSizeMax || !tasks.empty()
+            || std::chrono::steady_clock::now() >= deadline)
+        {
+            return;
+        }
+        condition.wait_until(lock, deadline);
+    }
+}
+
 void ThreadPool::employWorkers()
 {
     stopped = false;
     for (uint32_t i = 0; i < numberOfThreads; i++)
     {
         KernelBuffers* buff = &buffers.at(i);
+        buff->threadPool = this;
         this->workers.emplace_back([&, buff]() {
+            std::unique_lock<std::mutex> lock(tpMutex);
             while (true)
             {
-                std::unique_lock<std::mutex> lock(tpMutex);
-                condition.wait(lock, [&]() { return stopped || !tasks.empty(); });
+                condition.wait(lock, [&]()
+                {
+                    return stopped || hasPendingPart()
+                        || (!isScoring && 0 == resumingCount && tasks.end() != findStartable(buff));
+                });
                 if (stopped)
                 {
                     return;
                 }
-                if (!tasks.empty())
+                if (hasPendingPart())
+                {
+                    runPart(lock, buff);
+                    continue;
+                }
+                // requests of configurations being scored by other workers wait, as they share
+                // configuration buffers and session state, other requests keep their order
+                auto const startable = findStartable(buff);
+                auto request_task = *startable;
+                tasks.erase(startable);
+                GNA_TRACE_REQUEST(TraceEventType::RequestDequeue, request_task->Id);
+                // stale requests are dropped before processing
+                if (request_task->TryDrop())
+                {
+                    continue;
+                }
+                isScoring = true;
+                std::vector<Request *> batch{ request_task };
+                addScoring(*request_task, buff);
+                if (batchSizeMax > 1 && request_task->IsBatchable())
+                {
+                    collectBatch(lock, batch, buff);
+                }
+                if (stopped)
+                {
+                    tasks.insert(tasks.begin(), batch.begin(), batch.end());
+                    removeScoring(buff);
+                    isScoring = false;
+                    condition.notify_all();
+                    return;
+                }
+                lock.unlock();
+                if (batch.size() > 1)
+                {
+                    Request::ScoreBatch(batch, buff);
+                }
+                else
                 {
-                    auto request_task = tasks.front();
-                    tasks.pop_front();
                     request_task->operator()(buff);
                 }
+                lock.lock();
+                removeScoring(buff);
+                isScoring = false;
+                condition.notify_all();
             }
         });
     }
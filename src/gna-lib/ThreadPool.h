@@ -7,16 +7,22 @@
 
 #include "KernelArguments.h"
 
+#include <atomic>
 #include <condition_variable>
 #include <cstdint>
-#include <mutex>
 #include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 namespace GNA
 {
 class Request;
+class RequestConfiguration;
 
 class ThreadPool {
 public:
@@ -29,12 +35,72 @@ public:
 
     void SetNumberOfThreads(uint32_t threadCount);
 
+    // Ensures software scratch pad of every thread holds at least size bytes
+    void ReserveCnnScratchPad(uint32_t size);
+
+    // Enables coalescing of up to batchSizeMax pending requests for the same model,
+    // waiting up to waitTimeMax microseconds for further requests before scoring batch
+    void SetBatching(uint32_t batchSizeMaxIn, uint32_t waitTimeMax);
+
+    uint32_t GetBatchSizeMax() const;
+
+    // Queues request in order of deadlines, requests with the same deadline in order of enqueuing
     void Enqueue(Request *request);
+
+    // Drops queued request or stops request being scored before its next operation,
+    // returns false when request is neither queued nor being scored
+    bool Cancel(uint32_t requestId);
     void StopAndJoin();
 
+    using ParallelJob = std::function<void(uint32_t part, KernelBuffers * buffers)>;
+
+    // Runs job for every part of single operation of request being scored,
+    // parts are computed by calling worker and idle workers, each with its own buffers,
+    // returns when all parts are done, rethrows first exception thrown by any part
+    static void Parallelize(KernelBuffers * callerBuffers, uint32_t partCount, ParallelJob const & job);
+
+    using DeviceJob = std::function<void()>;
+
+    // Runs job waiting for device, while other workers may score further requests,
+    // scoring of calling worker is resumed before further requests are started, rethrows exception thrown by job
+    static void WaitForDevice(KernelBuffers * callerBuffers, DeviceJob const & job);
+
 private:
+    struct ParallelTask
+    {
+        ParallelJob const & Job;
+        uint32_t const PartCount;
+        uint32_t NextPart;
+        uint32_t DonePartCount;
+        std::exception_ptr Error;
+    };
+
     void employWorkers();
 
+    void parallelize(KernelBuffers * callerBuffers, uint32_t partCount, ParallelJob const & job);
+
+    void waitForDevice(DeviceJob const & job);
+
+    bool hasPendingPart() const;
+
+    void addScoring(Request const & request, KernelBuffers const * worker);
+
+    // Removes requests scored by worker, requests are not accessed as they may be already released
+    void removeScoring(KernelBuffers const * worker);
+
+    // Whether no other worker scores request of the same configuration
+    bool isStartable(Request const & request, KernelBuffers const * worker) const;
+
+    std::deque<Request *>::iterator findStartable(KernelBuffers const * worker);
+
+    // Moves requests batchable with first request of batch from front of queue to batch,
+    // lock is released while waiting for further requests
+    void collectBatch(std::unique_lock<std::mutex> & lock, std::vector<Request *> & batch,
+        KernelBuffers const * worker);
+
+    // Computes next part of parallel task, lock is released while part is computed
+    void runPart(std::unique_lock<std::mutex> & lock, KernelBuffers * partBuffers);
+
     // NOTE: order is important, buffers have to be destroyed last
     std::vector<KernelBuffers> buffers;
     std::mutex tpMutex;
@@ -43,6 +109,28 @@ private:
     std::condition_variable condition;
     std::vector<std::thread> workers;
     uint32_t numberOfThreads;
+    uint32_t cnnScratchSize = 0;
+    uint32_t batchSizeMax = 1;
+    uint32_t batchWaitTime = 0;
+
+    // Requests are scored one at a time, other workers only help with parallel tasks,
+    // except for requests waiting for device
+    bool isScoring = false;
+
+    // Number of workers done waiting for device, to resume scoring before further requests are started
+    uint32_t resumingCount = 0;
+
+    struct ScoredRequest
+    {
+        uint32_t Id;
+        RequestConfiguration const * Configuration;
+        std::shared_ptr<std::atomic<bool>> Cancellation;
+        KernelBuffers const * Worker;
+    };
+
+    // Requests being scored, including requests waiting for device
+    std::vector<ScoredRequest> scoring;
+    ParallelTask * parallelTask = nullptr;
 };
 
 }
@@ -0,0 +1,255 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "Tracer.h"
+
+#include "GnaException.h"
+#include "Logger.h"
+#include "gna2-inference-impl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace GNA;
+
+std::atomic<bool> Tracer::enabled{ false };
+
+namespace
+{
+
+struct TraceBuffer
+{
+    explicit TraceBuffer(uint32_t threadIndexIn) :
+        Events{ std::make_unique<TraceEvent[]>(Tracer::BufferCapacity) },
+        ThreadIndex{ threadIndexIn }
+    {
+    }
+
+    std::unique_ptr<TraceEvent[]> Events;
+
+    // Number of events written, event is published after it is written
+    std::atomic<uint64_t> Head{ 0 };
+
+    // Position of first event of current recording, guarded by registry lock
+    uint64_t First = 0;
+
+    uint32_t const ThreadIndex;
+
+    // Accessed by owning thread only
+    uint32_t RequestId = 0;
+
+    std::atomic<bool> IsOwned{ true };
+};
+
+struct TraceRegistry
+{
+    std::mutex Lock;
+    std::vector<std::unique_ptr<TraceBuffer>> Buffers;
+};
+
+// Never destroyed, as threads may record events during static destruction
+TraceRegistry & getRegistry()
+{
+    static auto * const registry = new TraceRegistry{};
+    return *registry;
+}
+
+// Releases buffer for reuse when thread exits
+struct ThreadBuffer
+{
+    ThreadBuffer() = default;
+    ThreadBuffer(const ThreadBuffer &) = delete;
+    ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+
+    ~ThreadBuffer()
+    {
+        if (nullptr != Buffer)
+        {
+            Buffer->IsOwned = false;
+        }
+    }
+
+    TraceBuffer * Buffer = nullptr;
+};
+
+thread_local ThreadBuffer threadBuffer;
+
+TraceBuffer & acquireBuffer()
+{
+    auto & registry = getRegistry();
+    std::lock_guard<std::mutex> lockGuard(registry.Lock);
+    for (auto const & buffer : registry.Buffers)
+    {
+        auto isOwned = false;
+        if (buffer->IsOwned.compare_exchange_strong(isOwned, true))
+        {
+            return *buffer;
+        }
+    }
+    auto const threadIndex = static_cast<uint32_t>(registry.Buffers.size());
+    registry.Buffers.push_back(std::make_unique<TraceBuffer>(threadIndex));
+    return *registry.Buffers.back();
+}
+
+TraceBuffer & getThreadBuffer()
+{
+    if (nullptr == threadBuffer.Buffer)
+    {
+        threadBuffer.Buffer = &acquireBuffer();
+    }
+    return *threadBuffer.Buffer;
+}
+
+uint64_t getTime()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void write(TraceBuffer & buffer, TraceEventType type, uint32_t arg0, uint32_t arg1)
+{
+    auto const position = buffer.Head.load(std::memory_order_relaxed);
+    buffer.Events[position & (Tracer::BufferCapacity - 1)] = { getTime(), type, buffer.RequestId, arg0, arg1 };
+    buffer.Head.store(position + 1, std::memory_order_release);
+}
+
+// Copies events of current recording, events that may be overwritten while being copied are dropped
+void collect(TraceBuffer const & buffer, std::vector<TraceEvent> & events)
+{
+    auto const head = buffer.Head.load(std::memory_order_acquire);
+    auto const begin = (std::max)(buffer.First, head > Tracer::BufferCapacity ? head - Tracer::BufferCapacity : 0);
+    std::vector<TraceEvent> copied;
+    for (auto position = begin; position < head; position++)
+    {
+        copied.push_back(buffer.Events[position & (Tracer::BufferCapacity - 1)]);
+    }
+    // event at position Head - BufferCapacity may be overwritten by event being written
+    auto const headAfterCopy = buffer.Head.load(std::memory_order_acquire);
+    auto const valid = headAfterCopy >= Tracer::BufferCapacity ? headAfterCopy - Tracer::BufferCapacity + 1 : 0;
+    auto const skipped = static_cast<size_t>((std::min)((std::max)(valid, begin), head) - begin);
+    events.insert(events.end(), copied.begin() + static_cast<std::ptrdiff_t>(skipped), copied.end());
+}
+
+char const * getAccelerationName(uint32_t mode)
+{
+    return AccelerationMode{ static_cast<Gna2AccelerationMode>(mode) }.GetName();
+}
+
+void writeEvent(std::ofstream & file, TraceEvent const & event, uint32_t threadIndex, uint64_t startTime)
+{
+    auto const time = event.Time - startTime;
+    file << ",\n{\"pid\":1,\"tid\":" << threadIndex
+        << ",\"ts\":" << time / 1000 << '.' << static_cast<char>('0' + time / 100 % 10)
+        << static_cast<char>('0' + time / 10 % 10) << static_cast<char>('0' + time % 10) << ',';
+    switch (event.Type)
+    {
+    case TraceEventType::RequestEnqueue:
+        file << "\"ph\":\"b\",\"cat\":\"request\",\"name\":\"Queued\",\"id\":" << event.Arg0;
+        break;
+    case TraceEventType::RequestDequeue:
+        file << "\"ph\":\"e\",\"cat\":\"request\",\"name\":\"Queued\",\"id\":" << event.Arg0;
+        break;
+    case TraceEventType::OperationBegin:
+    case TraceEventType::OperationEnd:
+        file << "\"ph\":\"" << (TraceEventType::OperationBegin == event.Type ? 'B' : 'E')
+            << "\",\"cat\":\"software\",\"name\":\"Operation\",\"args\":{\"request\":" << event.RequestId
+            << ",\"operation\":" << event.Arg0 << ",\"kernel\":\"" << getAccelerationName(event.Arg1) << "\"}";
+        break;
+    case TraceEventType::DriverSubmit:
+        file << "\"ph\":\"B\",\"cat\":\"hardware\",\"name\":\"Device\",\"args\":{\"request\":" << event.RequestId
+            << ",\"operation\":" << event.Arg0 << ",\"operations\":" << event.Arg1 << '}';
+        break;
+    case TraceEventType::DriverComplete:
+        file << "\"ph\":\"E\",\"cat\":\"hardware\",\"name\":\"Device\",\"args\":{\"request\":" << event.RequestId
+            << ",\"status\":" << static_cast<int32_t>(event.Arg0) << '}';
+        break;
+    case TraceEventType::Fallback:
+        file << "\"ph\":\"i\",\"s\":\"t\",\"cat\":\"hardware\",\"name\":\"Fallback\",\"args\":{\"request\":"
+            << event.RequestId << ",\"queueDepth\":" << event.Arg0 << '}';
+        break;
+    }
+    file << '}';
+}
+
+}
+
+void Tracer::Start()
+{
+    auto & registry = getRegistry();
+    std::lock_guard<std::mutex> lockGuard(registry.Lock);
+    for (auto const & buffer : registry.Buffers)
+    {
+        buffer->First = buffer->Head.load(std::memory_order_acquire);
+    }
+    enabled = true;
+}
+
+void Tracer::Stop()
+{
+    enabled = false;
+}
+
+void Tracer::RecordRequest(TraceEventType type, uint32_t requestId)
+{
+    auto & buffer = getThreadBuffer();
+    if (TraceEventType::RequestDequeue == type)
+    {
+        buffer.RequestId = requestId;
+    }
+    write(buffer, type, requestId, 0);
+}
+
+void Tracer::Record(TraceEventType type, uint32_t arg0, uint32_t arg1)
+{
+    write(getThreadBuffer(), type, arg0, arg1);
+}
+
+void Tracer::Export(std::string const & filePath)
+{
+    std::vector<std::pair<uint32_t, std::vector<TraceEvent>>> threads;
+    {
+        auto & registry = getRegistry();
+        std::lock_guard<std::mutex> lockGuard(registry.Lock);
+        for (auto const & buffer : registry.Buffers)
+        {
+            threads.emplace_back(buffer->ThreadIndex, std::vector<TraceEvent>{});
+            collect(*buffer, threads.back().second);
+        }
+    }
+
+    auto startTime = (std::numeric_limits<uint64_t>::max)();
+    for (auto const & thread : threads)
+    {
+        if (!thread.second.empty())
+        {
+            startTime = (std::min)(startTime, thread.second.front().Time);
+        }
+    }
+
+    std::ofstream file{ filePath };
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+        << "{\"pid\":1,\"ph\":\"M\",\"name\":\"process_name\",\"args\":{\"name\":\"GNA library\"}}";
+    for (auto const & thread : threads)
+    {
+        file << ",\n{\"pid\":1,\"tid\":" << thread.first
+            << ",\"ph\":\"M\",\"name\":\"thread_name\",\"args\":{\"name\":\"Thread " << thread.first << "\"}}";
+        for (auto const & event : thread.second)
+        {
+            writeEvent(file, event, thread.first, startTime);
+        }
+    }
+    file << "\n]}\n";
+    if (!file)
+    {
+        Log->Error("Trace file %s cannot be written.\n", filePath.c_str());
+        throw GnaException(Gna2StatusUnknownError);
+    }
+}
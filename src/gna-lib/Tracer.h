@@ -0,0 +1,90 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace GNA
+{
+
+enum class TraceEventType : uint32_t
+{
+    // Arg0: request id
+    RequestEnqueue,
+    // Arg0: request id, following events of the thread belong to the request
+    RequestDequeue,
+    // Arg0: operation index, Arg1: acceleration mode of kernel used
+    OperationBegin,
+    // Arg0: operation index, Arg1: acceleration mode of kernel used
+    OperationEnd,
+    // Arg0: first operation index, Arg1: number of operations
+    DriverSubmit,
+    // Arg0: request status returned by driver
+    DriverComplete,
+    // Arg0: device queue depth when request was routed to software
+    Fallback,
+};
+
+struct TraceEvent
+{
+    // Steady clock time in nanoseconds
+    uint64_t Time;
+    TraceEventType Type;
+    // Request being processed by recording thread
+    uint32_t RequestId;
+    uint32_t Arg0;
+    uint32_t Arg1;
+};
+
+// Records request lifecycle events into per-thread ring buffers
+//
+// Each thread writes its own buffer without locking, buffer is allocated at first event of the thread.
+// When buffer is full, oldest events are overwritten.
+// Buffers of exited threads are kept and reused by new threads, so their events can still be exported.
+// Recording is disabled by default, events are recorded only between Start() and Stop().
+// When library is built without GNA_TRACING_ENABLED, GNA_TRACE macros compile to nothing.
+class Tracer
+{
+public:
+    static bool IsEnabled()
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    // Drops events recorded so far and enables recording
+    static void Start();
+
+    static void Stop();
+
+    // Records event of request with given id
+    static void RecordRequest(TraceEventType type, uint32_t requestId);
+
+    // Records event of request being processed by calling thread
+    static void Record(TraceEventType type, uint32_t arg0, uint32_t arg1 = 0);
+
+    // Saves events recorded since Start() in Chrome trace event JSON format, readable by Perfetto,
+    // recording may be in progress
+    static void Export(std::string const & filePath);
+
+    // Number of events kept per thread, power of 2
+    static constexpr uint32_t BufferCapacity = 1 << 14;
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+}
+
+#if 1 == GNA_TRACING_ENABLED
+#define GNA_TRACE_REQUEST(type, requestId) do { if (GNA::Tracer::IsEnabled()) \
+    { GNA::Tracer::RecordRequest(type, requestId); } } while (0)
+#define GNA_TRACE(...) do { if (GNA::Tracer::IsEnabled()) { GNA::Tracer::Record(__VA_ARGS__); } } while (0)
+#else
+#define GNA_TRACE_REQUEST(type, requestId) ((void)0)
+#define GNA_TRACE(...) ((void)0)
+#endif
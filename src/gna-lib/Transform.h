@@ -134,7 +134,7 @@ public:
         updateExecutionKernelConfig(*executionConfig);
         try
         {
-            kernels->at(accel)(executionConfig.get());
+            kernels->Get(accel)(executionConfig.get());
         }
         catch (const std::out_of_range&)
         {
@@ -156,6 +156,32 @@ public:
         }
     }
 
+    // Kernel configuration of transform for request, base of configurations of transform parts
+    KernelConfig<TransformType> const & GetKernelConfig(LayerConfiguration const * layerConfiguration) const
+    {
+        if (nullptr == layerConfiguration)
+        {
+            return *hiddenConfig;
+        }
+        return *static_cast<KernelConfig<TransformType>*>(layerConfiguration->ConfigList[Operation].get());
+    }
+
+    // Computes part of transform, with buffers and dimensions of part set explicitly in configuration,
+    // using partKernels when part requires other kernels than transform, e.g. for larger grouping
+    void ComputePart(AccelerationMode accel, KernelConfig<TransformType> const & part,
+        ExecutionConfig const & execution, KernelMap<KernelType> const * partKernels = nullptr) const
+    {
+        auto const executionConfig = ExecutionKernelConfig<TransformType>{ part, execution };
+        try
+        {
+            (nullptr != partKernels ? partKernels : kernels)->Get(accel)(&executionConfig);
+        }
+        catch (const std::out_of_range&)
+        {
+            throw GnaException(Gna2StatusNotImplemented);
+        }
+    }
+
     // set output when transform is final layer transform and uses user provided layer output buffer
     virtual void SetOutput(const BaseAddress& outputBuffer) override
     {
@@ -194,17 +220,8 @@ protected:
     inline std::unique_ptr<ExecutionKernelConfig<TransformType>> createExecutionConfig(
         const LayerConfiguration * layerConfiguration, ExecutionConfig const & execution) const
     {
-        if (nullptr == layerConfiguration)
-        {
-            return std::make_unique<ExecutionKernelConfig<TransformType>>(
-                *hiddenConfig.get(), execution);
-        }
-        else
-        {
-            return std::make_unique<ExecutionKernelConfig<TransformType>>(
-                *static_cast<KernelConfig<TransformType>*>(layerConfiguration->ConfigList[Operation].get()),
-                execution);
-        }
+        return std::make_unique<ExecutionKernelConfig<TransformType>>(
+            GetKernelConfig(layerConfiguration), execution);
     }
 
     virtual void updateExecutionKernelConfig(ExecutionKernelConfig<TransformType> & config) const
@@ -246,13 +263,13 @@ public:
         {
             if (layerConfiguration != nullptr && layerConfiguration->ActList)
             {
-                kernelsAl->at(accel)(executionConfig.get(), AffineConfigAl{
+                kernelsAl->Get(accel)(executionConfig.get(), AffineConfigAl{
                                     layerConfiguration->ActList->Indices,
                                     layerConfiguration->ActList->IndicesCount });
             }
             else
             {
-                Transform<TransformType, KernelType>::kernels->at(accel)(executionConfig.get());
+                Transform<TransformType, KernelType>::kernels->Get(accel)(executionConfig.get());
             }
         }
         catch (const std::out_of_range&)
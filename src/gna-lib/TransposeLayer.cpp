@@ -71,12 +71,12 @@ void TransposeLayer::UpdateKernelConfigs(LayerConfiguration& layerConfiguration)
 void TransposeLayer::computeHidden(AccelerationMode accel, ExecutionConfig const & executionConfig) const
 {
     UNREFERENCED_PARAMETER(executionConfig);
-    transposeKernels.at(accel)(transposeHiddenConfig.get());
+    transposeKernels.Get(accel)(transposeHiddenConfig.get());
 }
 
 void TransposeLayer::compute(const LayerConfiguration& layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig) const
 {
     UNREFERENCED_PARAMETER(executionConfig);
     auto transposeConfig = layerConfiguration.Configs.Transpose.get();
-    transposeKernels.at(accel)(transposeConfig);
+    transposeKernels.Get(accel)(transposeConfig);
 }
@@ -14,8 +14,10 @@ using namespace GNA;
 
 BaseValidator::BaseValidator(
     Gna2DeviceGeneration generation,
-    const ValidBoundariesFunctor validBoundariesIn) :
+    const ValidBoundariesFunctor validBoundariesIn,
+    bool isSoftwareOnly) :
     Generation{ generation },
+    IsSoftwareOnly{ isSoftwareOnly },
     bufferValidator{ validBoundariesIn }
 {
 }
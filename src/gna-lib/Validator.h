@@ -25,7 +25,8 @@ class BaseValidator
 public:
     BaseValidator(
         Gna2DeviceGeneration generation,
-        const ValidBoundariesFunctor validBoundariesIn);
+        const ValidBoundariesFunctor validBoundariesIn,
+        bool isSoftwareOnly = false);
     virtual ~BaseValidator() = default;
 
 
@@ -40,6 +41,10 @@ public:
 
     const Gna2DeviceGeneration Generation;
 
+    // Allows limits of software only models, e.g., fully connected affine grouping up to LargeBatchSizeMax,
+    // 4-bit affine weights and 2D convolution filters
+    const bool IsSoftwareOnly;
+
 protected:
     void validateBuffer(const void* const buffer, size_t size, const uint32_t alignment) const;
 
@@ -17,10 +17,23 @@ using namespace GNA;
 
 const FullCapabilitiesMap WeightTensor::capabilities = LayerCapabilities::MakeFullCaps<WeightOperandIndex>();
 
+// Selects software only capabilities of affine weights and 2D convolution filters when enabled by validator
+static const FullCapabilitiesMap& getWeightOperands(const LayerValidator& validatorIn,
+    const FullCapabilitiesMap& capabilities)
+{
+    if (validatorIn.IsSoftwareOnly && INTEL_CONVOLUTIONAL_2D == validatorIn.Operation)
+    {
+        return ConvolutionalLayer2DCapabilities::GetSoftwareOnlyFilterOperands();
+    }
+    return AffineLayerCapabilities::GetWeightOperands(validatorIn, capabilities);
+}
+
 WeightTensor::WeightTensor(const Shape& dimensions, const DataMode& dataMode,
     void * buffer, const LayerValidator& validatorIn)
 try :
-    Tensor{ dimensions, dataMode, buffer, Validator{validatorIn, capabilities}, WeightOperandIndex }
+    Tensor{ dimensions, dataMode, buffer,
+        Validator{ validatorIn, getWeightOperands(validatorIn, capabilities) },
+        WeightOperandIndex }
 {
 }
 catch (GnaException&)
@@ -30,7 +43,9 @@ catch (GnaException&)
 
 WeightTensor::WeightTensor(const Gna2Tensor &apiTensor, const LayerValidator& validatorIn)
 try :
-    Tensor(apiTensor, capabilities.GetOrder(validatorIn), Validator{ validatorIn, capabilities }, WeightOperandIndex)
+    Tensor(apiTensor, capabilities.GetOrder(validatorIn),
+        Validator{ validatorIn, getWeightOperands(validatorIn, capabilities) },
+        WeightOperandIndex)
 {
 }
 catch (GnaException&)
@@ -120,6 +120,8 @@ const std::map<Gna2Status, std::string>& GNA::StatusHelper::GetStringMap()
         { Gna2StatusDriverQoSTimeoutExceeded, "Gna2StatusDriverQoSTimeoutExceeded" },
         { Gna2StatusHardwareModuleNotFound, "Gna2StatusHardwareModuleNotFound" },
         { Gna2StatusHardwareModuleSymbolNotFound, "Gna2StatusHardwareModuleSymbolNotFound" },
+        { Gna2StatusRequestCanceled, "Gna2StatusRequestCanceled" },
+        { Gna2StatusRequestDeadlineExceeded, "Gna2StatusRequestDeadlineExceeded" },
         { Gna2StatusDriverCommunicationMemoryMapError, "Gna2StatusDriverCommunicationMemoryMapError" },
     };
     return Gna2StatusToStringMap;
@@ -54,6 +54,60 @@ enum Gna2Status Gna2DeviceSetNumberOfThreads(
     return ApiWrapper::ExecuteSafely(command);
 }
 
+enum Gna2Status Gna2DeviceSetRequestBatching(
+    uint32_t deviceIndex,
+    uint32_t batchSizeMax,
+    uint32_t waitTimeMax)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& deviceManager = DeviceManager::Get();
+        deviceManager.SetRequestBatching(deviceIndex, batchSizeMax, waitTimeMax);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+enum Gna2Status Gna2DeviceSetSoftwareFallbackBudget(
+    uint32_t deviceIndex,
+    uint32_t budget)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& deviceManager = DeviceManager::Get();
+        deviceManager.SetSoftwareFallbackBudget(deviceIndex, budget);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+enum Gna2Status Gna2DeviceEnableKernelTuning(
+    uint32_t deviceIndex,
+    char const * tuningCacheFile)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& deviceManager = DeviceManager::Get();
+        deviceManager.EnableKernelTuning(deviceIndex, nullptr == tuningCacheFile ? "" : tuningCacheFile);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+enum Gna2Status Gna2DeviceSetPartitionCosts(
+    uint32_t deviceIndex,
+    struct Gna2PartitionCosts const * costs)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        Expect::NotNull(costs);
+        auto& deviceManager = DeviceManager::Get();
+        deviceManager.SetPartitionCosts(deviceIndex, *costs);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
 enum Gna2Status Gna2DeviceOpen(
     uint32_t deviceIndex)
 {
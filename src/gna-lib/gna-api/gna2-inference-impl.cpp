@@ -69,7 +69,24 @@ GNA2_API enum Gna2Status Gna2RequestConfigEnableHardwareConsistency(
     const std::function<ApiStatus()> command = [&]()
     {
         auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
-        return device.IsVersionConsistent(deviceVersion) ? Gna2StatusSuccess : Gna2StatusDeviceVersionInvalid;
+        if (!device.IsVersionConsistent(deviceVersion))
+        {
+            return Gna2StatusDeviceVersionInvalid;
+        }
+        device.EnableHardwareConsistency(requestConfigId);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2RequestConfigDisableHardwareConsistency(
+    uint32_t requestConfigId)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        device.DisableHardwareConsistency(requestConfigId);
+        return Gna2StatusSuccess;
     };
     return ApiWrapper::ExecuteSafely(command);
 }
@@ -87,6 +104,19 @@ GNA2_API enum Gna2Status Gna2RequestConfigSetAccelerationMode(
     return ApiWrapper::ExecuteSafely(command);
 }
 
+GNA2_API enum Gna2Status Gna2RequestConfigSetDeadline(
+    uint32_t requestConfigId,
+    uint32_t deadlineMicroseconds)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        device.SetRequestDeadline(requestConfigId, deadlineMicroseconds);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
 GNA2_API enum Gna2Status Gna2RequestConfigRelease(
     uint32_t requestConfigId)
 {
@@ -124,7 +154,111 @@ GNA2_API enum Gna2Status Gna2RequestWait(
     return ApiWrapper::ExecuteSafely(command);
 }
 
-AccelerationMode::AccelerationMode(Gna2AccelerationMode basicMode)
+GNA2_API enum Gna2Status Gna2RequestCancel(
+    uint32_t requestId)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        DeviceManager::Get().CancelRequest(requestId);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2SessionCreate(
+    uint32_t requestConfigId,
+    uint32_t * sessionId)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        device.CreateSession(requestConfigId, sessionId);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2SessionEnqueue(
+    uint32_t sessionId,
+    uint32_t * requestId)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForSessionId(sessionId);
+        device.PropagateSessionRequest(sessionId, requestId);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2SessionReset(
+    uint32_t sessionId)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForSessionId(sessionId);
+        device.GetSession(sessionId).Reset();
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2SessionGetStateSize(
+    uint32_t sessionId,
+    uint32_t * stateSize)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        Expect::NotNull(stateSize);
+        auto& device = DeviceManager::Get().GetDeviceForSessionId(sessionId);
+        *stateSize = device.GetSession(sessionId).GetStateSize();
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2SessionSaveState(
+    uint32_t sessionId,
+    void * state,
+    uint32_t stateSize)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForSessionId(sessionId);
+        device.GetSession(sessionId).SaveState(state, stateSize);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2SessionRestoreState(
+    uint32_t sessionId,
+    void const * state,
+    uint32_t stateSize)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForSessionId(sessionId);
+        device.GetSession(sessionId).RestoreState(state, stateSize);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2SessionRelease(
+    uint32_t sessionId)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForSessionId(sessionId);
+        device.ReleaseSession(sessionId);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+AccelerationMode::AccelerationMode(Gna2AccelerationMode basicMode, bool isRelaxedIn) :
+    isRelaxed{ isRelaxedIn }
 {
     SetMode(basicMode);
 }
@@ -160,13 +294,13 @@ AccelerationMode AccelerationMode::GetEffectiveSoftwareAccelerationMode(
         IsSoftwareFallbackEnabled())
     {
         //last is fastest
-        return AccelerationMode{ supportedCpuAccelerations.back() };
+        return AccelerationMode{ supportedCpuAccelerations.back(), isRelaxed };
     }
     for(const auto& supported: supportedCpuAccelerations)
     {
         if(mode == supported)
         {
-            return AccelerationMode{ supported };
+            return AccelerationMode{ supported, isRelaxed };
         }
     }
     throw GnaException(Gna2StatusAccelerationModeNotSupported);
@@ -208,7 +342,7 @@ const char* AccelerationMode::UNKNOWN_ACCELERATION_MODE_NAME = "GNA_UNKNOWN_ACCE
 
 const char* AccelerationMode::GetName() const
 {
-    auto item = AccelerationModeNames.find(*this);
+    auto item = AccelerationModeNames.find(GetConsistent());
     if (item != AccelerationModeNames.end())
     {
         return item->second;
@@ -221,7 +355,26 @@ Gna2AccelerationMode AccelerationMode::GetMode() const
     return mode;
 }
 
+bool AccelerationMode::IsRelaxed() const
+{
+    return isRelaxed;
+}
+
+void AccelerationMode::SetRelaxed(bool isRelaxedIn)
+{
+    isRelaxed = isRelaxedIn;
+}
+
+AccelerationMode AccelerationMode::GetConsistent() const
+{
+    return AccelerationMode{ mode };
+}
+
 bool AccelerationMode::operator<(const AccelerationMode& right) const
 {
-    return mode < right.mode;
+    if (mode != right.mode)
+    {
+        return mode < right.mode;
+    }
+    return isRelaxed < right.isRelaxed;
 }
@@ -22,7 +22,7 @@ namespace GNA
 class AccelerationMode
 {
 public:
-    AccelerationMode(Gna2AccelerationMode basicMode);
+    AccelerationMode(Gna2AccelerationMode basicMode, bool isRelaxedIn = false);
 
     bool IsHardwareEnforced() const;
 
@@ -43,9 +43,19 @@ public:
 
     const char* GetName() const;
 
+    // Relaxed mode drops device buffers emulation, thus is not consistent with hardware
+    bool IsRelaxed() const;
+
+    void SetRelaxed(bool isRelaxedIn);
+
+    // Returns hardware consistent counterpart of the mode
+    AccelerationMode GetConsistent() const;
+
 private:
     Gna2AccelerationMode mode;
 
+    bool isRelaxed = false;
+
     static const char* UNKNOWN_ACCELERATION_MODE_NAME;
 };
 
@@ -10,6 +10,7 @@
 #include "Expect.h"
 #include "DeviceManager.h"
 #include "ApiWrapper.h"
+#include "Tracer.h"
 
 using namespace GNA;
 
@@ -70,6 +71,34 @@ Gna2Status Gna2InstrumentationConfigAssignToRequestConfig(
     return ApiWrapper::ExecuteSafely(command);
 }
 
+Gna2Status Gna2InstrumentationConfigSetOperationResults(
+    uint32_t instrumentationConfigId,
+    uint32_t numberOfOperationResults,
+    Gna2InstrumentationOperationResult * operationResults)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& config = DeviceManager::Get().ProfilerConfigManager.GetConfiguration(instrumentationConfigId);
+        config.SetOperationResults(numberOfOperationResults, operationResults);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+Gna2Status Gna2InstrumentationConfigGetNumberOfOperationResults(
+    uint32_t instrumentationConfigId,
+    uint32_t * numberOfOperationResults)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        Expect::NotNull(numberOfOperationResults);
+        auto const& config = DeviceManager::Get().ProfilerConfigManager.GetConfiguration(instrumentationConfigId);
+        *numberOfOperationResults = config.GetNumberOfOperationResults();
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
 Gna2Status Gna2InstrumentationConfigRelease(uint32_t instrumentationConfigId)
 {
     const std::function<ApiStatus()> command = [&]()
@@ -78,4 +107,101 @@ Gna2Status Gna2InstrumentationConfigRelease(uint32_t instrumentationConfigId)
         return Gna2StatusSuccess;
     };
     return ApiWrapper::ExecuteSafely(command);
-}
\ No newline at end of file
+}
+
+Gna2Status Gna2ModelGetStatistics(uint32_t modelId, Gna2RequestStatistics * statistics)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        Expect::NotNull(statistics);
+        auto& device = DeviceManager::Get().GetDeviceForModel(modelId);
+        *statistics = device.GetModelStatistics(modelId).GetSnapshot(false);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+Gna2Status Gna2ModelResetStatistics(uint32_t modelId, Gna2RequestStatistics * statistics)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForModel(modelId);
+        auto const snapshot = device.GetModelStatistics(modelId).GetSnapshot(true);
+        if (nullptr != statistics)
+        {
+            *statistics = snapshot;
+        }
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+Gna2Status Gna2RequestConfigGetStatistics(uint32_t requestConfigId, Gna2RequestStatistics * statistics)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        Expect::NotNull(statistics);
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        *statistics = device.GetRequestConfigStatistics(requestConfigId).GetSnapshot(false);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+Gna2Status Gna2RequestConfigResetStatistics(uint32_t requestConfigId, Gna2RequestStatistics * statistics)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        auto const snapshot = device.GetRequestConfigStatistics(requestConfigId).GetSnapshot(true);
+        if (nullptr != statistics)
+        {
+            *statistics = snapshot;
+        }
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+Gna2Status Gna2InstrumentationTraceStart()
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+#if 1 == GNA_TRACING_ENABLED
+        Tracer::Start();
+        return Gna2StatusSuccess;
+#else
+        return Gna2StatusNotImplemented;
+#endif
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+Gna2Status Gna2InstrumentationTraceStop()
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+#if 1 == GNA_TRACING_ENABLED
+        Tracer::Stop();
+        return Gna2StatusSuccess;
+#else
+        return Gna2StatusNotImplemented;
+#endif
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+Gna2Status Gna2InstrumentationTraceExport(char const * traceFile)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        Expect::NotNull(traceFile);
+#if 1 == GNA_TRACING_ENABLED
+        Tracer::Export(traceFile);
+        return Gna2StatusSuccess;
+#else
+        return Gna2StatusNotImplemented;
+#endif
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
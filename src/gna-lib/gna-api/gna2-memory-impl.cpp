@@ -29,11 +29,22 @@ GNA2_API enum Gna2Status Gna2MemoryAllocForDevice(
     uint32_t sizeRequested,
     uint32_t * sizeGranted,
     void ** memoryAddress)
+{
+    return Gna2MemoryAllocWithFlags(deviceIndex, sizeRequested, Gna2MemoryAllocFlagNone,
+        sizeGranted, memoryAddress);
+}
+
+GNA2_API enum Gna2Status Gna2MemoryAllocWithFlags(
+    uint32_t deviceIndex,
+    uint32_t sizeRequested,
+    uint32_t flags,
+    uint32_t * sizeGranted,
+    void ** memoryAddress)
 {
     const std::function<ApiStatus()> command = [&]()
     {
         auto& deviceManager = DeviceManager::Get();
-        deviceManager.AllocateMemory(deviceIndex, sizeRequested, sizeGranted, memoryAddress);
+        deviceManager.AllocateMemory(deviceIndex, sizeRequested, sizeGranted, memoryAddress, flags);
         return Gna2StatusSuccess;
     };
     return ApiWrapper::ExecuteSafely(command);
@@ -50,6 +61,18 @@ GNA2_API enum Gna2Status Gna2MemoryFree(
     return ApiWrapper::ExecuteSafely(command);
 }
 
+GNA2_API enum Gna2Status Gna2MemoryRegisterReadOnly(
+    void * memory,
+    uint32_t size)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        DeviceManager::Get().RegisterReadOnlyMemory(memory, size);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
 GNA2_API enum Gna2Status Gna2MemorySetTag(
     void * memory,
     uint32_t tag)
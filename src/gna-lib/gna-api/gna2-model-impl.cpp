@@ -47,6 +47,37 @@ GNA2_API enum Gna2Status Gna2ModelRelease(uint32_t modelId)
     return ApiWrapper::ExecuteSafely(command);
 }
 
+GNA2_API enum Gna2Status Gna2ModelGetNumberOfPartitions(
+    uint32_t modelId,
+    uint32_t * numberOfPartitions)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        Expect::NotNull(numberOfPartitions);
+        auto& device = DeviceManager::Get().GetDeviceForModel(modelId);
+        *numberOfPartitions = static_cast<uint32_t>(device.GetModelPartitions(modelId).size());
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2ModelGetPartition(
+    uint32_t modelId,
+    uint32_t partitionIndex,
+    struct Gna2ModelPartition * partition)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        Expect::NotNull(partition);
+        auto& device = DeviceManager::Get().GetDeviceForModel(modelId);
+        auto const partitions = device.GetModelPartitions(modelId);
+        Expect::True(partitionIndex < partitions.size(), Gna2StatusIdentifierInvalid);
+        *partition = partitions[partitionIndex];
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
 GNA2_API enum Gna2Status Gna2ModelGetLastError(struct Gna2ModelError * error)
 {
     const std::function<ApiStatus()> command = [&]()
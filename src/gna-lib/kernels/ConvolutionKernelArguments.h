@@ -73,4 +73,14 @@ struct ConvolutionConfig2D
     const KernelBiasMode BiasMode;
     const KernelDataMode BiasDataMode;
     const void* const BiasData;
+
+    // Range of output rows computed, rows are stored from the beginning of outputs
+    // all rows are computed when OutputRowCount is 0
+    uint32_t OutputRowFirst = 0;
+    uint32_t OutputRowCount = 0;
+
+    uint32_t GetOutputRowEnd(uint32_t outputHeight) const
+    {
+        return 0 == OutputRowCount ? outputHeight : OutputRowFirst + OutputRowCount;
+    }
 };
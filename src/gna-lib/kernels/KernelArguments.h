@@ -21,6 +21,11 @@ using GNA::BiasRegular;
 using GNA::WeightScaleFactor;
 
 
+namespace GNA
+{
+class ThreadPool;
+}
+
 /** Number of input groups constraint - max */
 const uint32_t XNN_N_GROUP_MAX = 8;
 
@@ -65,11 +70,14 @@ struct KernelBuffers
     int64_t *pool = nullptr;
     int8_t *cnnFusedBuffer = nullptr;
     uint32_t cnnFusedBufferSize = 0;
+    // pool owning buffers, used to compute parts of single operation in parallel
+    GNA::ThreadPool *threadPool = nullptr;
 };
 
 namespace GNA
 {
 struct PwlCached;
+class RequestProfiler;
 }
 
 struct BaseConfig
@@ -124,6 +132,8 @@ struct ExecutionConfig
     KernelBuffers * const Intermediate;
     uint32_t * const SaturationCount;
     uint32_t const * const BufferElementCount;
+    // set when software operation profiling is enabled, not used by kernels
+    GNA::RequestProfiler * Profiler = nullptr;
 };
 
 template<typename TransformConfig>
@@ -168,6 +178,7 @@ struct AffineConfig
     {
         int8_t const * const weights1B;     // W - [M;K]
         int16_t const * const weights2B;    // W - [M;K]
+        uint8_t const * const weights4B;    // W - [M;K/2] 4-bit weights packed in pairs
     };
     union
     {
@@ -7,6 +7,7 @@
 
 #include "convnet.h"
 #include "igemv16.h"
+#include "igemv4.h"
 #include "igemv8.h"
 #include "pwl.h"
 
@@ -15,7 +16,11 @@
 #include "Macros.h"
 
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
+#if OPT_LEVEL > 1
+#include <immintrin.h>
+#endif
 
 static GNA::VoidKernel GetXnnKernelHelper(GNA::KernelType type);
 
@@ -25,7 +30,6 @@ namespace GNA
 #define activationKernelImpl KERNEL(activationKernelImpl)
 #define recurrentKernelImpl1B KERNEL(recurrentKernelImpl1B)
 #define recurrentKernelImpl2B KERNEL(recurrentKernelImpl2B)
-#define copyKernelImpl KERNEL(copyKernelImpl)
 #define copyKernelImpl1B KERNEL(copyKernelImpl1B)
 #define copyKernelImpl2B KERNEL(copyKernelImpl2B)
 #define InitializeActivationFunctions KERNEL(InitializeActivationFunctions)
@@ -313,51 +317,106 @@ void recurrentKernelImpl2B2B(ExecutionKernelConfig<RecurrentConfig> * const conf
 }
 
 #endif
-void copyKernelImpl(CopyConfig const * const config)
-{
-    uint32_t row;
-    uint32_t bytesToCopy = config->columnCount * static_cast<uint32_t>(sizeof(int16_t));
 
-    for (row = 0; row < config->rowCount; row++)
+#if OPT_LEVEL > 1
+/** Copies single row with unaligned vector loads and stores, remaining bytes are copied with memcpy */
+static void copyRowVectorized(uint8_t const * input, uint8_t * output, uint32_t byteCount)
+{
+    constexpr auto vector128Size = static_cast<uint32_t>(sizeof(__m128i));
+#if OPT_LEVEL > 3
+    constexpr auto vector256Size = static_cast<uint32_t>(sizeof(__m256i));
+    for (; byteCount >= 4 * vector256Size; byteCount -= 4 * vector256Size)
+    {
+        auto const v0 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input));
+        auto const v1 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input) + 1);
+        auto const v2 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input) + 2);
+        auto const v3 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input) + 3);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output), v0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output) + 1, v1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output) + 2, v2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output) + 3, v3);
+        input += 4 * vector256Size;
+        output += 4 * vector256Size;
+    }
+    for (; byteCount >= vector256Size; byteCount -= vector256Size)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output),
+            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input)));
+        input += vector256Size;
+        output += vector256Size;
+    }
+#else
+    for (; byteCount >= 4 * vector128Size; byteCount -= 4 * vector128Size)
     {
-        memmove_s(
-            config->output + (config->outputColumnCount * row),
-            bytesToCopy,
-            config->input + (config->inputColumnCount * row),
-            bytesToCopy);
+        auto const v0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input));
+        auto const v1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input) + 1);
+        auto const v2 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input) + 2);
+        auto const v3 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input) + 3);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), v0);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output) + 1, v1);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output) + 2, v2);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output) + 3, v3);
+        input += 4 * vector128Size;
+        output += 4 * vector128Size;
+    }
+#endif
+    for (; byteCount >= vector128Size; byteCount -= vector128Size)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+            _mm_loadu_si128(reinterpret_cast<__m128i const *>(input)));
+        input += vector128Size;
+        output += vector128Size;
+    }
+    if (byteCount > 0)
+    {
+        memcpy(output, input, byteCount);
     }
 }
+#endif
 
-void copyKernelImpl1B(CopyConfig const * const config)
+/** Copies rows of elementSize wide elements, overlapping buffers are copied row by row with memmove */
+static void copyRows(CopyConfig const * const config, uint32_t const elementSize)
 {
-    uint32_t row;
-    uint32_t bytesToCopy = config->columnCount * static_cast<uint32_t>(sizeof(int8_t));
+    auto const bytesToCopy = config->columnCount * elementSize;
+    auto const inputStride = config->inputColumnCount * elementSize;
+    auto const outputStride = config->outputColumnCount * elementSize;
+    auto const input = reinterpret_cast<uint8_t const *>(config->input);
+    auto const output = reinterpret_cast<uint8_t *>(config->output);
 
-    for (row = 0; row < config->rowCount; row++)
+    if (0 == config->rowCount)
     {
-        memmove_s(
-            (int8_t*)config->output + (config->outputColumnCount * row),
-            bytesToCopy,
-            (int8_t*)config->input + (config->inputColumnCount * row),
-            bytesToCopy);
+        return;
     }
-}
 
-void copyKernelImpl2B(CopyConfig const * const config)
-{
-    uint32_t row;
-    uint32_t bytesToCopy = config->columnCount * static_cast<uint32_t>(sizeof(int16_t));
+#if OPT_LEVEL > 1
+    auto const inputEnd = input + (config->rowCount - 1) * inputStride + bytesToCopy;
+    auto const outputEnd = output + (config->rowCount - 1) * outputStride + bytesToCopy;
+    if (output >= inputEnd || input >= outputEnd)
+    {
+        for (uint32_t row = 0; row < config->rowCount; row++)
+        {
+            copyRowVectorized(input + inputStride * row, output + outputStride * row, bytesToCopy);
+        }
+        return;
+    }
+#endif
 
-    for (row = 0; row < config->rowCount; row++)
+    for (uint32_t row = 0; row < config->rowCount; row++)
     {
-        memmove_s(
-            config->output + (config->outputColumnCount * row),
-            bytesToCopy,
-            config->input + (config->inputColumnCount * row),
-            bytesToCopy);
+        memmove_s(output + outputStride * row, bytesToCopy, input + inputStride * row, bytesToCopy);
     }
 }
 
+void copyKernelImpl1B(CopyConfig const * const config)
+{
+    copyRows(config, sizeof(int8_t));
+}
+
+void copyKernelImpl2B(CopyConfig const * const config)
+{
+    copyRows(config, sizeof(int16_t));
+}
+
 /* All possible options are defined below.
  * Enabled options are defined as `1', disabled are defined as nothing
  * Only one could be enabled simultaneously.
@@ -458,14 +517,13 @@ static GNA::VoidKernel GetXnnKernelHelper(GNA::KernelType type)
         GetKernel(recurrentKernelImpl1B, OPT_ANY),
         GetKernel(recurrentKernelImpl2B, OPT_ANY),
 
-        GetKernel(TransposeKernelImpl1B, OPT_GEN_OR_SAT OPT_AVX2_OR_AVX2_SAT OPT_SSE4_OR_SSE4_SAT),
+        GetKernel(TransposeKernelImpl1B, OPT_ANY),
         GetKernel(TransposeKernelImpl2B, OPT_ANY),
 
         GetKernel(ConvolutionKernelImpl, OPT_ANY),
         GetKernel(ConvolutionPoolingKernelImpl, OPT_ANY),
 
         GetKernel(activationKernelImpl, OPT_ANY),
-        GetKernel(copyKernelImpl, OPT_ANY),
 
         GetKernel(AffineKernelImpl1B1B, OPT_GEN_OR_SAT OPT_AVX2_SAT OPT_SSE4_SAT),
         GetKernel(AffineKernelImpl2B1B, OPT_GEN_OR_SAT OPT_AVX2_SAT OPT_SSE4_SAT),
@@ -479,20 +537,20 @@ static GNA::VoidKernel GetXnnKernelHelper(GNA::KernelType type)
         GetKernel(AffineMultiBiasKernelImpl2B1B, OPT_GEN_OR_SAT OPT_AVX2_SAT OPT_SSE4_SAT),
         GetKernel(AffineMultiBiasKernelImpl1B2B, OPT_GEN_OR_SAT),
         GetKernel(AffineMultiBiasKernelImpl2B2B, OPT_GEN_OR_SAT),
-        GetKernel(DiagonalKernelImpl1B1B, OPT_GEN_OR_SAT),
-        GetKernel(DiagonalKernelImpl2B1B, OPT_GEN_OR_SAT),
-        GetKernel(DiagonalKernelImpl1B2B, OPT_GEN_OR_SAT),
-        GetKernel(DiagonalKernelImpl2B2B, OPT_GEN_OR_SAT),
+        GetKernel(DiagonalKernelImpl1B1B, OPT_ANY),
+        GetKernel(DiagonalKernelImpl2B1B, OPT_ANY),
+        GetKernel(DiagonalKernelImpl1B2B, OPT_ANY),
+        GetKernel(DiagonalKernelImpl2B2B, OPT_ANY),
         GetKernel(recurrentKernelImpl1B1B, OPT_GEN_OR_SAT OPT_AVX2_SAT OPT_SSE4_SAT),
         GetKernel(recurrentKernelImpl2B1B, OPT_GEN_OR_SAT OPT_AVX2_SAT OPT_SSE4_SAT),
         GetKernel(recurrentKernelImpl1B2B, OPT_GEN_OR_SAT),
         GetKernel(recurrentKernelImpl2B2B, OPT_GEN_OR_SAT),
-        GetKernel(ConvolutionKernelImpl1B, OPT_GEN_OR_SAT),
-        GetKernel(ConvolutionPoolingKernelImpl1B, OPT_GEN_OR_SAT),
+        GetKernel(ConvolutionKernelImpl1B, OPT_GEN_OR_SAT OPT_SSE4_SAT OPT_AVX1_SAT OPT_AVX2_SAT),
+        GetKernel(ConvolutionPoolingKernelImpl1B, OPT_GEN_OR_SAT OPT_SSE4_SAT OPT_AVX1_SAT OPT_AVX2_SAT),
         GetKernel(ConvolutionKernelImpl2B, OPT_GEN_OR_SAT),
         GetKernel(ConvolutionPoolingKernelImpl2B, OPT_GEN_OR_SAT),
-        GetKernel(copyKernelImpl1B, OPT_GEN_OR_SAT),
-        GetKernel(copyKernelImpl2B, OPT_GEN_OR_SAT),
+        GetKernel(copyKernelImpl1B, OPT_ANY),
+        GetKernel(copyKernelImpl2B, OPT_ANY),
 
         GetKernel(Convolution2DKernelImpl1B1B, OPT_GEN_OR_SAT OPT_SSE4_SAT OPT_AVX2_SAT),
         GetKernel(Convolution2DKernelImpl1B2B, OPT_GEN_OR_SAT OPT_SSE4_SAT OPT_AVX2_SAT),
@@ -502,6 +560,74 @@ static GNA::VoidKernel GetXnnKernelHelper(GNA::KernelType type)
         GetKernel(Pooling2DKernelImpl1B, OPT_GEN_OR_SAT OPT_SSE4_SAT OPT_AVX2_SAT),
         GetKernel(Pooling2DKernelImpl2B, OPT_GEN_OR_SAT OPT_SSE4_SAT OPT_AVX2_SAT),
         GetKernel(Pooling2DKernelImpl4B, OPT_GEN_OR_SAT OPT_SSE4_SAT OPT_AVX2_SAT),
+
+        GetKernel(AffineLargeBatchKernelImpl1B2B, OPT_ANY),
+        GetKernel(AffineLargeBatchKernelImpl2B2B, OPT_ANY),
+        GetKernel(AffineLargeBatchKernelImpl1B1B, OPT_ANY),
+        GetKernel(AffineLargeBatchKernelImpl2B1B, OPT_ANY),
+
+        GetKernel(AffineKernelImpl4b2B, OPT_ANY),
+        GetKernel(AffineKernelImpl4b1B, OPT_ANY),
+        GetKernel(AffineKernelImplU4b2B, OPT_ANY),
+        GetKernel(AffineKernelImplU4b1B, OPT_ANY),
+
+        GetKernel(AffineActiveListKernelImpl4b2B, OPT_ANY),
+        GetKernel(AffineActiveListKernelImpl4b1B, OPT_ANY),
+        GetKernel(AffineActiveListKernelImplU4b2B, OPT_ANY),
+        GetKernel(AffineActiveListKernelImplU4b1B, OPT_ANY),
+
+        GetKernel(AffineMultiBiasKernelImpl4b2B, OPT_ANY),
+        GetKernel(AffineMultiBiasKernelImpl4b1B, OPT_ANY),
+        GetKernel(AffineMultiBiasKernelImplU4b2B, OPT_ANY),
+        GetKernel(AffineMultiBiasKernelImplU4b1B, OPT_ANY),
+
+        GetKernel(DiagonalKernelImpl4b2B, OPT_ANY),
+        GetKernel(DiagonalKernelImpl4b1B, OPT_ANY),
+        GetKernel(DiagonalKernelImplU4b2B, OPT_ANY),
+        GetKernel(DiagonalKernelImplU4b1B, OPT_ANY),
+
+        GetKernel(AffineRelaxedKernelImpl1B2B, OPT_ANY),
+        GetKernel(AffineRelaxedKernelImpl2B2B, OPT_ANY),
+        GetKernel(AffineRelaxedKernelImpl1B1B, OPT_ANY),
+        GetKernel(AffineRelaxedKernelImpl2B1B, OPT_ANY),
+
+        GetKernel(AffineRelaxedActiveListKernelImpl1B2B, OPT_ANY),
+        GetKernel(AffineRelaxedActiveListKernelImpl2B2B, OPT_ANY),
+        GetKernel(AffineRelaxedActiveListKernelImpl1B1B, OPT_ANY),
+        GetKernel(AffineRelaxedActiveListKernelImpl2B1B, OPT_ANY),
+
+        GetKernel(AffineMultiBiasRelaxedKernelImpl1B2B, OPT_ANY),
+        GetKernel(AffineMultiBiasRelaxedKernelImpl2B2B, OPT_ANY),
+        GetKernel(AffineMultiBiasRelaxedKernelImpl1B1B, OPT_ANY),
+        GetKernel(AffineMultiBiasRelaxedKernelImpl2B1B, OPT_ANY),
+
+        GetKernel(AffineLargeBatchRelaxedKernelImpl1B2B, OPT_ANY),
+        GetKernel(AffineLargeBatchRelaxedKernelImpl2B2B, OPT_ANY),
+        GetKernel(AffineLargeBatchRelaxedKernelImpl1B1B, OPT_ANY),
+        GetKernel(AffineLargeBatchRelaxedKernelImpl2B1B, OPT_ANY),
+
+        GetKernel(RecurrentRelaxedKernelImpl1B2B, OPT_ANY),
+        GetKernel(RecurrentRelaxedKernelImpl2B2B, OPT_ANY),
+        GetKernel(RecurrentRelaxedKernelImpl1B1B, OPT_ANY),
+        GetKernel(RecurrentRelaxedKernelImpl2B1B, OPT_ANY),
+
+        GetKernel(Convolution2D1x1KernelImpl1B1B, OPT_ANY),
+        GetKernel(Convolution2D1x1KernelImpl1B2B, OPT_ANY),
+        GetKernel(Convolution2D1x1KernelImpl2B1B, OPT_ANY),
+        GetKernel(Convolution2D1x1KernelImpl2B2B, OPT_ANY),
+        GetKernel(Convolution2D3x3KernelImpl1B1B, OPT_ANY),
+        GetKernel(Convolution2D3x3KernelImpl1B2B, OPT_ANY),
+        GetKernel(Convolution2D3x3KernelImpl2B1B, OPT_ANY),
+        GetKernel(Convolution2D3x3KernelImpl2B2B, OPT_ANY),
+        GetKernel(Convolution2D3x3Stride2KernelImpl1B1B, OPT_ANY),
+        GetKernel(Convolution2D3x3Stride2KernelImpl1B2B, OPT_ANY),
+        GetKernel(Convolution2D3x3Stride2KernelImpl2B1B, OPT_ANY),
+        GetKernel(Convolution2D3x3Stride2KernelImpl2B2B, OPT_ANY),
+
+        GetKernel(Convolution2DKernelImpl4b1B, OPT_ANY),
+        GetKernel(Convolution2DKernelImpl4b2B, OPT_ANY),
+        GetKernel(Convolution2DKernelImplU4b1B, OPT_ANY),
+        GetKernel(Convolution2DKernelImplU4b2B, OPT_ANY),
     };
     return Kernels[type];
 }
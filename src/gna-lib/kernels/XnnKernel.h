@@ -12,7 +12,9 @@
 
 #include "../gna-api/gna2-inference-impl.h"
 
+#include <initializer_list>
 #include <map>
+#include <utility>
 
 struct ActivationConfig;
 struct AffineConfig;
@@ -31,7 +33,35 @@ namespace GNA
 struct PwlCached;
 
 template<typename KernelType>
-using KernelMap = std::map<AccelerationMode, KernelType>;
+class KernelMap
+{
+public:
+    using Entry = std::pair<const AccelerationMode, KernelType>;
+
+    KernelMap(std::initializer_list<Entry> entries) :
+        kernels{ entries }
+    {
+    }
+
+    void Add(std::initializer_list<Entry> entries)
+    {
+        kernels.insert(entries);
+    }
+
+    // Operations without relaxed kernels fall back to hardware consistent ones
+    const KernelType& Get(const AccelerationMode& accel) const
+    {
+        const auto found = kernels.find(accel);
+        if (found != kernels.end())
+        {
+            return found->second;
+        }
+        return kernels.at(accel.GetConsistent());
+    }
+
+private:
+    std::map<AccelerationMode, KernelType> kernels;
+};
 
 typedef void (*VoidKernel)();
 
@@ -74,7 +104,6 @@ enum KernelType
     convolution,
     convolutionPooling,
     pwl,
-    copy,
     affineSingle1B1Bfull,
     affineSingle2B1Bfull,
     affineSingle1B2Bfull,
@@ -108,6 +137,62 @@ enum KernelType
     convolutionPooling2D1B,
     convolutionPooling2D2B,
     convolutionPooling2D4B,
+    affineLargeBatch1B2B,
+    affineLargeBatch2B2B,
+    affineLargeBatch1B1B,
+    affineLargeBatch2B1B,
+    affineSingle4b2Bfull,
+    affineSingle4b1Bfull,
+    affineSingleU4b2Bfull,
+    affineSingleU4b1Bfull,
+    affineSingle4b2Bal,
+    affineSingle4b1Bal,
+    affineSingleU4b2Bal,
+    affineSingleU4b1Bal,
+    affineMulti4b2B,
+    affineMulti4b1B,
+    affineMultiU4b2B,
+    affineMultiU4b1B,
+    diagonal4b2B,
+    diagonal4b1B,
+    diagonalU4b2B,
+    diagonalU4b1B,
+    affineRelaxed1B2B,
+    affineRelaxed2B2B,
+    affineRelaxed1B1B,
+    affineRelaxed2B1B,
+    affineRelaxedAl1B2B,
+    affineRelaxedAl2B2B,
+    affineRelaxedAl1B1B,
+    affineRelaxedAl2B1B,
+    affineMultiRelaxed1B2B,
+    affineMultiRelaxed2B2B,
+    affineMultiRelaxed1B1B,
+    affineMultiRelaxed2B1B,
+    affineLargeBatchRelaxed1B2B,
+    affineLargeBatchRelaxed2B2B,
+    affineLargeBatchRelaxed1B1B,
+    affineLargeBatchRelaxed2B1B,
+    recurrentRelaxed1B2B,
+    recurrentRelaxed2B2B,
+    recurrentRelaxed1B1B,
+    recurrentRelaxed2B1B,
+    convolution2D1x1_1B1B,
+    convolution2D1x1_1B2B,
+    convolution2D1x1_2B1B,
+    convolution2D1x1_2B2B,
+    convolution2D3x3_1B1B,
+    convolution2D3x3_1B2B,
+    convolution2D3x3_2B1B,
+    convolution2D3x3_2B2B,
+    convolution2D3x3Stride2_1B1B,
+    convolution2D3x3Stride2_1B2B,
+    convolution2D3x3Stride2_2B1B,
+    convolution2D3x3Stride2_2B2B,
+    convolution2D4b1B,
+    convolution2D4b2B,
+    convolution2DU4b1B,
+    convolution2DU4b2B,
 };
 
 template<Gna2AccelerationMode accelerationMode>
@@ -29,3 +29,10 @@ static __forceinline __m256i vec_lddqu(void *ptr)
 {
     return _mm256_lddqu_si256((__m256i*)ptr);
 }
+/** @brief Load VEC_16CAP 8b signed integers sign-extended to 16b */
+static __forceinline __m256i vec_lddqu8(void const *ptr)
+{
+    return _mm256_set_m128i(
+        _mm_cvtepi8_epi16(_mm_loadl_epi64((__m128i const*)((int8_t const*)ptr + 8))),
+        _mm_cvtepi8_epi16(_mm_loadl_epi64((__m128i const*)ptr)));
+}
@@ -18,6 +18,11 @@ static __forceinline __m256i vec_lddqu(void *ptr)
 {
     return _mm256_lddqu_si256((__m256i*)ptr);
 }
+/** @brief Load VEC_16CAP 8b signed integers sign-extended to 16b */
+static __forceinline __m256i vec_lddqu8(void const *ptr)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i const*)ptr));
+}
 static __forceinline __m256i vec_load(void *ptr)
 {
     return _mm256_load_si256((__m256i*)ptr);
@@ -26,6 +26,11 @@ static __forceinline __m128i vec_lddqu(void *ptr)
 {
     return _mm_lddqu_si128((__m128i*)ptr);
 }
+/** @brief Load VEC_16CAP 8b signed integers sign-extended to 16b */
+static __forceinline __m128i vec_lddqu8(void const *ptr)
+{
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64((__m128i const*)ptr));
+}
 static __forceinline __m128i vec_load(void *ptr)
 {
     return _mm_load_si128((__m128i*)ptr);
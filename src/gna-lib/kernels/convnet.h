@@ -26,6 +26,24 @@
 #define Convolution2DKernelImpl2B1B KERNEL(Convolution2DKernelImpl2B1B)
 #define Convolution2DKernelImpl2B2B KERNEL(Convolution2DKernelImpl2B2B)
 
+#define Convolution2DKernelImpl4b1B KERNEL(Convolution2DKernelImpl4b1B)
+#define Convolution2DKernelImpl4b2B KERNEL(Convolution2DKernelImpl4b2B)
+#define Convolution2DKernelImplU4b1B KERNEL(Convolution2DKernelImplU4b1B)
+#define Convolution2DKernelImplU4b2B KERNEL(Convolution2DKernelImplU4b2B)
+
+#define Convolution2D1x1KernelImpl1B1B KERNEL(Convolution2D1x1KernelImpl1B1B)
+#define Convolution2D1x1KernelImpl1B2B KERNEL(Convolution2D1x1KernelImpl1B2B)
+#define Convolution2D1x1KernelImpl2B1B KERNEL(Convolution2D1x1KernelImpl2B1B)
+#define Convolution2D1x1KernelImpl2B2B KERNEL(Convolution2D1x1KernelImpl2B2B)
+#define Convolution2D3x3KernelImpl1B1B KERNEL(Convolution2D3x3KernelImpl1B1B)
+#define Convolution2D3x3KernelImpl1B2B KERNEL(Convolution2D3x3KernelImpl1B2B)
+#define Convolution2D3x3KernelImpl2B1B KERNEL(Convolution2D3x3KernelImpl2B1B)
+#define Convolution2D3x3KernelImpl2B2B KERNEL(Convolution2D3x3KernelImpl2B2B)
+#define Convolution2D3x3Stride2KernelImpl1B1B KERNEL(Convolution2D3x3Stride2KernelImpl1B1B)
+#define Convolution2D3x3Stride2KernelImpl1B2B KERNEL(Convolution2D3x3Stride2KernelImpl1B2B)
+#define Convolution2D3x3Stride2KernelImpl2B1B KERNEL(Convolution2D3x3Stride2KernelImpl2B1B)
+#define Convolution2D3x3Stride2KernelImpl2B2B KERNEL(Convolution2D3x3Stride2KernelImpl2B2B)
+
 #define Pooling2DKernelImpl1B KERNEL(Pooling2DKernelImpl1B)
 #define Pooling2DKernelImpl2B KERNEL(Pooling2DKernelImpl2B)
 #define Pooling2DKernelImpl4B KERNEL(Pooling2DKernelImpl4B)
@@ -39,11 +57,32 @@ void ConvolutionKernelImpl(ConvolutionConfig const * const filterConfig);
 void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
     PoolingConfig const * const poolConfig, PwlCached const * const pwl);
 
+void ConvolutionKernelImpl1B(ConvolutionConfig const * const filterConfig);
+void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig,
+    PoolingConfig const * const poolConfig, PwlCached const * const pwl);
+
+// 2D convolution kernels specialized for filter geometry, used for layers without zero padding
+void Convolution2D1x1KernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D1x1KernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D1x1KernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D1x1KernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D3x3KernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D3x3KernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D3x3KernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D3x3KernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D3x3Stride2KernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D3x3Stride2KernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D3x3Stride2KernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2D3x3Stride2KernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+
+// 2D convolution kernels with signed (4b) or unsigned (U4b) 4-bit filters of software only models
+void Convolution2DKernelImpl4b1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2DKernelImpl4b2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2DKernelImplU4b1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+void Convolution2DKernelImplU4b2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
+
 #if OPT_LEVEL < 2
-    void ConvolutionKernelImpl1B(ConvolutionConfig const * const filterConfig);
     void ConvolutionKernelImpl2B(ConvolutionConfig const * const filterConfig);
-    void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig,
-        PoolingConfig const * const poolConfig, PwlCached const * const pwl);
     void ConvolutionPoolingKernelImpl2B(ConvolutionConfig const * const filterConfig,
         PoolingConfig const * const poolConfig, PwlCached const * const pwl);
     void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
@@ -0,0 +1,234 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+/**
+ * Legacy CNN1D kernels for 1B inputs, shared by SSE4, AVX1 and AVX2 builds.
+ *
+ * Inputs (and 1B filters) are sign-extended to 16 bits while loaded,
+ * thus the same multiply-add and accumulation as in 2B input kernels is used.
+ */
+
+#include "convnet.h"
+#include "pwl.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include <cstdint>
+
+namespace
+{
+
+/** Number of filter outputs convolved with single filter at once */
+constexpr uint32_t OutputGroup = 8;
+
+inline auto loadFilter(int8_t const * const filter)
+{
+    return vec_lddqu8(filter);
+}
+
+inline auto loadFilter(int16_t const * const filter)
+{
+    return vec_lddqu(const_cast<int16_t *>(filter));
+}
+
+/** Calculates biased sums of outputCount consecutive filter outputs of filter i */
+template<typename FilterType, uint32_t outputCount>
+inline void convolve1B(ConvolutionConfig const * const filterConfig, uint32_t const j, uint32_t const i,
+    gna_sum_t * const sums)
+{
+    const uint32_t FC = filterConfig->filterCoefficientCount;
+    const uint32_t FC_VEC = FC - FC % VEC_16CAP;
+    const auto * const I = reinterpret_cast<int8_t const *>(filterConfig->inputs);
+    const auto * const filter = reinterpret_cast<FilterType const *>(filterConfig->filters) + i * FC;
+    const auto bias = getBias(filterConfig->biases, filterConfig->bytesPerBias, i);
+
+    int8_t const * in[outputCount];
+    mm_vector acc[outputCount];
+    for (uint32_t n = 0; n < outputCount; n++)
+    {
+        in[n] = I + (j + n) * filterConfig->inputBandStride;
+        acc[n] = vec_setzero();
+    }
+
+    for (uint32_t k = 0; k < FC_VEC; k += VEC_16CAP)
+    {
+        auto const f = loadFilter(filter + k);
+        for (uint32_t n = 0; n < outputCount; n++)
+        {
+            acc[n] = vec_accumulate(acc[n], vec_madd16(vec_lddqu8(in[n] + k), f));
+        }
+    }
+
+    for (uint32_t n = 0; n < outputCount; n++)
+    {
+        sums[n] = bias + vec_sum(acc[n]);
+        for (uint32_t k = FC_VEC; k < FC; k++)
+        {
+            sums[n] += in[n][k] * filter[k];
+        }
+    }
+}
+
+template<typename FilterType>
+void convolution1B(ConvolutionConfig const * const filterConfig)
+{
+    const uint32_t FN = filterConfig->filterCount;
+    const uint32_t num_filter_outputs = filterConfig->filterOutputCount;
+    int32_t * const O = filterConfig->convolutedOutputs;
+    uint32_t * const saturationCount = filterConfig->execution->SaturationCount;
+    const uint32_t N_VEC = num_filter_outputs - num_filter_outputs % OutputGroup;
+
+    gna_sum_t sums[OutputGroup];
+    uint32_t j;
+    for (j = 0; j < N_VEC; j += OutputGroup)
+    {
+        for (uint32_t i = 0; i < FN; i++)
+        {
+            convolve1B<FilterType, OutputGroup>(filterConfig, j, i, sums);
+            for (uint32_t n = 0; n < OutputGroup; n++)
+            {
+                saturate_store_out(&sums[n], &O[(j + n) * FN + i], saturationCount);
+            }
+        }
+    }
+
+    for (; j < num_filter_outputs; j++)
+    {
+        for (uint32_t i = 0; i < FN; i++)
+        {
+            convolve1B<FilterType, 1>(filterConfig, j, i, sums);
+            saturate_store_out(&sums[0], &O[j * FN + i], saturationCount);
+        }
+    }
+}
+
+template<typename FilterType>
+void convolutionPooling1B(ConvolutionConfig const * const filterConfig,
+    PoolingConfig const * const poolConfig, PwlCached const * const pwl)
+{
+    const uint32_t FN = filterConfig->filterCount;
+    int8_t * const O = reinterpret_cast<int8_t *>(filterConfig->pooledOutputs);
+    uint32_t * const saturationCount = filterConfig->execution->SaturationCount;
+
+    const auto PT = poolConfig->Mode;
+    const uint32_t PS = poolConfig->Size;
+    const uint32_t PSTEP = poolConfig->Step;
+    int64_t * const pool = poolConfig->Buffer;
+
+    if (PS == 0)
+    {
+        return;
+    }
+
+    pwl->KERNEL(InitializeActivationFunctions)();
+
+    void(*func_partial_pooling)(const uint32_t PS, const uint32_t pool_num_entries, const uint32_t pool_start_index, const int64_t *P, int64_t *V);
+
+    if (PT == KernelPoolingModeSum)
+    {
+        func_partial_pooling = SumPartialPoolingFunction;
+    }
+    else
+    {
+        func_partial_pooling = MaxPartialPoolingFunction;
+    }
+
+    uint32_t pool_start_index = 0;
+    uint32_t pool_end_index = 0;
+    int32_t pool_num_entries = 0;
+    uint32_t output_index = 0;
+    uint32_t num_filter_outputs = filterConfig->filterOutputCount;
+    int64_t value;
+    gna_sum_t sum;
+
+    for (uint32_t j = 0; j < num_filter_outputs; )
+    {
+        if (j >= output_index * PSTEP)
+        {
+            const uint32_t inc = (PS - static_cast<uint32_t>(pool_num_entries) < num_filter_outputs - j)
+                ? PS - static_cast<uint32_t>(pool_num_entries)
+                : num_filter_outputs - j;
+
+            for (uint32_t l = 0; l < inc; l++)
+            {
+                for (uint32_t i = 0; i < FN; i++)
+                {
+                    convolve1B<FilterType, 1>(filterConfig, j + l, i, &sum);
+                    pool[i * CNN_POOL_SIZE_MAX + pool_end_index] = sum;
+                }
+
+                pool_end_index = (pool_end_index + 1) % PS;
+            }
+
+            j += inc;
+            pool_num_entries += inc;
+            if (static_cast<uint32_t>(pool_num_entries) == PS)
+            {
+                for (uint32_t i = 0; i < FN; i++)
+                {
+                    func_partial_pooling(PS, PS, 0, pool + i * CNN_POOL_SIZE_MAX, &value);
+                    gna_saturate_cast(value, *saturationCount);
+                    pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
+                }
+
+                pool_start_index = (pool_start_index + PSTEP) % PS;
+                pool_num_entries -= PSTEP;
+                if (pool_num_entries < 0)
+                {
+                    pool_start_index = 0;
+                    pool_end_index = 0;
+                    pool_num_entries = 0;
+                }
+                output_index++;
+            }
+        }
+        else
+        {
+            j++;
+        }
+    }
+
+    while (pool_num_entries > 0)
+    {
+        for (uint32_t i = 0; i < FN; i++)
+        {
+            func_partial_pooling(PS, static_cast<uint32_t>(pool_num_entries), pool_start_index, pool + i * CNN_POOL_SIZE_MAX, &value);
+            gna_saturate_cast(value, *saturationCount);
+            pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
+        }
+
+        pool_start_index = (pool_start_index + PSTEP) % PS;
+        pool_num_entries -= PSTEP;
+        output_index++;
+    }
+}
+
+}
+
+void ConvolutionKernelImpl1B(ConvolutionConfig const * const filterConfig)
+{
+    if (filterConfig->bytesPerFilter == 1)
+    {
+        convolution1B<int8_t>(filterConfig);
+    }
+    else
+    {
+        convolution1B<int16_t>(filterConfig);
+    }
+}
+
+void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig,
+    PoolingConfig const * const poolConfig, PwlCached const * const pwl)
+{
+    if (filterConfig->bytesPerFilter == 1)
+    {
+        convolutionPooling1B<int8_t>(filterConfig, poolConfig, pwl);
+    }
+    else
+    {
+        convolutionPooling1B<int16_t>(filterConfig, poolConfig, pwl);
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "KernelMacros.h"
+
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * Dot products of contiguous filter and input runs used by 2D convolution kernels
+ *
+ * Accelerated variants sum products in 32-bit lanes for at most RunMax steps,
+ * then accumulate lanes in 64 bits, thus results equal scalar 64-bit sums.
+ *
+ * Functions are defined in anonymous namespace, as each kernel library is built for different acceleration.
+ */
+namespace
+{
+
+#if OPT_LEVEL == 3 || OPT_LEVEL == 7
+
+#if OPT_LEVEL == 7
+using Vector = __m256i;
+
+inline Vector loadElements(int8_t const * const values)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(values)));
+}
+
+inline Vector loadElements(int16_t const * const values)
+{
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(values));
+}
+
+inline Vector setZero()
+{
+    return _mm256_setzero_si256();
+}
+
+inline Vector maddAccumulate(Vector const sums, Vector const a, Vector const b)
+{
+    return _mm256_add_epi32(sums, _mm256_madd_epi16(a, b));
+}
+#else
+using Vector = __m128i;
+
+inline Vector loadElements(int8_t const * const values)
+{
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(values)));
+}
+
+inline Vector loadElements(int16_t const * const values)
+{
+    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(values));
+}
+
+inline Vector setZero()
+{
+    return _mm_setzero_si128();
+}
+
+inline Vector maddAccumulate(Vector const sums, Vector const a, Vector const b)
+{
+    return _mm_add_epi32(sums, _mm_madd_epi16(a, b));
+}
+#endif
+
+// Number of elements of single SIMD step
+constexpr uint32_t StepElementCount = sizeof(Vector) / sizeof(int16_t);
+
+// Number of steps summed in 32 bits, pairs of products of narrower than 2B x 2B operands fit in 24 bits
+template<typename FilterType, typename InputType>
+constexpr uint32_t StepRunMax = sizeof(FilterType) == 2 && sizeof(InputType) == 2 ? 1 : 128;
+
+template<typename FilterType, typename InputType, uint32_t RunMax = StepRunMax<FilterType, InputType>>
+inline int64_t sumProducts(FilterType const * const filter, InputType const * const input, uint32_t const count)
+{
+    auto const vectorEnd = count - count % StepElementCount;
+    auto sums = setZero();
+    uint32_t i = 0;
+    while (i < vectorEnd)
+    {
+        auto runSums = setZero();
+        auto const runEnd = (std::min)(vectorEnd, i + RunMax * StepElementCount);
+        for (; i < runEnd; i += StepElementCount)
+        {
+            runSums = maddAccumulate(runSums, loadElements(filter + i), loadElements(input + i));
+        }
+        sums = vec_accumulate(sums, runSums);
+    }
+    auto sum = vec_sum(sums);
+    for (; i < count; i++)
+    {
+        sum += static_cast<int64_t>(filter[i]) * input[i];
+    }
+    return sum;
+}
+
+#else
+
+template<typename FilterType, typename InputType, uint32_t RunMax = 1>
+inline int64_t sumProducts(FilterType const * const filter, InputType const * const input, uint32_t const count)
+{
+    int64_t sum = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        sum += static_cast<int64_t>(filter[i]) * input[i];
+    }
+    return sum;
+}
+
+#endif
+
+}
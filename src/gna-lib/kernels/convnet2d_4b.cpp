@@ -0,0 +1,147 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "convnet.h"
+#include "convnet2d.hpp"
+
+#include "ConvolutionKernelArguments.h"
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include "gna2-common-api.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * 2D convolution kernels with signed (4b) or unsigned (U4b) 4-bit filters
+ *
+ * Each filter is packed separately, element pairs in single byte, lower nibble first, padded to 16B.
+ * Filter is unpacked to 2B elements once, then receptive field of each output is read
+ * as filter height rows of contiguous filter width x depth elements, clipped to zero padding.
+ * Sums are accumulated in 64 bits and saturated once per output,
+ * thus results equal generic kernels for the same filters stored as 1B elements.
+ *
+ * Functions are defined in anonymous namespace, as each kernel library is built for different acceleration.
+ */
+namespace
+{
+
+// Number of steps summed in 32 bits, pairs of products of 4-bit and 2B operands fit in 20 bits
+constexpr uint32_t StepRunMax4b = 1024;
+
+template<bool isSigned>
+void unpackFilter(int16_t * const unpacked, uint8_t const * const packed, uint32_t const count)
+{
+    for (uint32_t k = 0; k < count; k++)
+    {
+        auto const pair = packed[k / 2];
+        auto const nibble = static_cast<int16_t>((k % 2 == 0) ? (pair & 0x0F) : (pair >> 4));
+        unpacked[k] = isSigned ? static_cast<int16_t>((nibble ^ 0x08) - 0x08) : nibble;
+    }
+}
+
+template<typename InputType, bool isSigned>
+void convolution2D4b(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    auto const & transform = config->RequestConfig.Transform;
+    auto const * const inputs = reinterpret_cast<InputType const *>(config->RequestConfig.Inputs);
+    auto const * const filters = reinterpret_cast<uint8_t const *>(transform.FilterData);
+    auto * const outputs = reinterpret_cast<int32_t *>(config->RequestConfig.Outputs);
+
+    auto const depth = transform.InputDepth;
+    auto const inputWidth = transform.InputWidth;
+    auto const inputHeight = transform.InputHeight;
+    auto const filterCount = transform.NumberOfFilters;
+    auto const filterWidth = transform.FilterWidth;
+    auto const filterHeight = transform.FilterHeight;
+    auto const padWidth = transform.ZeroPaddingWidth;
+    auto const padHeight = transform.ZeroPaddingHeight;
+    auto const strideWidth = transform.StrideWidth;
+    auto const strideHeight = transform.StrideHeight;
+
+    auto const inputRowSize = inputWidth * depth;
+    auto const filterRowSize = filterWidth * depth;
+    auto const filterElementCount = filterHeight * filterRowSize;
+    // each filter is padded to 16B
+    auto const filterStride = Gna2RoundUp((filterElementCount + 1) / 2, 16);
+    auto const outputWidth = 1 + (inputWidth + 2 * padWidth - filterWidth) / strideWidth;
+    auto const outputHeight = 1 + (inputHeight + 2 * padHeight - filterHeight) / strideHeight;
+    auto const outputRowFirst = transform.OutputRowFirst;
+    auto const outputRowEnd = transform.GetOutputRowEnd(outputHeight);
+
+    std::vector<int16_t> filter(filterElementCount);
+
+    // filters are outermost, so each filter is unpacked once
+    for (uint32_t f = 0; f < filterCount; f++)
+    {
+        unpackFilter<isSigned>(filter.data(), filters + f * filterStride, filterElementCount);
+
+        for (auto outputRow = outputRowFirst; outputRow < outputRowEnd; outputRow++)
+        {
+            // filter rows overlapping input, window is placed in padded input
+            auto const windowRow = outputRow * strideHeight;
+            auto const rowBegin = (std::min)(filterHeight, padHeight > windowRow ? padHeight - windowRow : 0);
+            auto const rowEnd = (std::min)(filterHeight, inputHeight + padHeight - (std::min)(windowRow, inputHeight + padHeight));
+
+            for (uint32_t outputColumn = 0; outputColumn < outputWidth; outputColumn++)
+            {
+                auto const outputIndex = (outputRow * outputWidth + outputColumn) * filterCount + f;
+                int64_t sum = 0;
+                if (KernelBiasModePerFilter == transform.BiasMode)
+                {
+                    sum = getBias(transform.BiasData, transform.BiasDataMode, f);
+                }
+                else if (KernelBiasModePerStride == transform.BiasMode)
+                {
+                    sum = getBias(transform.BiasData, transform.BiasDataMode, outputIndex);
+                }
+
+                // filter columns overlapping input
+                auto const windowColumn = outputColumn * strideWidth;
+                auto const columnBegin = (std::min)(filterWidth, padWidth > windowColumn ? padWidth - windowColumn : 0);
+                auto const columnEnd = (std::min)(filterWidth,
+                    inputWidth + padWidth - (std::min)(windowColumn, inputWidth + padWidth));
+
+                if (columnBegin < columnEnd)
+                {
+                    auto const runSize = (columnEnd - columnBegin) * depth;
+                    for (auto row = rowBegin; row < rowEnd; row++)
+                    {
+                        auto const * const filterRun = filter.data() + row * filterRowSize + columnBegin * depth;
+                        auto const * const inputRun = inputs + (windowRow + row - padHeight) * inputRowSize
+                            + (windowColumn + columnBegin - padWidth) * depth;
+                        sum += sumProducts<int16_t, InputType, StepRunMax4b>(filterRun, inputRun, runSize);
+                    }
+                }
+                gna_saturate_cast(sum, *config->SaturationCount);
+                outputs[outputIndex - outputRowFirst * outputWidth * filterCount] = static_cast<int32_t>(sum);
+            }
+        }
+    }
+}
+
+}
+
+void Convolution2DKernelImpl4b1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2D4b<int8_t, true>(config);
+}
+
+void Convolution2DKernelImpl4b2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2D4b<int16_t, true>(config);
+}
+
+void Convolution2DKernelImplU4b1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2D4b<int8_t, false>(config);
+}
+
+void Convolution2DKernelImplU4b2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2D4b<int16_t, false>(config);
+}
@@ -0,0 +1,171 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "convnet.h"
+#include "convnet2d.hpp"
+
+#include "ConvolutionKernelArguments.h"
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include "gna2-common-api.h"
+
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * 2D convolution kernels specialized for common filter geometries without zero padding
+ *
+ * Filter size, stride, bias mode and bias width are template parameters,
+ * so inner loops carry no padding bounds nor bias selection.
+ * Kernels are selected when layer is built, other geometries use generic 2D convolution kernels.
+ * Receptive field of each output is read as filter size rows of contiguous filter width x depth elements.
+ * Sums are accumulated in 64 bits and saturated once per output, thus results equal generic kernels.
+ *
+ * Functions are defined in anonymous namespace, as each kernel library is built for different acceleration.
+ */
+namespace
+{
+
+template<typename FilterType, typename InputType, uint32_t FilterSize, uint32_t Stride,
+    KernelBiasMode BiasMode, typename BiasType>
+void convolveFixed(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    auto const & transform = config->RequestConfig.Transform;
+    auto const * const inputs = reinterpret_cast<InputType const *>(config->RequestConfig.Inputs);
+    auto const * const filters = reinterpret_cast<FilterType const *>(transform.FilterData);
+    auto const * const biases = reinterpret_cast<BiasType const *>(transform.BiasData);
+    auto * output = reinterpret_cast<int32_t *>(config->RequestConfig.Outputs);
+
+    auto const depth = transform.InputDepth;
+    auto const filterCount = transform.NumberOfFilters;
+    auto const inputRowSize = transform.InputWidth * depth;
+    auto const rowSize = FilterSize * depth;
+    // each filter is padded to 16B
+    constexpr auto filterElementSize = static_cast<uint32_t>(sizeof(FilterType));
+    auto const filterStride = Gna2RoundUp(FilterSize * rowSize * filterElementSize, 16) / filterElementSize;
+    auto const outputWidth = 1 + (transform.InputWidth - FilterSize) / Stride;
+    auto const outputHeight = 1 + (transform.InputHeight - FilterSize) / Stride;
+    auto const outputRowEnd = transform.GetOutputRowEnd(outputHeight);
+
+    // filters are innermost, so input window is reused by all filters and outputs are stored in order
+    for (auto outputRow = transform.OutputRowFirst; outputRow < outputRowEnd; outputRow++)
+    {
+        for (uint32_t outputColumn = 0; outputColumn < outputWidth; outputColumn++)
+        {
+            auto const * const window = inputs + outputRow * Stride * inputRowSize + outputColumn * Stride * depth;
+            auto const strideBiasIndex = (outputRow * outputWidth + outputColumn) * filterCount;
+            auto const * filter = filters;
+            for (uint32_t f = 0; f < filterCount; f++, filter += filterStride)
+            {
+                int64_t sum = 0;
+                if (KernelBiasModePerFilter == BiasMode)
+                {
+                    sum = biases[f];
+                }
+                else if (KernelBiasModePerStride == BiasMode)
+                {
+                    sum = biases[strideBiasIndex + f];
+                }
+                for (uint32_t row = 0; row < FilterSize; row++)
+                {
+                    sum += sumProducts(filter + row * rowSize, window + row * inputRowSize, rowSize);
+                }
+                gna_saturate_cast(sum, *config->SaturationCount);
+                *output++ = static_cast<int32_t>(sum);
+            }
+        }
+    }
+}
+
+template<typename FilterType, typename InputType, uint32_t FilterSize, uint32_t Stride, KernelBiasMode BiasMode>
+void convolveFixedWithBias(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    switch (config->RequestConfig.Transform.BiasDataMode)
+    {
+    case 1:
+        return convolveFixed<FilterType, InputType, FilterSize, Stride, BiasMode, int8_t>(config);
+    case 2:
+        return convolveFixed<FilterType, InputType, FilterSize, Stride, BiasMode, int16_t>(config);
+    default:
+        return convolveFixed<FilterType, InputType, FilterSize, Stride, BiasMode, int32_t>(config);
+    }
+}
+
+template<typename FilterType, typename InputType, uint32_t FilterSize, uint32_t Stride>
+void convolution2DFixed(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    switch (config->RequestConfig.Transform.BiasMode)
+    {
+    case KernelBiasModePerFilter:
+        return convolveFixedWithBias<FilterType, InputType, FilterSize, Stride, KernelBiasModePerFilter>(config);
+    case KernelBiasModePerStride:
+        return convolveFixedWithBias<FilterType, InputType, FilterSize, Stride, KernelBiasModePerStride>(config);
+    default:
+        return convolveFixed<FilterType, InputType, FilterSize, Stride, KernelBiasModeDisabled, int8_t>(config);
+    }
+}
+
+}
+
+void Convolution2D1x1KernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int8_t, int8_t, 1, 1>(config);
+}
+
+void Convolution2D1x1KernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int8_t, int16_t, 1, 1>(config);
+}
+
+void Convolution2D1x1KernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int16_t, int8_t, 1, 1>(config);
+}
+
+void Convolution2D1x1KernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int16_t, int16_t, 1, 1>(config);
+}
+
+void Convolution2D3x3KernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int8_t, int8_t, 3, 1>(config);
+}
+
+void Convolution2D3x3KernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int8_t, int16_t, 3, 1>(config);
+}
+
+void Convolution2D3x3KernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int16_t, int8_t, 3, 1>(config);
+}
+
+void Convolution2D3x3KernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int16_t, int16_t, 3, 1>(config);
+}
+
+void Convolution2D3x3Stride2KernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int8_t, int8_t, 3, 2>(config);
+}
+
+void Convolution2D3x3Stride2KernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int8_t, int16_t, 3, 2>(config);
+}
+
+void Convolution2D3x3Stride2KernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int16_t, int8_t, 3, 2>(config);
+}
+
+void Convolution2D3x3Stride2KernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2DFixed<int16_t, int16_t, 3, 2>(config);
+}
@@ -191,14 +191,14 @@ void ConvolutionKernelImpl(ConvolutionConfig const * const filterConfig)
                 s7 = _mm_madd_epi16(s7, sf);
                 s8 = _mm_madd_epi16(s8, sf);
 
-                sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
-                sum4 += _mm_extract_epi32(s4, 0) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
-                sum5 += _mm_extract_epi32(s5, 0) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
-                sum6 += _mm_extract_epi32(s6, 0) + _mm_extract_epi32(s6, 1) + _mm_extract_epi32(s6, 2) + _mm_extract_epi32(s6, 3);
-                sum7 += _mm_extract_epi32(s7, 0) + _mm_extract_epi32(s7, 1) + _mm_extract_epi32(s7, 2) + _mm_extract_epi32(s7, 3);
-                sum8 += _mm_extract_epi32(s8, 0) + _mm_extract_epi32(s8, 1) + _mm_extract_epi32(s8, 2) + _mm_extract_epi32(s8, 3);
+                sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                sum4 += static_cast<int64_t>(_mm_extract_epi32(s4, 0)) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
+                sum5 += static_cast<int64_t>(_mm_extract_epi32(s5, 0)) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
+                sum6 += static_cast<int64_t>(_mm_extract_epi32(s6, 0)) + _mm_extract_epi32(s6, 1) + _mm_extract_epi32(s6, 2) + _mm_extract_epi32(s6, 3);
+                sum7 += static_cast<int64_t>(_mm_extract_epi32(s7, 0)) + _mm_extract_epi32(s7, 1) + _mm_extract_epi32(s7, 2) + _mm_extract_epi32(s7, 3);
+                sum8 += static_cast<int64_t>(_mm_extract_epi32(s8, 0)) + _mm_extract_epi32(s8, 1) + _mm_extract_epi32(s8, 2) + _mm_extract_epi32(s8, 3);
             }
 
             saturate_store_out(&sum1, out1, saturationCount);
@@ -257,7 +257,7 @@ void ConvolutionKernelImpl(ConvolutionConfig const * const filterConfig)
                 __m128i sf = _mm256_castsi256_si128(f);
 
                 s1 = _mm_madd_epi16(s1, sf);
-                sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
             }
             saturate_store_out(&sum1, out1++, saturationCount);
         }
@@ -417,12 +417,12 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s5 = _mm_madd_epi16(s5, sf);
                         s6 = _mm_madd_epi16(s6, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                        sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
-                        sum4 += _mm_extract_epi32(s4, 0) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
-                        sum5 += _mm_extract_epi32(s5, 0) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
-                        sum6 += _mm_extract_epi32(s6, 0) + _mm_extract_epi32(s6, 1) + _mm_extract_epi32(s6, 2) + _mm_extract_epi32(s6, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                        sum4 += static_cast<int64_t>(_mm_extract_epi32(s4, 0)) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
+                        sum5 += static_cast<int64_t>(_mm_extract_epi32(s5, 0)) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
+                        sum6 += static_cast<int64_t>(_mm_extract_epi32(s6, 0)) + _mm_extract_epi32(s6, 1) + _mm_extract_epi32(s6, 2) + _mm_extract_epi32(s6, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -516,11 +516,11 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s4 = _mm_madd_epi16(s4, sf);
                         s5 = _mm_madd_epi16(s5, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                        sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
-                        sum4 += _mm_extract_epi32(s4, 0) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
-                        sum5 += _mm_extract_epi32(s5, 0) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                        sum4 += static_cast<int64_t>(_mm_extract_epi32(s4, 0)) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
+                        sum5 += static_cast<int64_t>(_mm_extract_epi32(s5, 0)) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -601,10 +601,10 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s3 = _mm_madd_epi16(s3, sf);
                         s4 = _mm_madd_epi16(s4, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                        sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
-                        sum4 += _mm_extract_epi32(s4, 0) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                        sum4 += static_cast<int64_t>(_mm_extract_epi32(s4, 0)) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -673,9 +673,9 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s2 = _mm_madd_epi16(s2, sf);
                         s3 = _mm_madd_epi16(s3, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                        sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -732,8 +732,8 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s1 = _mm_madd_epi16(s1, sf);
                         s2 = _mm_madd_epi16(s2, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -778,7 +778,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
 
                         s1 = _mm_madd_epi16(s1, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
                     }
 
                     sum1 += vec_sum(acc1);
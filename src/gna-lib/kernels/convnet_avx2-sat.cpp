@@ -193,14 +193,14 @@ void ConvolutionKernelImpl(ConvolutionConfig const * const filterConfig)
                 s7 = _mm_madd_epi16(s7, sf);
                 s8 = _mm_madd_epi16(s8, sf);
 
-                sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
-                sum4 += _mm_extract_epi32(s4, 0) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
-                sum5 += _mm_extract_epi32(s5, 0) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
-                sum6 += _mm_extract_epi32(s6, 0) + _mm_extract_epi32(s6, 1) + _mm_extract_epi32(s6, 2) + _mm_extract_epi32(s6, 3);
-                sum7 += _mm_extract_epi32(s7, 0) + _mm_extract_epi32(s7, 1) + _mm_extract_epi32(s7, 2) + _mm_extract_epi32(s7, 3);
-                sum8 += _mm_extract_epi32(s8, 0) + _mm_extract_epi32(s8, 1) + _mm_extract_epi32(s8, 2) + _mm_extract_epi32(s8, 3);
+                sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                sum4 += static_cast<int64_t>(_mm_extract_epi32(s4, 0)) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
+                sum5 += static_cast<int64_t>(_mm_extract_epi32(s5, 0)) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
+                sum6 += static_cast<int64_t>(_mm_extract_epi32(s6, 0)) + _mm_extract_epi32(s6, 1) + _mm_extract_epi32(s6, 2) + _mm_extract_epi32(s6, 3);
+                sum7 += static_cast<int64_t>(_mm_extract_epi32(s7, 0)) + _mm_extract_epi32(s7, 1) + _mm_extract_epi32(s7, 2) + _mm_extract_epi32(s7, 3);
+                sum8 += static_cast<int64_t>(_mm_extract_epi32(s8, 0)) + _mm_extract_epi32(s8, 1) + _mm_extract_epi32(s8, 2) + _mm_extract_epi32(s8, 3);
             }
 
             saturate_store_out(&sum1, out1, saturationCount);
@@ -259,7 +259,7 @@ void ConvolutionKernelImpl(ConvolutionConfig const * const filterConfig)
                 __m128i sf = _mm256_castsi256_si128(f);
 
                 s1 = _mm_madd_epi16(s1, sf);
-                sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
             }
 
             saturate_store_out(&sum1, out1++, saturationCount);
@@ -420,12 +420,12 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s5 = _mm_madd_epi16(s5, sf);
                         s6 = _mm_madd_epi16(s6, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                        sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
-                        sum4 += _mm_extract_epi32(s4, 0) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
-                        sum5 += _mm_extract_epi32(s5, 0) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
-                        sum6 += _mm_extract_epi32(s6, 0) + _mm_extract_epi32(s6, 1) + _mm_extract_epi32(s6, 2) + _mm_extract_epi32(s6, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                        sum4 += static_cast<int64_t>(_mm_extract_epi32(s4, 0)) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
+                        sum5 += static_cast<int64_t>(_mm_extract_epi32(s5, 0)) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
+                        sum6 += static_cast<int64_t>(_mm_extract_epi32(s6, 0)) + _mm_extract_epi32(s6, 1) + _mm_extract_epi32(s6, 2) + _mm_extract_epi32(s6, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -519,11 +519,11 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s4 = _mm_madd_epi16(s4, sf);
                         s5 = _mm_madd_epi16(s5, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                        sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
-                        sum4 += _mm_extract_epi32(s4, 0) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
-                        sum5 += _mm_extract_epi32(s5, 0) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                        sum4 += static_cast<int64_t>(_mm_extract_epi32(s4, 0)) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
+                        sum5 += static_cast<int64_t>(_mm_extract_epi32(s5, 0)) + _mm_extract_epi32(s5, 1) + _mm_extract_epi32(s5, 2) + _mm_extract_epi32(s5, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -604,10 +604,10 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s3 = _mm_madd_epi16(s3, sf);
                         s4 = _mm_madd_epi16(s4, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                        sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
-                        sum4 += _mm_extract_epi32(s4, 0) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                        sum4 += static_cast<int64_t>(_mm_extract_epi32(s4, 0)) + _mm_extract_epi32(s4, 1) + _mm_extract_epi32(s4, 2) + _mm_extract_epi32(s4, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -676,9 +676,9 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s2 = _mm_madd_epi16(s2, sf);
                         s3 = _mm_madd_epi16(s3, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
-                        sum3 += _mm_extract_epi32(s3, 0) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum3 += static_cast<int64_t>(_mm_extract_epi32(s3, 0)) + _mm_extract_epi32(s3, 1) + _mm_extract_epi32(s3, 2) + _mm_extract_epi32(s3, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -735,8 +735,8 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                         s1 = _mm_madd_epi16(s1, sf);
                         s2 = _mm_madd_epi16(s2, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
-                        sum2 += _mm_extract_epi32(s2, 0) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum2 += static_cast<int64_t>(_mm_extract_epi32(s2, 0)) + _mm_extract_epi32(s2, 1) + _mm_extract_epi32(s2, 2) + _mm_extract_epi32(s2, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -781,7 +781,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
 
                         s1 = _mm_madd_epi16(s1, sf);
 
-                        sum1 += _mm_extract_epi32(s1, 0) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
+                        sum1 += static_cast<int64_t>(_mm_extract_epi32(s1, 0)) + _mm_extract_epi32(s1, 1) + _mm_extract_epi32(s1, 2) + _mm_extract_epi32(s1, 3);
                     }
 
                     sum1 += vec_sum(acc1);
@@ -933,6 +933,8 @@ static void cnn2d(ExecutionKernelConfig<ConvolutionConfig2D> const * const confi
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
     uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t outRowFirst = conf.Transform.OutputRowFirst;
+    uint32_t outRowEnd = conf.Transform.GetOutputRowEnd(outHeight);
 
     auto biasMode = conf.Transform.BiasMode;
     auto biasPrecission = conf.Transform.BiasDataMode;
@@ -950,7 +952,7 @@ static void cnn2d(ExecutionKernelConfig<ConvolutionConfig2D> const * const confi
     for (uint32_t OD = 0; OD < numFilters; OD++) {
         uint32_t fIdxN = (OD * (inputDepth * filterWidth * filterHeight + filterPadding));
 
-        for (uint32_t OH = 0; OH < outHeight; OH++) {
+        for (uint32_t OH = outRowFirst; OH < outRowEnd; OH++) {
             for (uint32_t OW = 0; OW < outWidth; OW++) {
 
                 int64_t outVal;
@@ -1020,7 +1022,7 @@ static void cnn2d(ExecutionKernelConfig<ConvolutionConfig2D> const * const confi
                 acc_0 = _mm256_add_epi64(acc_0, acc_2);
                 outVal += _mm256_hsum_epi64(acc_0);
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[numFilters * outWidth * OH + numFilters * OW + OD] = (int32_t)outVal;
+                O[numFilters * outWidth * (OH - outRowFirst) + numFilters * OW + OD] = (int32_t)outVal;
             }
         }
     }
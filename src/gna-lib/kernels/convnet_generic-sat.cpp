@@ -919,6 +919,8 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
     uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t outRowFirst = config->RequestConfig.Transform.OutputRowFirst;
+    uint32_t outRowEnd = config->RequestConfig.Transform.GetOutputRowEnd(outHeight);
 
     for (uint32_t OD = 0; OD < numFilters; OD++)
     { //Output depth or #filters
@@ -927,7 +929,7 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
         for (uint32_t OW = 0; OW < outWidth; OW++)
         { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++)
+            for (uint32_t OH = outRowFirst; OH < outRowEnd; OH++)
             {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
@@ -970,7 +972,7 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                 }
 
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - outRowFirst) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -1009,6 +1011,8 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
     uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t outRowFirst = config->RequestConfig.Transform.OutputRowFirst;
+    uint32_t outRowEnd = config->RequestConfig.Transform.GetOutputRowEnd(outHeight);
 
     for (uint32_t OD = 0; OD < numFilters; OD++)
     { //Output depth or #filters
@@ -1017,7 +1021,7 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
         for (uint32_t OW = 0; OW < outWidth; OW++)
         { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++)
+            for (uint32_t OH = outRowFirst; OH < outRowEnd; OH++)
             {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
@@ -1061,7 +1065,7 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                 }
 
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - outRowFirst) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -1100,6 +1104,8 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
     uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t outRowFirst = config->RequestConfig.Transform.OutputRowFirst;
+    uint32_t outRowEnd = config->RequestConfig.Transform.GetOutputRowEnd(outHeight);
 
     for (uint32_t OD = 0; OD < numFilters; OD++)
     { //Output depth or #filters
@@ -1108,7 +1114,7 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
         for (uint32_t OW = 0; OW < outWidth; OW++)
         { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++)
+            for (uint32_t OH = outRowFirst; OH < outRowEnd; OH++)
             {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
@@ -1151,7 +1157,7 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                 }
 
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - outRowFirst) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -1191,6 +1197,8 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
     uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t outRowFirst = config->RequestConfig.Transform.OutputRowFirst;
+    uint32_t outRowEnd = config->RequestConfig.Transform.GetOutputRowEnd(outHeight);
 
     for (uint32_t OD = 0; OD < numFilters; OD++)
     { //Output depth or #filters
@@ -1199,7 +1207,7 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
         for (uint32_t OW = 0; OW < outWidth; OW++)
         { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++)
+            for (uint32_t OH = outRowFirst; OH < outRowEnd; OH++)
             {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
@@ -1243,7 +1251,7 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                 }
 
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - outRowFirst) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
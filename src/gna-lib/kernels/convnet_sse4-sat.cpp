@@ -787,6 +787,8 @@ static void cnn2d(ExecutionKernelConfig<ConvolutionConfig2D> const * const confi
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
     uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t outRowFirst = conf.Transform.OutputRowFirst;
+    uint32_t outRowEnd = conf.Transform.GetOutputRowEnd(outHeight);
 
     auto biasMode = conf.Transform.BiasMode;
     auto biasPrecission = conf.Transform.BiasDataMode;
@@ -804,7 +806,7 @@ static void cnn2d(ExecutionKernelConfig<ConvolutionConfig2D> const * const confi
     for (uint32_t OD = 0; OD < numFilters; OD++) {
         uint32_t fIdxN = (OD * (inputDepth * filterWidth * filterHeight + filterPadding));
 
-        for (uint32_t OH = 0; OH < outHeight; OH++) {
+        for (uint32_t OH = outRowFirst; OH < outRowEnd; OH++) {
             for (uint32_t OW = 0; OW < outWidth; OW++) {
 
                 int64_t outVal;
@@ -872,7 +874,7 @@ static void cnn2d(ExecutionKernelConfig<ConvolutionConfig2D> const * const confi
                 acc_0 = _mm_add_epi64(acc_0, acc_2);
                 outVal += _mm_hsum_epi64(acc_0);
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[numFilters * outWidth * OH + numFilters * OW + OD] = (int32_t)outVal;
+                O[numFilters * outWidth * (OH - outRowFirst) + numFilters * OW + OD] = (int32_t)outVal;
             }
         }
     }
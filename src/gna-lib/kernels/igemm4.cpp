@@ -0,0 +1,405 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "igemv4.h"
+#include "saturate.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+
+// Number of weights unpacked at once, products of 4-bit weights and 2B inputs summed in 32 bits do not overflow
+constexpr uint32_t WeightRunMax = 512;
+
+enum class BiasKind
+{
+    Simple,
+    Compound,
+    Multi,
+};
+
+template<bool isSigned>
+inline int16_t getWeight(uint8_t const * const weights, uint32_t const k)
+{
+    auto const packed = weights[k / 2];
+    auto const nibble = static_cast<int16_t>((k % 2 == 0) ? (packed & 0x0F) : (packed >> 4));
+    return isSigned ? static_cast<int16_t>((nibble ^ 0x08) - 0x08) : nibble;
+}
+
+// Bias and multiplier of output row, multiplier is used only with 2B inputs as for 1B weights
+template<typename InputType, BiasKind biasKind>
+inline void getBiasAndMultiplier(AffineConfig const & transform, uint32_t const i, int64_t & bias, int64_t & multiplier)
+{
+    multiplier = 1;
+    switch (biasKind)
+    {
+    case BiasKind::Compound:
+        bias = transform.biasesCompound[i].Bias;
+        multiplier = transform.biasesCompound[i].Multiplier;
+        break;
+    case BiasKind::Multi:
+        bias = getBias(transform.multiBias, transform.bytesPerBias, i * transform.multiBiasVectorCount);
+        if (sizeof(InputType) == 2)
+        {
+            multiplier = transform.weightScaleFactors[i].Multiplier;
+        }
+        break;
+    default:
+        bias = getBias(transform.biasesSimple, transform.bytesPerBias, i);
+        break;
+    }
+}
+
+#if OPT_LEVEL > 1
+// Unpacks 16 bytes of weight pairs to 32 signed bytes, in order of weights
+template<bool isSigned>
+inline void unpackNibbles(uint8_t const * const packed, __m128i & first, __m128i & second)
+{
+    auto const mask = _mm_set1_epi8(0x0F);
+    auto const pairs = _mm_loadu_si128(reinterpret_cast<__m128i const *>(packed));
+    auto low = _mm_and_si128(pairs, mask);
+    auto high = _mm_and_si128(_mm_srli_epi16(pairs, 4), mask);
+    if (isSigned)
+    {
+        auto const signBit = _mm_set1_epi8(0x08);
+        low = _mm_sub_epi8(_mm_xor_si128(low, signBit), signBit);
+        high = _mm_sub_epi8(_mm_xor_si128(high, signBit), signBit);
+    }
+    first = _mm_unpacklo_epi8(low, high);
+    second = _mm_unpackhi_epi8(low, high);
+}
+
+#if OPT_LEVEL == 6 || OPT_LEVEL == 7
+using Vector = __m256i;
+
+constexpr uint32_t VectorElementCount = 16;
+
+inline void storeWeights(int16_t * const weights, __m128i const bytes)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(weights), _mm256_cvtepi8_epi16(bytes));
+}
+
+inline Vector loadInputs(int16_t const * const input)
+{
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input));
+}
+
+inline Vector loadInputs(int8_t const * const input)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(input)));
+}
+
+inline Vector loadWeights(int16_t const * const weights)
+{
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(weights));
+}
+
+inline Vector setZero()
+{
+    return _mm256_setzero_si256();
+}
+
+inline Vector maddAdd(Vector const sum, Vector const a, Vector const b)
+{
+    return _mm256_add_epi32(sum, _mm256_madd_epi16(a, b));
+}
+
+inline int32_t sumAll(Vector const sum)
+{
+    return _mm256_hsum_epi32(sum);
+}
+#else
+using Vector = __m128i;
+
+constexpr uint32_t VectorElementCount = 8;
+
+inline void storeWeights(int16_t * const weights, __m128i const bytes)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(weights), _mm_cvtepi8_epi16(bytes));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(weights + 8), _mm_cvtepi8_epi16(_mm_srli_si128(bytes, 8)));
+}
+
+inline Vector loadInputs(int16_t const * const input)
+{
+    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(input));
+}
+
+inline Vector loadInputs(int8_t const * const input)
+{
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(input)));
+}
+
+inline Vector loadWeights(int16_t const * const weights)
+{
+    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(weights));
+}
+
+inline Vector setZero()
+{
+    return _mm_setzero_si128();
+}
+
+inline Vector maddAdd(Vector const sum, Vector const a, Vector const b)
+{
+    return _mm_add_epi32(sum, _mm_madd_epi16(a, b));
+}
+
+inline int32_t sumAll(Vector const sum)
+{
+    auto const pairs = _mm_add_epi32(sum, _mm_unpackhi_epi64(sum, sum));
+    return _mm_cvtsi128_si32(_mm_add_epi32(pairs, _mm_shuffle_epi32(pairs, 1)));
+}
+#endif
+#endif
+
+// Unpacks weights [kBegin, kEnd) of packed weight row to 2B weights
+template<bool isSigned>
+inline void unpackWeights(int16_t * weights, uint8_t const * const weightRow,
+    uint32_t const kBegin, uint32_t const kEnd)
+{
+    auto k = kBegin;
+#if OPT_LEVEL > 1
+    if (k % 2 != 0 && k < kEnd)
+    {
+        *weights++ = getWeight<isSigned>(weightRow, k++);
+    }
+    for (; k + 32 <= kEnd; k += 32, weights += 32)
+    {
+        __m128i first;
+        __m128i second;
+        unpackNibbles<isSigned>(weightRow + k / 2, first, second);
+        storeWeights(weights, first);
+        storeWeights(weights + 16, second);
+    }
+#endif
+    for (; k < kEnd; k++)
+    {
+        *weights++ = getWeight<isSigned>(weightRow, k);
+    }
+}
+
+template<typename InputType>
+inline int64_t sumProducts(int16_t const * const weights, InputType const * const input, uint32_t const count)
+{
+    uint32_t k = 0;
+    int32_t sum = 0;
+#if OPT_LEVEL > 1
+    auto sums = setZero();
+    for (; k + VectorElementCount <= count; k += VectorElementCount)
+    {
+        sums = maddAdd(sums, loadWeights(weights + k), loadInputs(input + k));
+    }
+    sum = sumAll(sums);
+#endif
+    for (; k < count; k++)
+    {
+        sum += weights[k] * input[k];
+    }
+    return sum;
+}
+
+// Deinterleaves group of input vectors to flat [groupSize;K] buffer
+template<typename InputType>
+inline void deinterleave(InputType * const flat, InputType const * const input,
+    uint32_t const inputElementCount, uint32_t const inputVectorCount,
+    uint32_t const groupBegin, uint32_t const groupSize)
+{
+    for (uint32_t k = 0; k < inputElementCount; k++)
+    {
+        auto const * const inputRow = input + k * inputVectorCount + groupBegin;
+        for (uint32_t j = 0; j < groupSize; j++)
+        {
+            flat[j * inputElementCount + k] = inputRow[j];
+        }
+    }
+}
+
+// Calculates rows of affine transform, for all rows when indices are not provided,
+// output row l is written for l-th row
+template<typename InputType, bool isSigned, BiasKind biasKind>
+void affine4b(ExecutionKernelConfig<AffineConfig> const * const config,
+    uint32_t const * const indices, uint32_t const rowCount)
+{
+    auto const & transform = config->RequestConfig.Transform;
+    auto const inputVectorCount = transform.inputVectorCount;
+    auto const inputElementCount = transform.inputElementCount;
+    auto const * const input = reinterpret_cast<InputType const *>(config->RequestConfig.Inputs);
+    auto * const output = reinterpret_cast<int32_t *>(config->RequestConfig.Outputs);
+    auto * const flatInput = reinterpret_cast<InputType *>(config->Intermediate->d0);
+    auto const bufferOffset = sizeof(InputType) == 2 ? XNN_N_GROUP_MAX : 0;
+
+    int16_t weights[WeightRunMax];
+    int64_t sums[XNN_N_GROUP_MAX];
+
+    for (uint32_t groupBegin = 0; groupBegin < inputVectorCount; groupBegin += XNN_N_GROUP_MAX)
+    {
+        auto const groupSize = (std::min)(XNN_N_GROUP_MAX, inputVectorCount - groupBegin);
+        auto const kpartial = config->BufferElementCount[groupSize - 1 + bufferOffset] / groupSize;
+        deinterleave(flatInput, input, inputElementCount, inputVectorCount, groupBegin, groupSize);
+
+        for (uint32_t l = 0; l < rowCount; l++)
+        {
+            auto const i = (nullptr != indices) ? indices[l] : l;
+            auto const * const weightRow = transform.weights4B + i * inputElementCount / 2;
+            int64_t bias;
+            int64_t multiplier;
+            getBiasAndMultiplier<InputType, biasKind>(transform, i, bias, multiplier);
+            std::fill_n(sums, groupSize, bias);
+
+            // saturation after each kpartial elements as in hardware buffer grouping
+            for (uint32_t kBegin = 0; kBegin < inputElementCount; kBegin += kpartial)
+            {
+                auto const kEnd = (std::min)(kBegin + kpartial, inputElementCount);
+                for (auto runBegin = kBegin; runBegin < kEnd; runBegin += WeightRunMax)
+                {
+                    auto const runEnd = (std::min)(runBegin + WeightRunMax, kEnd);
+                    unpackWeights<isSigned>(weights, weightRow, runBegin, runEnd);
+                    for (uint32_t j = 0; j < groupSize; j++)
+                    {
+                        sums[j] += multiplier * sumProducts(weights,
+                            flatInput + j * inputElementCount + runBegin, runEnd - runBegin);
+                    }
+                }
+                for (uint32_t j = 0; j < groupSize; j++)
+                {
+                    saturate(&sums[j], config->SaturationCount);
+                }
+            }
+
+            std::copy_n(sums, groupSize, output + l * inputVectorCount + groupBegin);
+        }
+    }
+}
+
+template<typename InputType, bool isSigned>
+void affine4bKernel(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4b<InputType, isSigned, sizeof(InputType) == 2 ? BiasKind::Compound : BiasKind::Simple>(
+        config, nullptr, config->RequestConfig.Transform.outputElementCount);
+}
+
+template<typename InputType, bool isSigned>
+void affine4bActiveListKernel(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl const & al)
+{
+    affine4b<InputType, isSigned, sizeof(InputType) == 2 ? BiasKind::Compound : BiasKind::Simple>(
+        config, al.indices, al.count);
+}
+
+template<typename InputType, bool isSigned>
+void affine4bMultiBiasKernel(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4b<InputType, isSigned, BiasKind::Multi>(
+        config, nullptr, config->RequestConfig.Transform.outputElementCount);
+}
+
+template<typename InputType, bool isSigned>
+void diagonal4bKernel(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    auto const & transform = config->RequestConfig.Transform;
+    auto const inputVectorCount = transform.inputVectorCount;
+    auto const * const input = reinterpret_cast<InputType const *>(config->RequestConfig.Inputs);
+    auto * const output = reinterpret_cast<int32_t *>(config->RequestConfig.Outputs);
+
+    for (uint32_t i = 0; i < transform.outputElementCount; i++)
+    {
+        int64_t bias;
+        int64_t multiplier;
+        getBiasAndMultiplier<InputType, sizeof(InputType) == 2 ? BiasKind::Compound : BiasKind::Simple>(
+            transform, i, bias, multiplier);
+        auto const weightValue = multiplier * getWeight<isSigned>(transform.weights4B, i);
+        for (uint32_t j = 0; j < inputVectorCount; j++)
+        {
+            auto sum = bias + weightValue * input[i * inputVectorCount + j];
+            saturate_store_out(&sum, &output[i * inputVectorCount + j], config->SaturationCount);
+        }
+    }
+}
+
+}
+
+void AffineKernelImpl4b2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4bKernel<int16_t, true>(config);
+}
+
+void AffineKernelImpl4b1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4bKernel<int8_t, true>(config);
+}
+
+void AffineKernelImplU4b2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4bKernel<int16_t, false>(config);
+}
+
+void AffineKernelImplU4b1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4bKernel<int8_t, false>(config);
+}
+
+void AffineActiveListKernelImpl4b2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affine4bActiveListKernel<int16_t, true>(config, al);
+}
+
+void AffineActiveListKernelImpl4b1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affine4bActiveListKernel<int8_t, true>(config, al);
+}
+
+void AffineActiveListKernelImplU4b2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affine4bActiveListKernel<int16_t, false>(config, al);
+}
+
+void AffineActiveListKernelImplU4b1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affine4bActiveListKernel<int8_t, false>(config, al);
+}
+
+void AffineMultiBiasKernelImpl4b2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4bMultiBiasKernel<int16_t, true>(config);
+}
+
+void AffineMultiBiasKernelImpl4b1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4bMultiBiasKernel<int8_t, true>(config);
+}
+
+void AffineMultiBiasKernelImplU4b2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4bMultiBiasKernel<int16_t, false>(config);
+}
+
+void AffineMultiBiasKernelImplU4b1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine4bMultiBiasKernel<int8_t, false>(config);
+}
+
+void DiagonalKernelImpl4b2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    diagonal4bKernel<int16_t, true>(config);
+}
+
+void DiagonalKernelImpl4b1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    diagonal4bKernel<int8_t, true>(config);
+}
+
+void DiagonalKernelImplU4b2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    diagonal4bKernel<int16_t, false>(config);
+}
+
+void DiagonalKernelImplU4b1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    diagonal4bKernel<int8_t, false>(config);
+}
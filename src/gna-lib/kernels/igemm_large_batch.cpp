@@ -0,0 +1,487 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "igemv8.h"
+#include "igemv16.h"
+#include "saturate.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+
+// Number of input vectors processed at once, so partial sums and input block stay in cache
+constexpr uint32_t VectorBlockSize = 128;
+
+// Output rows and input vectors of single tile, with partial sums kept in registers
+constexpr uint32_t RowTileSize = 4;
+constexpr uint32_t VectorTileSize = 16;
+
+// Number of input elements summed at once, products of at most 1B x 2B operands do not overflow 32 bits
+constexpr uint32_t ProductRunMax = 256;
+
+// Weight rows of tile converted to pairs of 2B weights, reused by all tiles of vector block
+using WeightPairs = int32_t[RowTileSize][ProductRunMax / 2];
+
+template<typename InputType, typename WeightType>
+using ProductSum = typename std::conditional<
+    sizeof(InputType) == 2 && sizeof(WeightType) == 2, int64_t, int32_t>::type;
+
+#if OPT_LEVEL > 1
+#if OPT_LEVEL == 6 || OPT_LEVEL == 7
+using Vector = __m256i;
+
+// Number of input vectors of single SIMD pass
+constexpr uint32_t PassVectorCount = 16;
+
+inline Vector loadInputs(int16_t const * const input)
+{
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input));
+}
+
+inline Vector loadInputs(int8_t const * const input)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(input)));
+}
+
+inline Vector setZero()
+{
+    return _mm256_setzero_si256();
+}
+
+inline Vector broadcast(int32_t const value)
+{
+    return _mm256_set1_epi32(value);
+}
+
+inline Vector unpackLow(Vector const a, Vector const b)
+{
+    return _mm256_unpacklo_epi16(a, b);
+}
+
+inline Vector unpackHigh(Vector const a, Vector const b)
+{
+    return _mm256_unpackhi_epi16(a, b);
+}
+
+inline Vector madd(Vector const a, Vector const b)
+{
+    return _mm256_madd_epi16(a, b);
+}
+
+inline Vector add(Vector const a, Vector const b)
+{
+    return _mm256_add_epi32(a, b);
+}
+
+inline Vector add64(Vector const a, Vector const b)
+{
+    return _mm256_add_epi64(a, b);
+}
+
+inline Vector widenLow(Vector const a)
+{
+    return _mm256_cvtepi32_epi64(_mm256_castsi256_si128(a));
+}
+
+inline Vector widenHigh(Vector const a)
+{
+    return _mm256_cvtepi32_epi64(_mm256_extracti128_si256(a, 1));
+}
+
+// unpacking is done within 128-bit lanes, so low holds vectors 0-3 and 8-11, high 4-7 and 12-15
+inline void storeSums(int32_t * const sums, Vector const low, Vector const high)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums), _mm256_permute2x128_si256(low, high, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums + 8), _mm256_permute2x128_si256(low, high, 0x31));
+}
+
+inline void storeSums(int64_t * const sums, Vector const lowLow, Vector const lowHigh,
+    Vector const highLow, Vector const highHigh)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums), lowLow);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums + 4), highLow);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums + 8), lowHigh);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums + 12), highHigh);
+}
+#else
+using Vector = __m128i;
+
+// Number of input vectors of single SIMD pass
+constexpr uint32_t PassVectorCount = 8;
+
+inline Vector loadInputs(int16_t const * const input)
+{
+    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(input));
+}
+
+inline Vector loadInputs(int8_t const * const input)
+{
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(input)));
+}
+
+inline Vector setZero()
+{
+    return _mm_setzero_si128();
+}
+
+inline Vector broadcast(int32_t const value)
+{
+    return _mm_set1_epi32(value);
+}
+
+inline Vector unpackLow(Vector const a, Vector const b)
+{
+    return _mm_unpacklo_epi16(a, b);
+}
+
+inline Vector unpackHigh(Vector const a, Vector const b)
+{
+    return _mm_unpackhi_epi16(a, b);
+}
+
+inline Vector madd(Vector const a, Vector const b)
+{
+    return _mm_madd_epi16(a, b);
+}
+
+inline Vector add(Vector const a, Vector const b)
+{
+    return _mm_add_epi32(a, b);
+}
+
+inline Vector add64(Vector const a, Vector const b)
+{
+    return _mm_add_epi64(a, b);
+}
+
+inline Vector widenLow(Vector const a)
+{
+    return _mm_cvtepi32_epi64(a);
+}
+
+inline Vector widenHigh(Vector const a)
+{
+    return _mm_cvtepi32_epi64(_mm_srli_si128(a, 8));
+}
+
+inline void storeSums(int32_t * const sums, Vector const low, Vector const high)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums), low);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums + 4), high);
+}
+
+inline void storeSums(int64_t * const sums, Vector const lowLow, Vector const lowHigh,
+    Vector const highLow, Vector const highHigh)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums), lowLow);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums + 2), lowHigh);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums + 4), highLow);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums + 6), highHigh);
+}
+#endif
+
+// Sums products of weight pairs and interleaved input vectors for elements [kBegin, kEnd),
+// each pair of elements is multiplied and added by single madd
+template<typename InputType>
+inline void sumTile(int32_t (&products)[RowTileSize][VectorTileSize], WeightPairs const & weightPairs,
+    InputType const * const input, uint32_t const inputVectorCount, uint32_t const kBegin, uint32_t const kEnd)
+{
+    for (uint32_t pass = 0; pass < VectorTileSize; pass += PassVectorCount)
+    {
+        Vector low[RowTileSize];
+        Vector high[RowTileSize];
+        for (uint32_t r = 0; r < RowTileSize; r++)
+        {
+            low[r] = setZero();
+            high[r] = setZero();
+        }
+        for (auto k = kBegin; k < kEnd; k += 2)
+        {
+            auto const first = loadInputs(input + k * inputVectorCount + pass);
+            auto const second = k + 1 < kEnd ? loadInputs(input + (k + 1) * inputVectorCount + pass) : setZero();
+            auto const inputsLow = unpackLow(first, second);
+            auto const inputsHigh = unpackHigh(first, second);
+            auto const p = (k - kBegin) / 2;
+            for (uint32_t r = 0; r < RowTileSize; r++)
+            {
+                auto const weightPair = broadcast(weightPairs[r][p]);
+                low[r] = add(low[r], madd(inputsLow, weightPair));
+                high[r] = add(high[r], madd(inputsHigh, weightPair));
+            }
+        }
+        for (uint32_t r = 0; r < RowTileSize; r++)
+        {
+            storeSums(&products[r][pass], low[r], high[r]);
+        }
+    }
+}
+
+// 2B weights and 2B inputs, madd results are accumulated in 64 bits as in other 2B kernels
+template<typename InputType>
+inline void sumTile(int64_t (&products)[RowTileSize][VectorTileSize], WeightPairs const & weightPairs,
+    InputType const * const input, uint32_t const inputVectorCount, uint32_t const kBegin, uint32_t const kEnd)
+{
+    constexpr uint32_t passRowCount = 2;
+    for (uint32_t pass = 0; pass < VectorTileSize; pass += PassVectorCount)
+    {
+        for (uint32_t row = 0; row < RowTileSize; row += passRowCount)
+        {
+            Vector sums[passRowCount][4];
+            for (auto & rowSums : sums)
+            {
+                for (auto & sum : rowSums)
+                {
+                    sum = setZero();
+                }
+            }
+            for (auto k = kBegin; k < kEnd; k += 2)
+            {
+                auto const first = loadInputs(input + k * inputVectorCount + pass);
+                auto const second = k + 1 < kEnd ? loadInputs(input + (k + 1) * inputVectorCount + pass) : setZero();
+                auto const inputsLow = unpackLow(first, second);
+                auto const inputsHigh = unpackHigh(first, second);
+                auto const p = (k - kBegin) / 2;
+                for (uint32_t r = 0; r < passRowCount; r++)
+                {
+                    auto const weightPair = broadcast(weightPairs[row + r][p]);
+                    auto const productsLow = madd(inputsLow, weightPair);
+                    auto const productsHigh = madd(inputsHigh, weightPair);
+                    sums[r][0] = add64(sums[r][0], widenLow(productsLow));
+                    sums[r][1] = add64(sums[r][1], widenHigh(productsLow));
+                    sums[r][2] = add64(sums[r][2], widenLow(productsHigh));
+                    sums[r][3] = add64(sums[r][3], widenHigh(productsHigh));
+                }
+            }
+            for (uint32_t r = 0; r < passRowCount; r++)
+            {
+                storeSums(&products[row + r][pass], sums[r][0], sums[r][1], sums[r][2], sums[r][3]);
+            }
+        }
+    }
+}
+
+// Converts weights of elements [kBegin, kEnd) to pairs, missing rows and odd element are zeroed
+template<typename WeightType>
+inline void makeWeightPairs(WeightPairs & weightPairs, WeightType const * const weights,
+    uint32_t const inputElementCount, uint32_t const rowCount, uint32_t const kBegin, uint32_t const kEnd)
+{
+    auto const pairCount = (kEnd - kBegin + 1) / 2;
+    for (uint32_t r = 0; r < RowTileSize; r++)
+    {
+        auto const * const weightRow = weights + r * inputElementCount;
+        for (uint32_t p = 0; p < pairCount; p++)
+        {
+            auto const k = kBegin + 2 * p;
+            auto const first = r < rowCount ? static_cast<uint16_t>(weightRow[k]) : uint16_t{ 0 };
+            auto const second = r < rowCount && k + 1 < kEnd ? static_cast<uint16_t>(weightRow[k + 1]) : uint16_t{ 0 };
+            weightPairs[r][p] = static_cast<int32_t>(first | (static_cast<uint32_t>(second) << 16));
+        }
+    }
+}
+#endif
+
+// Sums products of weight rows and interleaved input vectors for elements [kBegin, kEnd),
+// used by generic kernels and for partial tiles left at matrix edges
+template<typename Sum, typename InputType, typename WeightType>
+void sumEdgeTile(Sum (&products)[RowTileSize][VectorTileSize],
+    WeightType const * const weights, InputType const * const input,
+    uint32_t const inputElementCount, uint32_t const inputVectorCount,
+    uint32_t const kBegin, uint32_t const kEnd, uint32_t const rowCount, uint32_t const vectorCount)
+{
+    for (uint32_t r = 0; r < rowCount; r++)
+    {
+        for (uint32_t n = 0; n < vectorCount; n++)
+        {
+            products[r][n] = 0;
+        }
+        for (auto k = kBegin; k < kEnd; k++)
+        {
+            auto const weight = static_cast<Sum>(weights[r * inputElementCount + k]);
+            auto const * const inputRow = input + k * inputVectorCount;
+            for (uint32_t n = 0; n < vectorCount; n++)
+            {
+                products[r][n] += weight * static_cast<Sum>(inputRow[n]);
+            }
+        }
+    }
+}
+
+template<typename InputType, typename WeightType, bool isBiasCompound>
+void affineLargeBatch(ExecutionKernelConfig<AffineConfig> const * const config,
+    uint32_t const vectorBegin, uint32_t const vectorEnd, uint32_t const kpartial)
+{
+    using Sum = ProductSum<InputType, WeightType>;
+
+    auto const & transform = config->RequestConfig.Transform;
+    auto const inputVectorCount = transform.inputVectorCount;
+    auto const inputElementCount = transform.inputElementCount;
+    auto const outputElementCount = transform.outputElementCount;
+    auto const * const input = reinterpret_cast<InputType const *>(config->RequestConfig.Inputs);
+    auto const * const weights = reinterpret_cast<WeightType const *>(transform.weights1B);
+    auto * const output = reinterpret_cast<int32_t *>(config->RequestConfig.Outputs);
+
+    int64_t sums[RowTileSize][VectorBlockSize];
+    Sum products[RowTileSize][VectorTileSize];
+#if OPT_LEVEL > 1
+    WeightPairs weightPairs;
+#endif
+
+    for (auto blockBegin = vectorBegin; blockBegin < vectorEnd; blockBegin += VectorBlockSize)
+    {
+        auto const blockCount = (std::min)(VectorBlockSize, vectorEnd - blockBegin);
+        for (uint32_t i = 0; i < outputElementCount; i += RowTileSize)
+        {
+            auto const rowCount = (std::min)(RowTileSize, outputElementCount - i);
+            auto const * const weightRows = weights + i * inputElementCount;
+            for (uint32_t r = 0; r < rowCount; r++)
+            {
+                auto const bias = isBiasCompound
+                    ? static_cast<int64_t>(transform.biasesCompound[i + r].Bias)
+                    : static_cast<int64_t>(getBias(transform.biasesSimple, transform.bytesPerBias, i + r));
+                std::fill_n(sums[r], blockCount, bias);
+            }
+
+            // saturation after each kpartial elements as in hardware buffer grouping
+            for (uint32_t kBegin = 0; kBegin < inputElementCount; kBegin += kpartial)
+            {
+                auto const kEnd = (std::min)(kBegin + kpartial, inputElementCount);
+                for (auto runBegin = kBegin; runBegin < kEnd; runBegin += ProductRunMax)
+                {
+                    auto const runEnd = (std::min)(runBegin + ProductRunMax, kEnd);
+#if OPT_LEVEL > 1
+                    makeWeightPairs(weightPairs, weightRows, inputElementCount, rowCount, runBegin, runEnd);
+#endif
+                    for (uint32_t tile = 0; tile < blockCount; tile += VectorTileSize)
+                    {
+                        auto const vectorCount = (std::min)(VectorTileSize, blockCount - tile);
+                        auto const * const inputTile = input + blockBegin + tile;
+#if OPT_LEVEL > 1
+                        if (VectorTileSize == vectorCount)
+                        {
+                            sumTile(products, weightPairs, inputTile, inputVectorCount, runBegin, runEnd);
+                        }
+                        else
+#endif
+                        {
+                            sumEdgeTile<Sum>(products, weightRows, inputTile,
+                                inputElementCount, inputVectorCount, runBegin, runEnd, rowCount, vectorCount);
+                        }
+                        for (uint32_t r = 0; r < rowCount; r++)
+                        {
+                            if (isBiasCompound)
+                            {
+                                auto const multiplier = static_cast<int32_t>(transform.biasesCompound[i + r].Multiplier);
+                                for (uint32_t n = 0; n < vectorCount; n++)
+                                {
+                                    sums[r][tile + n] += static_cast<int64_t>(products[r][n]) * multiplier;
+                                }
+                            }
+                            else
+                            {
+                                for (uint32_t n = 0; n < vectorCount; n++)
+                                {
+                                    sums[r][tile + n] += products[r][n];
+                                }
+                            }
+                        }
+                    }
+                }
+                for (uint32_t r = 0; r < rowCount; r++)
+                {
+                    for (uint32_t n = 0; n < blockCount; n++)
+                    {
+                        saturate(&sums[r][n], config->SaturationCount);
+                    }
+                }
+            }
+
+            for (uint32_t r = 0; r < rowCount; r++)
+            {
+                std::copy_n(sums[r], blockCount, output + (i + r) * inputVectorCount + blockBegin);
+            }
+        }
+    }
+}
+
+template<typename InputType, typename WeightType, bool isBiasCompound>
+void affineLargeBatchKernel(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    auto const inputVectorCount = config->RequestConfig.Transform.inputVectorCount;
+    auto const bufferOffset = sizeof(InputType) == 2 ? XNN_N_GROUP_MAX : 0;
+    auto const getKpartial = [config, bufferOffset](uint32_t groupSize)
+    {
+        return config->BufferElementCount[groupSize - 1 + bufferOffset] / groupSize;
+    };
+
+    auto const remainder = inputVectorCount % XNN_N_GROUP_MAX;
+    auto const fullGroupsEnd = inputVectorCount - remainder;
+    if (fullGroupsEnd > 0)
+    {
+        affineLargeBatch<InputType, WeightType, isBiasCompound>(
+            config, 0, fullGroupsEnd, getKpartial(XNN_N_GROUP_MAX));
+    }
+    if (remainder > 0)
+    {
+        affineLargeBatch<InputType, WeightType, isBiasCompound>(
+            config, fullGroupsEnd, inputVectorCount, getKpartial(remainder));
+    }
+}
+
+// Relaxed variant sums all elements before saturation
+template<typename InputType, typename WeightType, bool isBiasCompound>
+void affineLargeBatchRelaxedKernel(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    auto const & transform = config->RequestConfig.Transform;
+    affineLargeBatch<InputType, WeightType, isBiasCompound>(
+        config, 0, transform.inputVectorCount, transform.inputElementCount);
+}
+
+}
+
+void AffineLargeBatchKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineLargeBatchKernel<int16_t, int8_t, true>(config);
+}
+
+void AffineLargeBatchKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineLargeBatchKernel<int16_t, int16_t, false>(config);
+}
+
+void AffineLargeBatchKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineLargeBatchKernel<int8_t, int8_t, false>(config);
+}
+
+void AffineLargeBatchKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineLargeBatchKernel<int8_t, int16_t, false>(config);
+}
+
+void AffineLargeBatchRelaxedKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineLargeBatchRelaxedKernel<int16_t, int8_t, true>(config);
+}
+
+void AffineLargeBatchRelaxedKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineLargeBatchRelaxedKernel<int16_t, int16_t, false>(config);
+}
+
+void AffineLargeBatchRelaxedKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineLargeBatchRelaxedKernel<int8_t, int8_t, false>(config);
+}
+
+void AffineLargeBatchRelaxedKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineLargeBatchRelaxedKernel<int8_t, int16_t, false>(config);
+}
@@ -0,0 +1,514 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "igemv8.h"
+#include "igemv16.h"
+#include "pwl.h"
+#include "saturate.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#define InitializeActivationFunctions KERNEL(InitializeActivationFunctions)
+
+namespace
+{
+
+enum class BiasKind
+{
+    Simple,
+    Compound,
+    Multi,
+};
+
+template<typename InputType, typename WeightType>
+constexpr bool IsWideProduct()
+{
+    return sizeof(InputType) == 2 && sizeof(WeightType) == 2;
+}
+
+#if OPT_LEVEL > 1
+// Number of multiply-adds summed in 32 bits before widening to 64 bits,
+// 2B x 2B madd results are summed as signed high and unsigned low 16 bits, so they do not overflow
+template<typename InputType, typename WeightType>
+constexpr uint32_t GetMaddRunMax()
+{
+    return IsWideProduct<InputType, WeightType>() ? 4096 : 128;
+}
+
+#if OPT_LEVEL == 6 || OPT_LEVEL == 7
+using Vector = __m256i;
+
+constexpr uint32_t VectorElementCount = 16;
+
+inline Vector load(int16_t const * const values)
+{
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(values));
+}
+
+inline Vector load(int8_t const * const values)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(values)));
+}
+
+inline Vector setZero()
+{
+    return _mm256_setzero_si256();
+}
+
+inline Vector madd(Vector const a, Vector const b)
+{
+    return _mm256_madd_epi16(a, b);
+}
+
+inline Vector add32(Vector const a, Vector const b)
+{
+    return _mm256_add_epi32(a, b);
+}
+
+inline Vector low16(Vector const a)
+{
+    return _mm256_and_si256(a, _mm256_set1_epi32(0xFFFF));
+}
+
+inline Vector high16(Vector const a)
+{
+    return _mm256_srai_epi32(a, 16);
+}
+
+// adds 32-bit sums multiplied by 2^shift
+template<int shift>
+inline Vector widenAdd(Vector const sum64, Vector const sum32)
+{
+    auto const wide = _mm256_add_epi64(
+        _mm256_cvtepi32_epi64(_mm256_castsi256_si128(sum32)),
+        _mm256_cvtepi32_epi64(_mm256_extracti128_si256(sum32, 1)));
+    return _mm256_add_epi64(sum64, _mm256_slli_epi64(wide, shift));
+}
+
+inline int64_t sumAll(Vector const sum64)
+{
+    return _mm256_hsum_epi64(sum64);
+}
+#else
+using Vector = __m128i;
+
+constexpr uint32_t VectorElementCount = 8;
+
+inline Vector load(int16_t const * const values)
+{
+    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(values));
+}
+
+inline Vector load(int8_t const * const values)
+{
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(values)));
+}
+
+inline Vector setZero()
+{
+    return _mm_setzero_si128();
+}
+
+inline Vector madd(Vector const a, Vector const b)
+{
+    return _mm_madd_epi16(a, b);
+}
+
+inline Vector add32(Vector const a, Vector const b)
+{
+    return _mm_add_epi32(a, b);
+}
+
+inline Vector low16(Vector const a)
+{
+    return _mm_and_si128(a, _mm_set1_epi32(0xFFFF));
+}
+
+inline Vector high16(Vector const a)
+{
+    return _mm_srai_epi32(a, 16);
+}
+
+// adds 32-bit sums multiplied by 2^shift
+template<int shift>
+inline Vector widenAdd(Vector const sum64, Vector const sum32)
+{
+    auto const wide = _mm_add_epi64(
+        _mm_cvtepi32_epi64(sum32), _mm_cvtepi32_epi64(_mm_srli_si128(sum32, 8)));
+    return _mm_add_epi64(sum64, _mm_slli_epi64(wide, shift));
+}
+
+inline int64_t sumAll(Vector const sum64)
+{
+    return _mm_extract_epi64(sum64, 0) + _mm_extract_epi64(sum64, 1);
+}
+#endif
+
+// 32-bit partial sums of single input vector
+template<bool isWideProduct>
+struct PartialSum
+{
+    Vector Low = setZero();
+    Vector High = setZero();
+
+    void Add(Vector const products)
+    {
+        if (isWideProduct)
+        {
+            Low = add32(Low, low16(products));
+            High = add32(High, high16(products));
+        }
+        else
+        {
+            Low = add32(Low, products);
+        }
+    }
+
+    Vector WidenTo(Vector const sum64) const
+    {
+        if (isWideProduct)
+        {
+            return widenAdd<16>(widenAdd<0>(sum64, Low), High);
+        }
+        return widenAdd<0>(sum64, Low);
+    }
+};
+#endif
+
+// Adds products of weight row and vectorCount flat input vectors to sums,
+// single weight load is shared by all vectors
+template<uint32_t vectorCount, typename InputType, typename WeightType>
+inline void sumRow(int64_t * const sums, WeightType const * const weights,
+    InputType const * const input, uint32_t const inputStride, uint32_t const elementCount)
+{
+    uint32_t k = 0;
+#if OPT_LEVEL > 1
+    using Partial = PartialSum<IsWideProduct<InputType, WeightType>()>;
+    // few vectors do not hide madd latency, thus are summed in two independent chains
+    constexpr uint32_t chainCount = vectorCount <= 2 ? 2 : 1;
+    constexpr uint32_t step = chainCount * VectorElementCount;
+    auto const simdEnd = elementCount - elementCount % VectorElementCount;
+    Vector sums64[vectorCount];
+    for (auto & sum : sums64)
+    {
+        sum = setZero();
+    }
+    while (k < simdEnd)
+    {
+        auto const runEnd = (std::min)(k + GetMaddRunMax<InputType, WeightType>() * VectorElementCount, simdEnd);
+        Partial partials[chainCount][vectorCount];
+        for (; k + step <= runEnd; k += step)
+        {
+            for (uint32_t c = 0; c < chainCount; c++)
+            {
+                auto const offset = k + c * VectorElementCount;
+                auto const weightValues = load(weights + offset);
+                for (uint32_t j = 0; j < vectorCount; j++)
+                {
+                    partials[c][j].Add(madd(weightValues, load(input + j * inputStride + offset)));
+                }
+            }
+        }
+        for (; k < runEnd; k += VectorElementCount)
+        {
+            auto const weightValues = load(weights + k);
+            for (uint32_t j = 0; j < vectorCount; j++)
+            {
+                partials[0][j].Add(madd(weightValues, load(input + j * inputStride + k)));
+            }
+        }
+        for (auto const & chain : partials)
+        {
+            for (uint32_t j = 0; j < vectorCount; j++)
+            {
+                sums64[j] = chain[j].WidenTo(sums64[j]);
+            }
+        }
+    }
+    for (uint32_t j = 0; j < vectorCount; j++)
+    {
+        sums[j] += sumAll(sums64[j]);
+    }
+#endif
+    for (; k < elementCount; k++)
+    {
+        auto const weight = static_cast<int64_t>(weights[k]);
+        for (uint32_t j = 0; j < vectorCount; j++)
+        {
+            sums[j] += weight * input[j * inputStride + k];
+        }
+    }
+}
+
+template<typename InputType, typename WeightType>
+inline void sumRow(uint32_t const vectorCount, int64_t * const sums, WeightType const * const weights,
+    InputType const * const input, uint32_t const inputStride, uint32_t const elementCount)
+{
+    switch (vectorCount)
+    {
+    case 1:
+        sumRow<1>(sums, weights, input, inputStride, elementCount);
+        break;
+    case 2:
+        sumRow<2>(sums, weights, input, inputStride, elementCount);
+        break;
+    case 3:
+        sumRow<3>(sums, weights, input, inputStride, elementCount);
+        break;
+    case 4:
+        sumRow<4>(sums, weights, input, inputStride, elementCount);
+        break;
+    case 5:
+        sumRow<5>(sums, weights, input, inputStride, elementCount);
+        break;
+    case 6:
+        sumRow<6>(sums, weights, input, inputStride, elementCount);
+        break;
+    case 7:
+        sumRow<7>(sums, weights, input, inputStride, elementCount);
+        break;
+    default:
+        sumRow<XNN_N_GROUP_MAX>(sums, weights, input, inputStride, elementCount);
+        break;
+    }
+}
+
+// Bias and multiplier of output row, multiplier is used only for 1B weights with 2B inputs
+template<typename InputType, typename WeightType, BiasKind biasKind>
+inline void getBiasAndMultiplier(AffineConfig const & transform, uint32_t const i, int64_t & bias, int64_t & multiplier)
+{
+    multiplier = 1;
+    switch (biasKind)
+    {
+    case BiasKind::Compound:
+        bias = transform.biasesCompound[i].Bias;
+        multiplier = transform.biasesCompound[i].Multiplier;
+        break;
+    case BiasKind::Multi:
+        bias = getBias(transform.multiBias, transform.bytesPerBias, i * transform.multiBiasVectorCount);
+        if (sizeof(InputType) == 2 && sizeof(WeightType) == 1)
+        {
+            multiplier = transform.weightScaleFactors[i].Multiplier;
+        }
+        break;
+    default:
+        bias = getBias(transform.biasesSimple, transform.bytesPerBias, i);
+        break;
+    }
+}
+
+// Calculates rows of affine transform without emulation of device buffers,
+// sums are saturated once, when stored to output,
+// for all rows when indices are not provided, output row l is written for l-th row
+template<typename InputType, typename WeightType, BiasKind biasKind>
+void affineRelaxed(ExecutionKernelConfig<AffineConfig> const * const config,
+    uint32_t const * const indices, uint32_t const rowCount)
+{
+    auto const & transform = config->RequestConfig.Transform;
+    auto const inputVectorCount = transform.inputVectorCount;
+    auto const inputElementCount = transform.inputElementCount;
+    auto const * const input = reinterpret_cast<InputType const *>(config->RequestConfig.Inputs);
+    auto const * const weights = reinterpret_cast<WeightType const *>(transform.weights1B);
+    auto * const output = reinterpret_cast<int32_t *>(config->RequestConfig.Outputs);
+    auto * const flatInput = reinterpret_cast<InputType *>(config->Intermediate->d0);
+
+    int64_t sums[XNN_N_GROUP_MAX];
+
+    for (uint32_t groupBegin = 0; groupBegin < inputVectorCount; groupBegin += XNN_N_GROUP_MAX)
+    {
+        auto const groupSize = (std::min)(XNN_N_GROUP_MAX, inputVectorCount - groupBegin);
+        for (uint32_t k = 0; k < inputElementCount; k++)
+        {
+            auto const * const inputRow = input + k * inputVectorCount + groupBegin;
+            for (uint32_t j = 0; j < groupSize; j++)
+            {
+                flatInput[j * inputElementCount + k] = inputRow[j];
+            }
+        }
+
+        for (uint32_t l = 0; l < rowCount; l++)
+        {
+            auto const i = (nullptr != indices) ? indices[l] : l;
+            int64_t bias;
+            int64_t multiplier;
+            getBiasAndMultiplier<InputType, WeightType, biasKind>(transform, i, bias, multiplier);
+            std::fill_n(sums, groupSize, 0);
+            sumRow(groupSize, sums, weights + i * inputElementCount, flatInput, inputElementCount, inputElementCount);
+            for (uint32_t j = 0; j < groupSize; j++)
+            {
+                auto const sum = bias + multiplier * sums[j];
+                saturate_store_out(&sum, output + l * inputVectorCount + groupBegin + j, config->SaturationCount);
+            }
+        }
+    }
+}
+
+template<typename InputType, typename WeightType>
+constexpr BiasKind GetSingleBiasKind()
+{
+    return (sizeof(InputType) == 2 && sizeof(WeightType) == 1) ? BiasKind::Compound : BiasKind::Simple;
+}
+
+template<typename InputType, typename WeightType>
+void affineRelaxedKernel(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxed<InputType, WeightType, GetSingleBiasKind<InputType, WeightType>()>(
+        config, nullptr, config->RequestConfig.Transform.outputElementCount);
+}
+
+template<typename InputType, typename WeightType>
+void affineRelaxedActiveListKernel(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl const & al)
+{
+    affineRelaxed<InputType, WeightType, GetSingleBiasKind<InputType, WeightType>()>(
+        config, al.indices, al.count);
+}
+
+template<typename InputType, typename WeightType>
+void affineRelaxedMultiBiasKernel(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxed<InputType, WeightType, BiasKind::Multi>(
+        config, nullptr, config->RequestConfig.Transform.outputElementCount);
+}
+
+// Calculates recurrent transform without emulation of device buffers and activates outputs,
+// vector by vector, as each vector uses activated outputs of previous ones as feedback
+template<typename InputType, typename WeightType>
+void recurrentRelaxedKernel(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    auto const & transform = config->RequestConfig.Transform;
+    auto const inputElementCount = transform.inputElementCount;
+    auto const outputElementCount = transform.outputElementCount;
+    auto const weightRowLength = inputElementCount + outputElementCount;
+    auto const * const weights = reinterpret_cast<WeightType const *>(transform.weights1B);
+    auto const * const feedbackBuffer = reinterpret_cast<int8_t const *>(transform.feedbackBuffer);
+
+    auto activationCfg = ExecutionKernelConfig<ActivationConfig>{ transform.activation, *config };
+    auto const & activation = activationCfg.RequestConfig.Transform;
+    auto & io = activationCfg.RequestConfig;
+    activation.Kernel->InitializeActivationFunctions();
+
+    for (uint32_t n = 0; n < transform.inputVectorCount; n++)
+    {
+        auto const * const input = reinterpret_cast<InputType const *>(config->RequestConfig.Inputs) + n * inputElementCount;
+        auto const * const feedback = feedbackBuffer + n * outputElementCount * transform.bytesPerOutput;
+        auto * const output = transform.output + n * outputElementCount;
+
+        for (uint32_t i = 0; i < outputElementCount; i++)
+        {
+            auto const * const weightRow = weights + i * weightRowLength;
+            int64_t sum = 0;
+            sumRow<1>(&sum, weightRow, input, 0, inputElementCount);
+            if (1 == transform.bytesPerOutput)
+            {
+                sumRow<1>(&sum, weightRow + inputElementCount, feedback, 0, outputElementCount);
+            }
+            else
+            {
+                sumRow<1>(&sum, weightRow + inputElementCount,
+                    reinterpret_cast<int16_t const *>(feedback), 0, outputElementCount);
+            }
+
+            if (GetSingleBiasKind<InputType, WeightType>() == BiasKind::Compound)
+            {
+                sum = transform.biasesCompound[i].Bias + transform.biasesCompound[i].Multiplier * sum;
+            }
+            else
+            {
+                sum += getBias(transform.biasesSimple, transform.bytesPerBias, i);
+            }
+            saturate_store_out(&sum, output + i, config->SaturationCount);
+        }
+
+        io.Inputs = reinterpret_cast<int8_t const *>(output);
+        io.Outputs = config->RequestConfig.Outputs + n * activation.ElementCount * transform.bytesPerOutput;
+        activation.Kernel->ActivateAll(&activationCfg);
+    }
+}
+
+}
+
+void AffineRelaxedKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxedKernel<int16_t, int8_t>(config);
+}
+
+void AffineRelaxedKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxedKernel<int16_t, int16_t>(config);
+}
+
+void AffineRelaxedKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxedKernel<int8_t, int8_t>(config);
+}
+
+void AffineRelaxedKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxedKernel<int8_t, int16_t>(config);
+}
+
+void AffineRelaxedActiveListKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affineRelaxedActiveListKernel<int16_t, int8_t>(config, al);
+}
+
+void AffineRelaxedActiveListKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affineRelaxedActiveListKernel<int16_t, int16_t>(config, al);
+}
+
+void AffineRelaxedActiveListKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affineRelaxedActiveListKernel<int8_t, int8_t>(config, al);
+}
+
+void AffineRelaxedActiveListKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affineRelaxedActiveListKernel<int8_t, int16_t>(config, al);
+}
+
+void AffineMultiBiasRelaxedKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxedMultiBiasKernel<int16_t, int8_t>(config);
+}
+
+void AffineMultiBiasRelaxedKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxedMultiBiasKernel<int16_t, int16_t>(config);
+}
+
+void AffineMultiBiasRelaxedKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxedMultiBiasKernel<int8_t, int8_t>(config);
+}
+
+void AffineMultiBiasRelaxedKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affineRelaxedMultiBiasKernel<int8_t, int16_t>(config);
+}
+
+void RecurrentRelaxedKernelImpl1B2B(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    recurrentRelaxedKernel<int16_t, int8_t>(config);
+}
+
+void RecurrentRelaxedKernelImpl2B2B(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    recurrentRelaxedKernel<int16_t, int16_t>(config);
+}
+
+void RecurrentRelaxedKernelImpl1B1B(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    recurrentRelaxedKernel<int8_t, int8_t>(config);
+}
+
+void RecurrentRelaxedKernelImpl2B1B(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    recurrentRelaxedKernel<int8_t, int16_t>(config);
+}
@@ -28,6 +28,20 @@
 #define AffineMultiBiasKernelImpl2B2B KERNEL(AffineMultiBiasKernelImpl2B2B)
 #define TransposeKernelImpl2B KERNEL(TransposeKernelImpl2B)
 
+#define AffineLargeBatchKernelImpl2B2B KERNEL(AffineLargeBatchKernelImpl2B2B)
+#define AffineLargeBatchKernelImpl2B1B KERNEL(AffineLargeBatchKernelImpl2B1B)
+
+#define AffineRelaxedKernelImpl2B2B KERNEL(AffineRelaxedKernelImpl2B2B)
+#define AffineRelaxedKernelImpl2B1B KERNEL(AffineRelaxedKernelImpl2B1B)
+#define AffineRelaxedActiveListKernelImpl2B2B KERNEL(AffineRelaxedActiveListKernelImpl2B2B)
+#define AffineRelaxedActiveListKernelImpl2B1B KERNEL(AffineRelaxedActiveListKernelImpl2B1B)
+#define AffineMultiBiasRelaxedKernelImpl2B2B KERNEL(AffineMultiBiasRelaxedKernelImpl2B2B)
+#define AffineMultiBiasRelaxedKernelImpl2B1B KERNEL(AffineMultiBiasRelaxedKernelImpl2B1B)
+#define AffineLargeBatchRelaxedKernelImpl2B2B KERNEL(AffineLargeBatchRelaxedKernelImpl2B2B)
+#define AffineLargeBatchRelaxedKernelImpl2B1B KERNEL(AffineLargeBatchRelaxedKernelImpl2B1B)
+#define RecurrentRelaxedKernelImpl2B2B KERNEL(RecurrentRelaxedKernelImpl2B2B)
+#define RecurrentRelaxedKernelImpl2B1B KERNEL(RecurrentRelaxedKernelImpl2B1B)
+
 // Calculates affine transform on interleaved input vectors
 // (input vectors in N columns, vector elements in K rows)
 void AffineKernelImpl2B(ExecutionKernelConfig<AffineConfig> const * const config);
@@ -47,9 +61,29 @@ void AffineMultiBiasKernelImpl2B(ExecutionKernelConfig<AffineConfig> const * con
 void RecurrentKernelImpl2B(ExecutionKernelConfig<RecurrentConfig> const * const config);
 
 void DiagonalKernelImpl2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void DiagonalKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void DiagonalKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 
 void TransposeKernelImpl2B(TransposeConfig const * const transposeConfig);
 
+// Calculates affine transform on interleaved input vectors without transposition,
+// for any number of input vectors, saturating as for consecutive groups of XNN_N_GROUP_MAX vectors
+void AffineLargeBatchKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineLargeBatchKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+
+// Calculates affine and recurrent transforms without emulation of device buffers,
+// sums are saturated once, when stored to output, i.e., results are not consistent with device
+void AffineRelaxedKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineRelaxedKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineRelaxedActiveListKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+void AffineRelaxedActiveListKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+void AffineMultiBiasRelaxedKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineMultiBiasRelaxedKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineLargeBatchRelaxedKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineLargeBatchRelaxedKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void RecurrentRelaxedKernelImpl2B2B(ExecutionKernelConfig<RecurrentConfig> const * const config);
+void RecurrentRelaxedKernelImpl2B1B(ExecutionKernelConfig<RecurrentConfig> const * const config);
+
 #if OPT_LEVEL < 2
 void TransposeKernelImpl1B(TransposeConfig const * const transposeConfig);
 void AffineKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
@@ -60,8 +94,6 @@ void AffineMultiBiasKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * c
 void AffineMultiBiasKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 void RecurrentKernelImpl2B1B(ExecutionKernelConfig<RecurrentConfig> const * const config);
 void RecurrentKernelImpl2B2B(ExecutionKernelConfig<RecurrentConfig> const * const config);
-void DiagonalKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
-void DiagonalKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 #endif
 
 #if OPT_LEVEL == 3 || OPT_LEVEL == 7
@@ -0,0 +1,56 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#define AffineKernelImpl4b2B KERNEL(AffineKernelImpl4b2B)
+#define AffineKernelImpl4b1B KERNEL(AffineKernelImpl4b1B)
+#define AffineKernelImplU4b2B KERNEL(AffineKernelImplU4b2B)
+#define AffineKernelImplU4b1B KERNEL(AffineKernelImplU4b1B)
+
+#define AffineActiveListKernelImpl4b2B KERNEL(AffineActiveListKernelImpl4b2B)
+#define AffineActiveListKernelImpl4b1B KERNEL(AffineActiveListKernelImpl4b1B)
+#define AffineActiveListKernelImplU4b2B KERNEL(AffineActiveListKernelImplU4b2B)
+#define AffineActiveListKernelImplU4b1B KERNEL(AffineActiveListKernelImplU4b1B)
+
+#define AffineMultiBiasKernelImpl4b2B KERNEL(AffineMultiBiasKernelImpl4b2B)
+#define AffineMultiBiasKernelImpl4b1B KERNEL(AffineMultiBiasKernelImpl4b1B)
+#define AffineMultiBiasKernelImplU4b2B KERNEL(AffineMultiBiasKernelImplU4b2B)
+#define AffineMultiBiasKernelImplU4b1B KERNEL(AffineMultiBiasKernelImplU4b1B)
+
+#define DiagonalKernelImpl4b2B KERNEL(DiagonalKernelImpl4b2B)
+#define DiagonalKernelImpl4b1B KERNEL(DiagonalKernelImpl4b1B)
+#define DiagonalKernelImplU4b2B KERNEL(DiagonalKernelImplU4b2B)
+#define DiagonalKernelImplU4b1B KERNEL(DiagonalKernelImplU4b1B)
+
+// Calculates affine transform with signed (4b) or unsigned (U4b) 4-bit weights
+// on interleaved input vectors (input vectors in N columns, vector elements in K rows),
+// weight pairs are packed in single byte, lower nibble first.
+// Input vectors are processed in groups of XNN_N_GROUP_MAX, thus any number of vectors is supported
+void AffineKernelImpl4b2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineKernelImpl4b1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineKernelImplU4b2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineKernelImplU4b1B(ExecutionKernelConfig<AffineConfig> const * const config);
+
+// Calculates affine transform with 4-bit weights, uses active outputs list
+void AffineActiveListKernelImpl4b2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+void AffineActiveListKernelImpl4b1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+void AffineActiveListKernelImplU4b2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+void AffineActiveListKernelImplU4b1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+
+// Calculates affine transform with 4-bit weights, handles multi bias
+// and weight scale factors for 2B inputs
+void AffineMultiBiasKernelImpl4b2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineMultiBiasKernelImpl4b1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineMultiBiasKernelImplU4b2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineMultiBiasKernelImplU4b1B(ExecutionKernelConfig<AffineConfig> const * const config);
+
+void DiagonalKernelImpl4b2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void DiagonalKernelImpl4b1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void DiagonalKernelImplU4b2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void DiagonalKernelImplU4b1B(ExecutionKernelConfig<AffineConfig> const * const config);
@@ -28,6 +28,20 @@
 #define DiagonalKernelImpl1B2B KERNEL(DiagonalKernelImpl1B2B)
 #define TransposeKernelImpl2B KERNEL(TransposeKernelImpl2B)
 
+#define AffineLargeBatchKernelImpl1B2B KERNEL(AffineLargeBatchKernelImpl1B2B)
+#define AffineLargeBatchKernelImpl1B1B KERNEL(AffineLargeBatchKernelImpl1B1B)
+
+#define AffineRelaxedKernelImpl1B2B KERNEL(AffineRelaxedKernelImpl1B2B)
+#define AffineRelaxedKernelImpl1B1B KERNEL(AffineRelaxedKernelImpl1B1B)
+#define AffineRelaxedActiveListKernelImpl1B2B KERNEL(AffineRelaxedActiveListKernelImpl1B2B)
+#define AffineRelaxedActiveListKernelImpl1B1B KERNEL(AffineRelaxedActiveListKernelImpl1B1B)
+#define AffineMultiBiasRelaxedKernelImpl1B2B KERNEL(AffineMultiBiasRelaxedKernelImpl1B2B)
+#define AffineMultiBiasRelaxedKernelImpl1B1B KERNEL(AffineMultiBiasRelaxedKernelImpl1B1B)
+#define AffineLargeBatchRelaxedKernelImpl1B2B KERNEL(AffineLargeBatchRelaxedKernelImpl1B2B)
+#define AffineLargeBatchRelaxedKernelImpl1B1B KERNEL(AffineLargeBatchRelaxedKernelImpl1B1B)
+#define RecurrentRelaxedKernelImpl1B2B KERNEL(RecurrentRelaxedKernelImpl1B2B)
+#define RecurrentRelaxedKernelImpl1B1B KERNEL(RecurrentRelaxedKernelImpl1B1B)
+
 // Calculates affine transform on interleaved input vectors
 // (input vectors in N columns, vector elements in K rows)
 void AffineKernelImpl1B(ExecutionKernelConfig<AffineConfig> const * const config);
@@ -48,11 +62,32 @@ void AffineMultiBiasKernelImpl1B(ExecutionKernelConfig<AffineConfig> const * con
 void RecurrentKernelImpl1B(ExecutionKernelConfig<RecurrentConfig> const * const config);
 
 void DiagonalKernelImpl1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void DiagonalKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void DiagonalKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+
+void TransposeKernelImpl1B(TransposeConfig const * const transposeConfig);
 
 void TransposeKernelImpl2B(TransposeConfig const * const transposeConfig);
 
+// Calculates affine transform on interleaved input vectors without transposition,
+// for any number of input vectors, saturating as for consecutive groups of XNN_N_GROUP_MAX vectors
+void AffineLargeBatchKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineLargeBatchKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+
+// Calculates affine and recurrent transforms without emulation of device buffers,
+// sums are saturated once, when stored to output, i.e., results are not consistent with device
+void AffineRelaxedKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineRelaxedKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineRelaxedActiveListKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+void AffineRelaxedActiveListKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+void AffineMultiBiasRelaxedKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineMultiBiasRelaxedKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineLargeBatchRelaxedKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineLargeBatchRelaxedKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+void RecurrentRelaxedKernelImpl1B2B(ExecutionKernelConfig<RecurrentConfig> const * const config);
+void RecurrentRelaxedKernelImpl1B1B(ExecutionKernelConfig<RecurrentConfig> const * const config);
+
 #if OPT_LEVEL < 2
-void TransposeKernelImpl1B(TransposeConfig const * const transposeConfig);
 void AffineKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
 void AffineKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 void AffineActiveListKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
@@ -61,12 +96,6 @@ void AffineMultiBiasKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * c
 void AffineMultiBiasKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 void RecurrentKernelImpl1B1B(ExecutionKernelConfig<RecurrentConfig> const * const config);
 void RecurrentKernelImpl1B2B(ExecutionKernelConfig<RecurrentConfig> const * const config);
-void DiagonalKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
-void DiagonalKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
-#endif
-
-#if OPT_LEVEL == 2 || OPT_LEVEL == 3 || OPT_LEVEL == 6 || OPT_LEVEL == 7
-void TransposeKernelImpl1B(TransposeConfig const * const transposeConfig);
 #endif
 
 #if OPT_LEVEL == 3 || OPT_LEVEL == 7
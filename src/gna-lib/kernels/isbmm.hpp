@@ -0,0 +1,314 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "saturate.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Element-wise (diagonal) affine transform: O[i;j] = B[i] + W[i] * I[i;j]
+ *
+ * Inputs are interleaved, thus N consecutive elements of input and output share single weight and bias.
+ * Accelerated kernels process groups of output rows filling whole vector register,
+ * each lane picks weight and bias of its row with permutation selected for given N.
+ * Products of supported weights and inputs (and 1B weight multipliers) fit in 32 bits,
+ * so only bias addition may saturate and it is detected from signs of operands.
+ *
+ * Functions are defined in anonymous namespace, as each kernel library is built for different acceleration.
+ */
+namespace
+{
+
+// Number of rows and lanes processed at once by accelerated kernels
+constexpr uint32_t DiagonalLaneCount = 8;
+
+template<typename WeightType, typename BiasType>
+struct DiagonalRow
+{
+    static void Get(AffineConfig const & transform, uint32_t const i, int64_t & bias, int64_t & weight)
+    {
+        bias = reinterpret_cast<BiasType const *>(transform.biasesSimple)[i];
+        weight = reinterpret_cast<WeightType const *>(transform.weights1B)[i];
+    }
+};
+
+template<typename WeightType>
+struct DiagonalRow<WeightType, BiasCompound>
+{
+    static void Get(AffineConfig const & transform, uint32_t const i, int64_t & bias, int64_t & weight)
+    {
+        bias = transform.biasesCompound[i].Bias;
+        weight = transform.biasesCompound[i].Multiplier
+            * static_cast<int64_t>(reinterpret_cast<WeightType const *>(transform.weights1B)[i]);
+    }
+};
+
+template<typename WeightType, typename InputType, typename BiasType>
+void diagonalRows(ExecutionKernelConfig<AffineConfig> const * const config, uint32_t const firstRow)
+{
+    auto const & transform = config->RequestConfig.Transform;
+    auto const inputVectorCount = transform.inputVectorCount;
+    auto const * const input = reinterpret_cast<InputType const *>(config->RequestConfig.Inputs);
+    auto * const output = reinterpret_cast<int32_t *>(config->RequestConfig.Outputs);
+
+    for (auto i = firstRow; i < transform.outputElementCount; i++)
+    {
+        int64_t bias;
+        int64_t weight;
+        DiagonalRow<WeightType, BiasType>::Get(transform, i, bias, weight);
+        for (uint32_t j = 0; j < inputVectorCount; j++)
+        {
+            auto const sum = bias + weight * input[i * inputVectorCount + j];
+            saturate_store_out(&sum, &output[i * inputVectorCount + j], config->SaturationCount);
+        }
+    }
+}
+
+#if OPT_LEVEL == 7
+
+using DiagonalLanes = __m256i;
+
+inline DiagonalLanes loadLanes(int8_t const * const values)
+{
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(values)));
+}
+
+inline DiagonalLanes loadLanes(int16_t const * const values)
+{
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(values)));
+}
+
+inline DiagonalLanes loadLanes(int32_t const * const values)
+{
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(values));
+}
+
+// Splits 8 compound biases into biases and multipliers
+inline void loadLanes(BiasCompound const * const values, DiagonalLanes & bias, DiagonalLanes & multiplier)
+{
+    auto const evenOdd = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    auto const low = _mm256_permutevar8x32_epi32(
+        _mm256_loadu_si256(reinterpret_cast<__m256i const *>(values)), evenOdd);
+    auto const high = _mm256_permutevar8x32_epi32(
+        _mm256_loadu_si256(reinterpret_cast<__m256i const *>(values + 4)), evenOdd);
+    bias = _mm256_permute2x128_si256(low, high, 0x20);
+    multiplier = _mm256_and_si256(_mm256_permute2x128_si256(low, high, 0x31), _mm256_set1_epi32(0xFF));
+}
+
+// Lane permutation broadcasting row parameters to all N lanes of the row
+struct DiagonalLayout
+{
+    explicit DiagonalLayout(uint32_t const inputVectorCount) :
+        rowsPerStep{ DiagonalLaneCount / inputVectorCount }
+    {
+        int32_t rows[DiagonalLaneCount];
+        for (uint32_t lane = 0; lane < DiagonalLaneCount; lane++)
+        {
+            rows[lane] = static_cast<int32_t>(lane / inputVectorCount);
+        }
+        permutation = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(rows));
+        valid = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int32_t>(rowsPerStep * inputVectorCount)),
+            _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    }
+
+    DiagonalLanes Expand(DiagonalLanes const rows) const
+    {
+        return _mm256_permutevar8x32_epi32(rows, permutation);
+    }
+
+    uint32_t const rowsPerStep;
+    DiagonalLanes permutation;
+    DiagonalLanes valid;
+};
+
+// Stores saturated sum of bias and product, returns number of saturated valid lanes
+inline uint32_t storeSaturated(int32_t * const output, DiagonalLanes const bias, DiagonalLanes const product,
+    DiagonalLanes const valid)
+{
+    auto const sum = _mm256_add_epi32(bias, product);
+    auto const overflow = _mm256_andnot_si256(_mm256_xor_si256(bias, product), _mm256_xor_si256(bias, sum));
+    auto const limit = _mm256_xor_si256(_mm256_srai_epi32(bias, 31), _mm256_set1_epi32(INT32_MAX));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(output), _mm256_blendv_epi8(sum, limit, _mm256_srai_epi32(overflow, 31)));
+    return static_cast<uint32_t>(_mm_popcnt_u32(static_cast<uint32_t>(
+        _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(overflow, valid))))));
+}
+
+inline DiagonalLanes multiplyLanes(DiagonalLanes const left, DiagonalLanes const right)
+{
+    return _mm256_mullo_epi32(left, right);
+}
+
+#elif OPT_LEVEL == 3 || OPT_LEVEL == 5
+
+// Pair of 128-bit registers, as 256-bit integer instructions are not available
+struct DiagonalLanes
+{
+    __m128i Low;
+    __m128i High;
+};
+
+inline DiagonalLanes loadLanes(int8_t const * const values)
+{
+    auto const packed = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(values));
+    return { _mm_cvtepi8_epi32(packed), _mm_cvtepi8_epi32(_mm_srli_si128(packed, 4)) };
+}
+
+inline DiagonalLanes loadLanes(int16_t const * const values)
+{
+    auto const packed = _mm_loadu_si128(reinterpret_cast<__m128i const *>(values));
+    return { _mm_cvtepi16_epi32(packed), _mm_cvtepi16_epi32(_mm_srli_si128(packed, 8)) };
+}
+
+inline DiagonalLanes loadLanes(int32_t const * const values)
+{
+    return { _mm_loadu_si128(reinterpret_cast<__m128i const *>(values)),
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(values + 4)) };
+}
+
+// Splits 8 compound biases into biases and multipliers
+inline void loadLanes(BiasCompound const * const values, DiagonalLanes & bias, DiagonalLanes & multiplier)
+{
+    __m128 packed[4];
+    for (auto i = 0; i < 4; i++)
+    {
+        packed[i] = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(values + 2 * i)));
+    }
+    auto const mask = _mm_set1_epi32(0xFF);
+    bias.Low = _mm_castps_si128(_mm_shuffle_ps(packed[0], packed[1], _MM_SHUFFLE(2, 0, 2, 0)));
+    bias.High = _mm_castps_si128(_mm_shuffle_ps(packed[2], packed[3], _MM_SHUFFLE(2, 0, 2, 0)));
+    multiplier.Low = _mm_and_si128(_mm_castps_si128(_mm_shuffle_ps(packed[0], packed[1], _MM_SHUFFLE(3, 1, 3, 1))), mask);
+    multiplier.High = _mm_and_si128(_mm_castps_si128(_mm_shuffle_ps(packed[2], packed[3], _MM_SHUFFLE(3, 1, 3, 1))), mask);
+}
+
+// Lane permutation broadcasting row parameters to all N lanes of the row
+struct DiagonalLayout
+{
+    explicit DiagonalLayout(uint32_t const inputVectorCount) :
+        rowsPerStep{ DiagonalLaneCount / inputVectorCount },
+        isIdentity{ 1 == inputVectorCount }
+    {
+        // for N > 1 all lanes use rows from lower register
+        uint8_t bytes[2 * sizeof(__m128i)];
+        for (uint32_t lane = 0; lane < DiagonalLaneCount; lane++)
+        {
+            for (uint32_t byte = 0; byte < sizeof(int32_t); byte++)
+            {
+                bytes[lane * sizeof(int32_t) + byte] = static_cast<uint8_t>((lane / inputVectorCount) * sizeof(int32_t) + byte);
+            }
+        }
+        permutationLow = _mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes));
+        permutationHigh = _mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes + sizeof(__m128i)));
+
+        auto const validCount = _mm_set1_epi32(static_cast<int32_t>(rowsPerStep * inputVectorCount));
+        valid.Low = _mm_cmpgt_epi32(validCount, _mm_setr_epi32(0, 1, 2, 3));
+        valid.High = _mm_cmpgt_epi32(validCount, _mm_setr_epi32(4, 5, 6, 7));
+    }
+
+    DiagonalLanes Expand(DiagonalLanes const rows) const
+    {
+        if (isIdentity)
+        {
+            return rows;
+        }
+        return { _mm_shuffle_epi8(rows.Low, permutationLow), _mm_shuffle_epi8(rows.Low, permutationHigh) };
+    }
+
+    uint32_t const rowsPerStep;
+    bool const isIdentity;
+    __m128i permutationLow;
+    __m128i permutationHigh;
+    DiagonalLanes valid;
+};
+
+inline uint32_t storeSaturated(int32_t * const output, __m128i const bias, __m128i const product, __m128i const valid)
+{
+    auto const sum = _mm_add_epi32(bias, product);
+    auto const overflow = _mm_andnot_si128(_mm_xor_si128(bias, product), _mm_xor_si128(bias, sum));
+    auto const limit = _mm_xor_si128(_mm_srai_epi32(bias, 31), _mm_set1_epi32(INT32_MAX));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_blendv_epi8(sum, limit, _mm_srai_epi32(overflow, 31)));
+    return static_cast<uint32_t>(_mm_popcnt_u32(static_cast<uint32_t>(
+        _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(overflow, valid))))));
+}
+
+// Stores saturated sum of bias and product, returns number of saturated valid lanes
+inline uint32_t storeSaturated(int32_t * const output, DiagonalLanes const bias, DiagonalLanes const product,
+    DiagonalLanes const valid)
+{
+    return storeSaturated(output, bias.Low, product.Low, valid.Low)
+        + storeSaturated(output + 4, bias.High, product.High, valid.High);
+}
+
+inline DiagonalLanes multiplyLanes(DiagonalLanes const left, DiagonalLanes const right)
+{
+    return { _mm_mullo_epi32(left.Low, right.Low), _mm_mullo_epi32(left.High, right.High) };
+}
+
+#endif
+
+template<typename WeightType, typename InputType, typename BiasType>
+void diagonalKernel(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    uint32_t i = 0;
+#if OPT_LEVEL == 3 || OPT_LEVEL == 5 || OPT_LEVEL == 7
+    auto const & transform = config->RequestConfig.Transform;
+    auto const inputVectorCount = transform.inputVectorCount;
+    if (inputVectorCount > 0 && inputVectorCount <= DiagonalLaneCount)
+    {
+        auto const * const input = reinterpret_cast<InputType const *>(config->RequestConfig.Inputs);
+        auto * const output = reinterpret_cast<int32_t *>(config->RequestConfig.Outputs);
+        auto const * const weights = reinterpret_cast<WeightType const *>(transform.weights1B);
+        auto const layout = DiagonalLayout{ inputVectorCount };
+        auto saturationCount = uint32_t{ 0 };
+
+        // lanes past rows of the step are stored as well and overwritten by next step or remaining rows
+        for (; i + DiagonalLaneCount <= transform.outputElementCount; i += layout.rowsPerStep)
+        {
+            DiagonalLanes bias;
+            DiagonalLanes weight;
+            if constexpr (std::is_same<BiasType, BiasCompound>::value)
+            {
+                DiagonalLanes multiplier;
+                loadLanes(transform.biasesCompound + i, bias, multiplier);
+                weight = multiplyLanes(loadLanes(weights + i), multiplier);
+            }
+            else
+            {
+                bias = loadLanes(reinterpret_cast<BiasType const *>(transform.biasesSimple) + i);
+                weight = loadLanes(weights + i);
+            }
+            auto const product = multiplyLanes(layout.Expand(weight), loadLanes(input + i * inputVectorCount));
+            saturationCount += storeSaturated(output + i * inputVectorCount, layout.Expand(bias), product,
+                layout.valid);
+        }
+        *config->SaturationCount += saturationCount;
+    }
+#endif
+    diagonalRows<WeightType, InputType, BiasType>(config, i);
+}
+
+template<typename WeightType, typename InputType>
+void diagonalSimpleBiasKernel(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    switch (config->RequestConfig.Transform.bytesPerBias)
+    {
+    case 1:
+        diagonalKernel<WeightType, InputType, int8_t>(config);
+        break;
+    case 2:
+        diagonalKernel<WeightType, InputType, int16_t>(config);
+        break;
+    default:
+        diagonalKernel<WeightType, InputType, int32_t>(config);
+        break;
+    }
+}
+
+}
@@ -81,7 +81,7 @@ void gmm_maxmix_8u16u_32u(GmmConfig const * const config)
             int16_t Diff16s = static_cast<int16_t>(config->Input[j] - mean[j]);
             uint16_t SqrDiff16s = static_cast<uint16_t>(Diff16s * Diff16s);
 
-            Score64u += static_cast<uint64_t>(SqrDiff16s * var[j]);
+            Score64u += static_cast<uint64_t>(SqrDiff16s) * var[j];
         }
 
         // sum may saturate depending on value of const
@@ -471,7 +471,7 @@ void pwlKernelImplSingleLookup(PwlCachedConfig const * const pwl, int32_t I, int
 {
     int64_t k;                      // lookup table iterator and helper
     int64_t sum;                    // tmp sum
-    pwl_u_t* lookup = (pwl_u_t*)pwl->data;  // lookup table
+    pwl_u_t* lookup = (pwl_u_t*)pwl->lookup;  // lookup table
 
     sum = I + (int64_t)pwl->Params.Lookup.xBase0Neg;
     if (sum > 0)
@@ -536,7 +536,7 @@ void pwlKernelImplAllLookup(ExecutionKernelConfig<ActivationConfig> const * cons
     output = config->RequestConfig.Outputs;
     do
     {
-        lookup = (pwl_u_t*)pwl->data;
+        lookup = (pwl_u_t*)pwl->lookup;
         sum = *input + xBase0;
         if (sum > 0)
         {
@@ -663,12 +663,12 @@ PwlCached::PwlCached(uint32_t elementSize, PwlSegment const * const segmentsIn,
             countTmp = (uint64_t)j / (uint64_t)widthTmp + 1;
             if (0 < countTmp && countTmp <= PWL_LOOKUP_COUNT)
             {
-                useLookup = true;
+                isLookupApplicable = true;
             }
         }
     }
     // second pass - PWL pwl.lookup build
-    if (useLookup)
+    if (isLookupApplicable)
     {
         allocateLookupCaches();
         pwl.Params.Lookup.xBase0 = segmentsIn[0].xBase & XBASEMASK;
@@ -706,7 +706,7 @@ PwlCached::PwlCached(uint32_t elementSize, PwlSegment const * const segmentsIn,
             {
                 if ((i & 1) != 0)
                 {
-                    LookupSegment = &((pwl_u_t*)pwl.data)[(i & ~1u) / 2];
+                    LookupSegment = &((pwl_u_t*)pwl.lookup)[(i & ~1u) / 2];
                     LookupSegment->xBaseB = usegTmp.xBase;
                     LookupSegment->slopeB = usegTmp.slope;
                     LookupSegment->shiftB = usegTmp.shift;
@@ -714,7 +714,7 @@ PwlCached::PwlCached(uint32_t elementSize, PwlSegment const * const segmentsIn,
                 }
                 else
                 {
-                    LookupSegment = &((pwl_u_t*)pwl.data)[i / 2];
+                    LookupSegment = &((pwl_u_t*)pwl.lookup)[i / 2];
                     LookupSegment->xBaseA = usegTmp.xBase;
                     LookupSegment->slopeA = usegTmp.slope;
                     LookupSegment->shiftA = usegTmp.shift;
@@ -735,7 +735,7 @@ PwlCached::PwlCached(uint32_t elementSize, PwlSegment const * const segmentsIn,
         {
             if ((i & 1) != 0)
             {
-                LookupSegment = &((pwl_u_t*)pwl.data)[(i & ~1u) / 2];
+                LookupSegment = &((pwl_u_t*)pwl.lookup)[(i & ~1u) / 2];
                 LookupSegment->xBaseB = usegTmp.xBase;
                 LookupSegment->slopeB = usegTmp.slope;
                 LookupSegment->shiftB = usegTmp.shift;
@@ -743,7 +743,7 @@ PwlCached::PwlCached(uint32_t elementSize, PwlSegment const * const segmentsIn,
             }
             else
             {
-                LookupSegment = &((pwl_u_t*)pwl.data)[i / 2];
+                LookupSegment = &((pwl_u_t*)pwl.lookup)[i / 2];
                 LookupSegment->xBaseA = usegTmp.xBase;
                 LookupSegment->slopeA = usegTmp.slope;
                 LookupSegment->shiftA = usegTmp.shift;
@@ -752,44 +752,47 @@ PwlCached::PwlCached(uint32_t elementSize, PwlSegment const * const segmentsIn,
         }
         for (i = 0; i < countTmp; i++)
         {
-            ((pwl_u_t*)pwl.data)[i].xBaseA = ((pwl_u_t*)pwl.data)[i].xBaseA - ((pwl_u_t*)pwl.data)[i].xBaseB;
+            ((pwl_u_t*)pwl.lookup)[i].xBaseA = ((pwl_u_t*)pwl.lookup)[i].xBaseA - ((pwl_u_t*)pwl.lookup)[i].xBaseB;
         }
     }
-    else
-    {
-        pwl.Params.Binary.source = (PwlSegment*)segmentsIn;
-        pwl.Params.Binary.xBase0 = segmentsIn[0].xBase & XBASEMASK;
-        pwl.Params.Binary.yBase0 = segmentsIn[0].yBase;
-        pwl.Params.Binary.shift0 = static_cast<uint8_t>(((segmentsIn[0].xBase & ~XBASEMASK) + 1) << BIT_SHIFT_SIZE); // prod_shift = prod >> slope_shift
+    // binary search is prepared as well, as it may be selected instead of lookup
+    pwl.Params.Binary.source = (PwlSegment*)segmentsIn;
+    pwl.Params.Binary.xBase0 = segmentsIn[0].xBase & XBASEMASK;
+    pwl.Params.Binary.yBase0 = segmentsIn[0].yBase;
+    pwl.Params.Binary.shift0 = static_cast<uint8_t>(((segmentsIn[0].xBase & ~XBASEMASK) + 1) << BIT_SHIFT_SIZE); // prod_shift = prod >> slope_shift
 
-        if (pwl.segmentCount > 32)
-        {
-            allocateBinaryCaches();
-            i = 0;
-            for (; i < pwl.segmentCount; i++)
-            {
-                ((pwl_x_t*)pwl.data)[i] = -1 * (pwl_x_t)(segmentsIn[i].xBase & XBASEMASK);
-                pwl.Params.Binary.ySeg[i].shift = static_cast<int16_t>(
-                        ((segmentsIn[i].xBase & ~XBASEMASK) + 1) << BIT_SHIFT_SIZE);
-                pwl.Params.Binary.ySeg[i].slope = segmentsIn[i].Slope;
-                pwl.Params.Binary.ySeg[i].resvd = 0;
-                pwl.Params.Binary.ySeg[i].yBase = segmentsIn[i].yBase;
-            }
-        }
-        else
-        {
-            pwl.data = nullptr;
+    if (pwl.segmentCount > 32)
+    {
+        allocateBinaryCaches();
+        i = 0;
+        for (; i < pwl.segmentCount; i++)
+        {
+            ((pwl_x_t*)pwl.data)[i] = -1 * (pwl_x_t)(segmentsIn[i].xBase & XBASEMASK);
+            pwl.Params.Binary.ySeg[i].shift = static_cast<int16_t>(
+                    ((segmentsIn[i].xBase & ~XBASEMASK) + 1) << BIT_SHIFT_SIZE);
+            pwl.Params.Binary.ySeg[i].slope = segmentsIn[i].Slope;
+            pwl.Params.Binary.ySeg[i].resvd = 0;
+            pwl.Params.Binary.ySeg[i].yBase = segmentsIn[i].yBase;
         }
     }
+    else
+    {
+        pwl.data = nullptr;
+    }
+    useLookup = isLookupApplicable;
 }
 
 PwlCached::~PwlCached()
 {
+    if (nullptr != pwl.lookup)
+    {
+        _gna_free(pwl.lookup);
+    }
     if (nullptr != pwl.data)
     {
         _gna_free(pwl.data);
-        memset(&pwl, 0, sizeof(pwl));
     }
+    memset(&pwl, 0, sizeof(pwl));
 }
 
 void PwlCached::allocateBinaryCaches()
@@ -806,11 +809,11 @@ void PwlCached::allocateBinaryCaches()
 
 void PwlCached::allocateLookupCaches()
 {
-    pwl.data = _gna_malloc(PWL_LOOKUP_SIZE);
-    if (nullptr == pwl.data)
+    pwl.lookup = _gna_malloc(PWL_LOOKUP_SIZE);
+    if (nullptr == pwl.lookup)
     {
         throw std::runtime_error("PwlCached::allocateLookupCaches() failed.");
     }
-    memset(pwl.data, 0xff, PWL_LOOKUP_SIZE);
+    memset(pwl.lookup, 0xff, PWL_LOOKUP_SIZE);
 }
 #endif
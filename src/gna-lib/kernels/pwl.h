@@ -8,6 +8,7 @@
 
 #include "KernelArguments.h"
 
+#include <atomic>
 #include <cstdint>
 
 template<typename TransformConfig>
@@ -66,9 +67,11 @@ struct PwlCachedConfig
 {
     uint32_t segmentCount;
     uint32_t bytesPerOutput;
-    void * data;
+    void * data;                        // binary search caches
+    void * lookup;                      // lookup table, when lookup algorithm is applicable
 
-    union PwlCachedParams
+    // both algorithms are prepared when lookup is applicable, so either may be selected
+    struct PwlCachedParams
     {
         struct
         {
@@ -104,7 +107,22 @@ typedef void(*PwlApplyAll)(ExecutionKernelConfig<ActivationConfig> const * const
 // PWL cache and config (constant for given layer)
 struct PwlCached
 {
-    bool useLookup = false;
+    // Whether lookup table is built, i.e. segments are dense enough
+    bool IsLookupApplicable() const
+    {
+        return isLookupApplicable;
+    }
+
+    bool IsLookupSelected() const
+    {
+        return useLookup;
+    }
+
+    // Selects lookup table or binary search algorithm, lookup is selected by default when applicable
+    void SelectLookup(bool isLookupSelected) const
+    {
+        useLookup = isLookupApplicable && isLookupSelected;
+    }
 
     void InitializeActivationFunctions_generic_sat() const;
     void InitializeActivationFunctions_sse4_sat() const;
@@ -136,6 +154,11 @@ struct PwlCached
 private:
     void allocateLookupCaches();
     void allocateBinaryCaches();
+
+    bool isLookupApplicable = false;
+
+    // algorithms give the same results, thus selection may change while other threads compute
+    mutable std::atomic<bool> useLookup{ false };
 };
 
 }
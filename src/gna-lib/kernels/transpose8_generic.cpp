@@ -6,16 +6,31 @@
 #include "igemv8.h"
 #include "KernelArguments.h"
 
+#include <algorithm>
 #include <cstdint>
 
 void TransposeKernelImpl1B(TransposeConfig const * const transposeConfig)
 {
-    uint32_t i, j;
-    for (i = 0; i < transposeConfig->rowCount; i++)
+    // tiles keep both source rows and destination columns within L1 for long matrices
+    constexpr uint32_t tileSize = 64;
+    auto const rowCount = transposeConfig->rowCount;
+    auto const columnCount = transposeConfig->columnCount;
+    auto const input = (int8_t const *)transposeConfig->input;
+    auto const output = (int8_t *)transposeConfig->output;
+
+    for (uint32_t rowTile = 0; rowTile < rowCount; rowTile += tileSize)
     {
-        for (j = 0; j < transposeConfig->columnCount; j++)
+        auto const rowEnd = (std::min)(rowTile + tileSize, rowCount);
+        for (uint32_t columnTile = 0; columnTile < columnCount; columnTile += tileSize)
         {
-            ((int8_t*)transposeConfig->output)[j * transposeConfig->rowCount + i] = ((int8_t*)transposeConfig->input)[i * transposeConfig->columnCount + j];
+            auto const columnEnd = (std::min)(columnTile + tileSize, columnCount);
+            for (uint32_t j = columnTile; j < columnEnd; j++)
+            {
+                for (uint32_t i = rowTile; i < rowEnd; i++)
+                {
+                    output[j * rowCount + i] = input[i * columnCount + j];
+                }
+            }
         }
     }
 }
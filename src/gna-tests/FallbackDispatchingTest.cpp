@@ -0,0 +1,225 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+/**
+ Check of Gna2AccelerationModeHardwareWithSoftwareFallback request dispatching
+ against simulated device driver. Requests are routed to software only when
+ software budget is set and more than one thread scores requests,
+ while requests of the same request configuration or session never overlap.
+ */
+
+#include "SimulatedDriverInterface.h"
+
+#include "gna2-api.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace GNA;
+
+namespace
+{
+
+constexpr uint32_t InputCount = 256;
+constexpr uint32_t OutputCount = 256;
+constexpr uint32_t RequestCount = 64;
+
+SimulatedDriverInterface::Statistics driverStatistics;
+
+void check(Gna2Status status, char const * what)
+{
+    if (Gna2StatusSuccess != status)
+    {
+        throw std::runtime_error{ std::string{ what } + " failed with status " + std::to_string(status) };
+    }
+}
+
+void * allocate(uint32_t size)
+{
+    uint32_t granted = 0;
+    void * memory = nullptr;
+    check(Gna2MemoryAlloc(size, &granted, &memory), "Gna2MemoryAlloc");
+    memset(memory, 0, size);
+    return memory;
+}
+
+void * allocateOperation(uint32_t size)
+{
+    return malloc(size);
+}
+
+struct Result
+{
+    uint32_t Hardware;
+    uint64_t Fallbacks;
+    uint32_t Failed;
+};
+
+class Fixture
+{
+public:
+    Fixture()
+    {
+        input = allocate(InputCount * sizeof(int16_t));
+        weights = allocate(OutputCount * InputCount * sizeof(int16_t));
+        biases = allocate(OutputCount * sizeof(int32_t));
+        for (uint32_t i = 0; i < InputCount; i++)
+        {
+            static_cast<int16_t *>(input)[i] = static_cast<int16_t>(i % 7) - 3;
+        }
+        for (uint32_t i = 0; i < OutputCount * InputCount; i++)
+        {
+            static_cast<int16_t *>(weights)[i] = static_cast<int16_t>(i % 5) - 2;
+        }
+        auto inputTensor = Gna2TensorInit2D(InputCount, 1, Gna2DataTypeInt16, input);
+        auto outputTensor = Gna2TensorInit2D(OutputCount, 1, Gna2DataTypeInt32, nullptr);
+        auto weightTensor = Gna2TensorInit2D(OutputCount, InputCount, Gna2DataTypeInt16, weights);
+        auto biasTensor = Gna2TensorInit1D(OutputCount, Gna2DataTypeInt32, biases);
+        check(Gna2OperationInitFullyConnectedAffine(&operation, allocateOperation,
+            &inputTensor, &outputTensor, &weightTensor, &biasTensor, nullptr), "Gna2OperationInitFullyConnectedAffine");
+        Gna2Model model{ 1, &operation };
+        check(Gna2ModelCreate(0, &model, &modelId), "Gna2ModelCreate");
+    }
+
+    // configurations are kept until exit, as release of configuration unmaps its buffers
+    uint32_t CreateConfiguration(Gna2AccelerationMode mode, void * output)
+    {
+        uint32_t configId = 0;
+        check(Gna2RequestConfigCreate(modelId, &configId), "Gna2RequestConfigCreate");
+        check(Gna2RequestConfigSetAccelerationMode(configId, mode), "Gna2RequestConfigSetAccelerationMode");
+        check(Gna2RequestConfigSetOperandBuffer(configId, 0, 1, output), "Gna2RequestConfigSetOperandBuffer");
+        return configId;
+    }
+
+    // Enqueues requests of configurations or sessions in turn and waits for all of them
+    Result Run(std::vector<uint32_t> const & ids, bool isSession, uint32_t threadCount, uint32_t budget)
+    {
+        check(Gna2DeviceSetNumberOfThreads(0, threadCount), "Gna2DeviceSetNumberOfThreads");
+        check(Gna2DeviceSetSoftwareFallbackBudget(0, budget), "Gna2DeviceSetSoftwareFallbackBudget");
+        check(Gna2ModelResetStatistics(modelId, nullptr), "Gna2ModelResetStatistics");
+        auto const submitted = driverStatistics.Submitted.load();
+        uint32_t failed = 0;
+        std::vector<uint32_t> pending;
+        for (uint32_t i = 0; i < RequestCount; i++)
+        {
+            auto const id = ids[i % ids.size()];
+            uint32_t requestId = 0;
+            check(isSession ? Gna2SessionEnqueue(id, &requestId) : Gna2RequestEnqueue(id, &requestId),
+                isSession ? "Gna2SessionEnqueue" : "Gna2RequestEnqueue");
+            pending.push_back(requestId);
+        }
+        for (auto const requestId : pending)
+        {
+            failed += Gna2StatusSuccess != Gna2RequestWait(requestId, 100000) ? 1 : 0;
+        }
+        Gna2RequestStatistics statistics = {};
+        check(Gna2ModelResetStatistics(modelId, &statistics), "Gna2ModelResetStatistics");
+        return { driverStatistics.Submitted - submitted, statistics.NumberOfFallbacks, failed };
+    }
+
+    uint32_t modelId = 0;
+
+private:
+    void * input;
+    void * weights;
+    void * biases;
+    Gna2Operation operation = {};
+};
+
+uint32_t failureCount = 0;
+
+void expect(bool condition, char const * what, Result const & result)
+{
+    printf("%-48s hardware %3u fallbacks %3u failed %3u %s\n", what, result.Hardware,
+        static_cast<uint32_t>(result.Fallbacks), result.Failed, condition ? "OK" : "FAILED");
+    failureCount += condition ? 0 : 1;
+}
+
+}
+
+int main()
+try
+{
+    DriverInterface::SetFactory([]()
+    {
+        return std::make_unique<SimulatedDriverInterface>(std::chrono::microseconds{ 2000 }, 2, driverStatistics);
+    });
+    check(Gna2DeviceOpen(0), "Gna2DeviceOpen");
+    Gna2DeviceVersion version;
+    check(Gna2DeviceGetVersion(0, &version), "Gna2DeviceGetVersion");
+    if (Gna2DeviceVersion3_0 != version)
+    {
+        throw std::runtime_error{ "simulated device not used" };
+    }
+
+    Fixture fixture;
+    std::vector<uint32_t> configs;
+    std::vector<void *> outputs;
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        outputs.push_back(allocate(OutputCount * sizeof(int32_t)));
+        configs.push_back(fixture.CreateConfiguration(Gna2AccelerationModeHardwareWithSoftwareFallback, outputs.back()));
+    }
+
+    auto result = fixture.Run(configs, false, 4, 0);
+    expect(RequestCount == result.Hardware && 0 == result.Fallbacks && 0 == result.Failed,
+        "budget 0 scores all requests on device", result);
+
+    result = fixture.Run(configs, false, 1, 1);
+    expect(RequestCount == result.Hardware && 0 == result.Fallbacks && 0 == result.Failed,
+        "single thread scores all requests on device", result);
+
+    for (auto const output : outputs)
+    {
+        memset(output, 0x5A, OutputCount * sizeof(int32_t));
+    }
+    result = fixture.Run(configs, false, 4, 1);
+    // simulated device does not compute outputs, at least one software scored output is expected
+    auto const reference = allocate(OutputCount * sizeof(int32_t));
+    auto const referenceConfig = fixture.CreateConfiguration(Gna2AccelerationModeSoftware, reference);
+    uint32_t requestId = 0;
+    check(Gna2RequestEnqueue(referenceConfig, &requestId), "Gna2RequestEnqueue");
+    check(Gna2RequestWait(requestId, 100000), "Gna2RequestWait");
+    uint32_t computedCount = 0;
+    for (auto const output : outputs)
+    {
+        computedCount += 0 == memcmp(output, reference, OutputCount * sizeof(int32_t)) ? 1 : 0;
+    }
+    expect(RequestCount == result.Hardware + result.Fallbacks && 0 != result.Hardware && 0 != result.Fallbacks
+        && 0 != computedCount && 0 == result.Failed,
+        "budget 1 dispatches requests to software", result);
+
+    // requests of single configuration share its buffers, so they cannot overlap
+    result = fixture.Run({ configs.front() }, false, 4, 1);
+    expect(RequestCount == result.Hardware && 0 == result.Fallbacks && 0 == result.Failed,
+        "single configuration is not dispatched", result);
+
+    uint32_t sessionId = 0;
+    check(Gna2SessionCreate(configs.front(), &sessionId), "Gna2SessionCreate");
+    result = fixture.Run({ sessionId }, true, 4, 1);
+    expect(RequestCount == result.Hardware && 0 == result.Fallbacks && 0 == result.Failed,
+        "single session is not dispatched", result);
+
+    printf("device queue rejections %u, configuration overlaps %u\n",
+        driverStatistics.Rejected.load(), driverStatistics.ConfigurationOverlaps.load());
+    if (0 != driverStatistics.ConfigurationOverlaps)
+    {
+        failureCount++;
+    }
+    check(Gna2DeviceClose(0), "Gna2DeviceClose");
+    return 0 == failureCount ? 0 : 1;
+}
+catch (std::exception const & e)
+{
+    printf("%s\n", e.what());
+    return 1;
+}
@@ -0,0 +1,105 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "SimulatedDriverInterface.h"
+
+#include "GnaException.h"
+#include "HardwareRequest.h"
+#include "Macros.h"
+
+#include <thread>
+
+using namespace GNA;
+
+SimulatedDriverInterface::SimulatedDriverInterface(std::chrono::microseconds latencyIn, uint32_t queueDepthIn,
+    Statistics & statisticsIn) :
+    latency{ latencyIn },
+    queueDepth{ queueDepthIn },
+    statistics{ statisticsIn }
+{
+}
+
+bool SimulatedDriverInterface::OpenDevice(uint32_t deviceIndex)
+{
+    if (0 != deviceIndex)
+    {
+        return false;
+    }
+    driverCapabilities.deviceVersion = Gna2DeviceVersion3_0;
+    driverCapabilities.hwInBuffSize = 32;
+    driverCapabilities.recoveryTimeout = 60;
+    driverCapabilities.isSoftwareFallbackSupported = true;
+    return true;
+}
+
+uint64_t SimulatedDriverInterface::MemoryMap(void *memory, uint32_t memorySize)
+{
+    UNREFERENCED_PARAMETER(memory);
+    UNREFERENCED_PARAMETER(memorySize);
+    std::lock_guard<std::mutex> lock{ queueLock };
+    return nextMemoryId++;
+}
+
+bool SimulatedDriverInterface::MemoryUnmap(uint64_t memoryId)
+{
+    UNREFERENCED_PARAMETER(memoryId);
+    return false;
+}
+
+RequestResult SimulatedDriverInterface::Submit(HardwareRequest& hardwareRequest,
+    RequestProfiler & profiler) const
+{
+    UNREFERENCED_PARAMETER(profiler);
+    createRequestDescriptor(hardwareRequest);
+    auto const configId = hardwareRequest.RequestConfigId;
+    {
+        std::unique_lock<std::mutex> lock{ queueLock };
+        if (submittedCount >= queueDepth)
+        {
+            if (hardwareRequest.IsSwFallbackEnabled())
+            {
+                statistics.Rejected++;
+                throw GnaException{ Gna2StatusDeviceQueueError };
+            }
+            queueCondition.wait(lock, [this]() { return submittedCount < queueDepth; });
+        }
+        submittedCount++;
+        if (0 != submittedConfigurations[configId]++)
+        {
+            statistics.ConfigurationOverlaps++;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> device{ deviceLock };
+        std::this_thread::sleep_for(latency);
+        statistics.Submitted++;
+    }
+    {
+        std::lock_guard<std::mutex> lock{ queueLock };
+        submittedCount--;
+        submittedConfigurations[configId]--;
+    }
+    queueCondition.notify_one();
+
+    RequestResult result = {};
+    result.status = Gna2StatusSuccess;
+    return result;
+}
+
+void SimulatedDriverInterface::createRequestDescriptor(HardwareRequest& hardwareRequest) const
+{
+    for (auto const & buffer : hardwareRequest.DriverMemoryObjects)
+    {
+        // throws for buffers not mapped to device
+        static_cast<void>(buffer.Buffer.GetId());
+    }
+    hardwareRequest.SubmitReady = true;
+}
+
+Gna2Status SimulatedDriverInterface::parseHwStatus(uint32_t hwStatus) const
+{
+    UNREFERENCED_PARAMETER(hwStatus);
+    return Gna2StatusDeviceCriticalFailure;
+}
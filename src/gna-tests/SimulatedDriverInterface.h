@@ -0,0 +1,75 @@
+/**
+ @copyright Copyright (C) 2022 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#pragma once
+
+#include "DriverInterface.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace GNA
+{
+
+// Simulated GNA 3.0 device driver, processing one request at a time
+//
+// Each request occupies device for configured latency, outputs are not computed.
+// Requests submitted when queue depth requests are already submitted are rejected
+// as by driver with busy device queue when software fallback is enabled
+// and wait for device otherwise.
+class SimulatedDriverInterface : public DriverInterface
+{
+public:
+    struct Statistics
+    {
+        // Requests processed by device
+        std::atomic<uint32_t> Submitted{ 0 };
+
+        // Requests rejected due to full device queue
+        std::atomic<uint32_t> Rejected{ 0 };
+
+        // Requests submitted while request of the same request configuration was submitted
+        std::atomic<uint32_t> ConfigurationOverlaps{ 0 };
+    };
+
+    SimulatedDriverInterface(std::chrono::microseconds latencyIn, uint32_t queueDepthIn,
+        Statistics & statisticsIn);
+
+    bool OpenDevice(uint32_t deviceIndex) override;
+
+    uint64_t MemoryMap(void *memory, uint32_t memorySize) override;
+
+    bool MemoryUnmap(uint64_t memoryId) override;
+
+    RequestResult Submit(HardwareRequest& hardwareRequest, RequestProfiler & profiler) const override;
+
+protected:
+    void createRequestDescriptor(HardwareRequest& hardwareRequest) const override;
+
+    Gna2Status parseHwStatus(uint32_t hwStatus) const override;
+
+private:
+    std::chrono::microseconds const latency;
+    uint32_t const queueDepth;
+    Statistics & statistics;
+
+    uint64_t nextMemoryId = 1;
+
+    mutable std::mutex queueLock;
+    mutable std::condition_variable queueCondition;
+    mutable uint32_t submittedCount = 0;
+
+    // Number of submitted requests of each request configuration
+    mutable std::map<uint32_t, uint32_t> submittedConfigurations;
+
+    // Held while request is processed by device
+    mutable std::mutex deviceLock;
+};
+
+}